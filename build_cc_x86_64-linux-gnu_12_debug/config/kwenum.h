@@ -0,0 +1,451 @@
+#ifndef BUILD_CONFIG_KEYWORD_H
+#define BUILD_CONFIG_KEYWORD_H
+enum Keyword {
+	KW_NONE,
+	KW_BARRIER,
+	KW_CAEN_V1190,
+	KW_CAEN_V1290,
+	KW_CAEN_V1725,
+	KW_CAEN_V560,
+	KW_CAEN_V767A,
+	KW_CAEN_V775,
+	KW_CAEN_V785,
+	KW_CAEN_V785N,
+	KW_CAEN_V792,
+	KW_CAEN_V820,
+	KW_CAEN_V830,
+	KW_CAEN_V895,
+	KW_CAEN_V965,
+	KW_CAEN_VMELIB,
+	KW_CRATE,
+	KW_DUMMY,
+	KW_GATE,
+	KW_GSI_CTDC,
+	KW_GSI_CTDC_CARD,
+	KW_GSI_FEBEX,
+	KW_GSI_FEBEX_CARD,
+	KW_GSI_KILOM,
+	KW_GSI_KILOM_CARD,
+	KW_GSI_MPPC_ROB,
+	KW_GSI_MPPC_ROB_CARD,
+	KW_GSI_PEX,
+	KW_GSI_PEXARIA,
+	KW_GSI_RFX1,
+	KW_GSI_SAM,
+	KW_GSI_SIDEREM,
+	KW_GSI_SIDEREM_CRATE,
+	KW_GSI_TACQUILA,
+	KW_GSI_TACQUILA_CRATE,
+	KW_GSI_TAMEX,
+	KW_GSI_TAMEX_CARD,
+	KW_GSI_TRIDI,
+	KW_GSI_TRIVA,
+	KW_GSI_VETAR,
+	KW_GSI_VFTX2,
+	KW_GSI_VULOM,
+	KW_GSI_VUPROM,
+	KW_ID_SKIP,
+	KW_MESYTEC_MADC32,
+	KW_MESYTEC_MDPP16QDC,
+	KW_MESYTEC_MDPP16SCP,
+	KW_MESYTEC_MDPP32QDC,
+	KW_MESYTEC_MDPP32SCP,
+	KW_MESYTEC_MQDC32,
+	KW_MESYTEC_MTDC32,
+	KW_MESYTEC_MVLC,
+	KW_MESYTEC_VMMR8,
+	KW_PNPI_CROS3,
+	KW_PNPI_CROS3_CRATE,
+	KW_PRESET,
+	KW_SCALER,
+	KW_SIS_3316,
+	KW_SIS_3316_PRESET,
+	KW_SIS_3316_TRACES,
+	KW_SIS_3316_TRIGGER,
+	KW_SIS_3801,
+	KW_SIS_3820,
+	KW_SIS_3820_SCALER,
+	KW_TAGS,
+	KW_TAMEX2,
+	KW_TAMEX2_PADI,
+	KW_TAMEX3,
+	KW_TAMEX4_PADI,
+	KW_TAMEX_PADI1,
+	KW_TRACES,
+	KW_TRIGGER,
+	KW_ACCEPT_PULSE,
+	KW_ACCEPT_TRIG,
+	KW_ACTIVE_BUSES,
+	KW_ACVT,
+	KW_ACVT_MISS,
+	KW_ACVT_WINDOW,
+	KW_ADAPTIVE,
+	KW_AGGREGATE_NUM,
+	KW_ALL_OR,
+	KW_AMPLITUDE,
+	KW_AND,
+	KW_ANTICOINCIDENCE,
+	KW_ASYNC,
+	KW_AUTO_PEDESTALS,
+	KW_AUTO_THRESHOLDS,
+	KW_AUTO_THRESHOLDS_REWIND,
+	KW_AUTO_THRESHOLDS_STEP,
+	KW_AUTO_THRESHOLDS_STOP,
+	KW_AVERAGE_LENGTH,
+	KW_AVERAGE_MODE,
+	KW_AVERAGE_PRETRIGGER,
+	KW_BACKOFF,
+	KW_BACKPLANE,
+	KW_BANKS_OPERATION,
+	KW_BASELINE_AVERAGE,
+	KW_BASELINE_DELAY,
+	KW_BASELINE_FIXED,
+	KW_BASELINE_FREEZE,
+	KW_BASELINE_RESTART,
+	KW_BERR,
+	KW_BITS,
+	KW_BJT,
+	KW_BLR,
+	KW_BLT,
+	KW_BLT_2ESST,
+	KW_BLT_2EVME,
+	KW_BLT_EXT,
+	KW_BLT_MODE,
+	KW_BLT_POOL_BYTES,
+	KW_BUDGET,
+	KW_BUF_BYTES,
+	KW_BUF_OFS,
+	KW_BUF_OFS_HI,
+	KW_BUS,
+	KW_BUSY,
+	KW_CBUS,
+	KW_CFD,
+	KW_CFD_DELAY,
+	KW_CFD_FRACTION,
+	KW_CFD_WIDTH,
+	KW_CH_EVEN,
+	KW_CH_ODD,
+	KW_CHANNEL,
+	KW_CHANNEL0_ENABLE,
+	KW_CHANNEL1_ENABLE,
+	KW_CHANNEL2_ENABLE,
+	KW_CHANNEL3_ENABLE,
+	KW_CHANNEL4_ENABLE,
+	KW_CHANNEL_ENABLE,
+	KW_CHANNEL_INVERT,
+	KW_CHANNELS_TO_READ,
+	KW_CHARGE,
+	KW_CHECK_LEVEL,
+	KW_CLK_FREQ,
+	KW_CLOCK_INPUT,
+	KW_COINCIDENCE,
+	KW_COMMON,
+	KW_COMMON_START,
+	KW_COMPRESSED,
+	KW_CONET_NODE,
+	KW_CONNECTED,
+	KW_CONTROL_PORT,
+	KW_CORRECTION_LONG_GAIN,
+	KW_CORRECTION_SHORT_GAIN,
+	KW_CORRECTION_TIMING_FILTER_GAIN,
+	KW_CSI,
+	KW_CYCLE_CLOCK,
+	KW_DARK,
+	KW_DATA_FORMAT,
+	KW_DATA_PATH,
+	KW_DATA_REDUCTION,
+	KW_DATA_THRESHOLD,
+	KW_DEADTIME,
+	KW_DEADTIME_RELEASE,
+	KW_DEADTIME_REORDER,
+	KW_DEBUG,
+	KW_DETECTOR_TYPE,
+	KW_DIFFERENTIATION,
+	KW_DIRECT,
+	KW_DISCARD_DATA,
+	KW_DISCARD_THRESHOLD,
+	KW_DISCRIMINATION,
+	KW_DPP_PSD,
+	KW_ECL,
+	KW_EDGE,
+	KW_ENCODED,
+	KW_ENERGY_FILTER,
+	KW_ENERGY_FILTER_GAP,
+	KW_ENERGY_FILTER_LEFT_SUM,
+	KW_ENERGY_FILTER_RIGHT_SUM,
+	KW_ENERGY_PICKUP,
+	KW_ERROR,
+	KW_ETHERBONE,
+	KW_EVEN_ODD,
+	KW_EVENT_MAX_AUTO,
+	KW_EVENT_MAX_FILL,
+	KW_EVENT_MAX_OVERRIDE,
+	KW_EVENT_MAX_WINDOW,
+	KW_EVENT_THRESHOLD,
+	KW_EXP_TRIG,
+	KW_EXP_TRIG_DELAY0,
+	KW_EXP_TRIG_DELAY1,
+	KW_EXT_CLK_FREQ,
+	KW_EXT_TS_BASELINE,
+	KW_EXT_TS_FINETIME,
+	KW_EXT_TS_FLAGS,
+	KW_EXTERNAL,
+	KW_EXTRA_FILTER,
+	KW_EXTRA_WORD,
+	KW_FALSE,
+	KW_FASTEST,
+	KW_FATAL,
+	KW_FF,
+	KW_FIFO_LENGTH,
+	KW_FILTER_TRACE,
+	KW_FIXED,
+	KW_FREE_RUNNING,
+	KW_FRONTEND,
+	KW_FULL,
+	KW_GAIN,
+	KW_GAP,
+	KW_GAP_E,
+	KW_GATE0,
+	KW_GATE_INPUT,
+	KW_GATE_LONG,
+	KW_GATE_OFFSET,
+	KW_GATE_SHORT,
+	KW_HEADER,
+	KW_HEADER_ID,
+	KW_HIRES,
+	KW_HPGE,
+	KW_INCLUDE,
+	KW_INDEPENDENT,
+	KW_INFO,
+	KW_INHERIT,
+	KW_INIT_GROUP,
+	KW_INIT_SLEEP,
+	KW_INPUT_COINC,
+	KW_INTEGRATION_LONG,
+	KW_INTEGRATION_SHORT,
+	KW_INTERNAL,
+	KW_INTERNAL_TRIGGER_DELAY,
+	KW_INTERNAL_TRIGGER_HOLDOFF,
+	KW_INTERNAL_TRIGGER_WIDTH,
+	KW_INVERT_SIGNAL,
+	KW_IPED,
+	KW_IS_FPBUS_MASTER,
+	KW_JUMPER_RANGE,
+	KW_LABR,
+	KW_LATCHING,
+	KW_LEADING,
+	KW_LED,
+	KW_LEMO,
+	KW_LINK_IP,
+	KW_LINK_NUMBER,
+	KW_LIQUID,
+	KW_LOG_ASYNC,
+	KW_LOG_LEVEL,
+	KW_LONG_RANGE,
+	KW_LVDS,
+	KW_MAJORITY_LEVEL,
+	KW_MAJORITY_WIDTH,
+	KW_MARK_SATURATED,
+	KW_MASTER_START,
+	KW_MAW,
+	KW_MAW_ENERGY,
+	KW_MBLT,
+	KW_MMR64_THRS_BANK0,
+	KW_MMR64_THRS_BANK1,
+	KW_MOBO,
+	KW_MODE,
+	KW_MODULE,
+	KW_MONITOR_CHANNEL,
+	KW_MONITOR_ON,
+	KW_MONITOR_WAVE,
+	KW_MULTI_EVENT,
+	KW_NEG,
+	KW_NIM,
+	KW_NIM_BUSY,
+	KW_NOBLT,
+	KW_NTH,
+	KW_OFF,
+	KW_OFFSET,
+	KW_ON,
+	KW_ONLY_FIRST_HIT,
+	KW_OR,
+	KW_OUTPUT_FORMAT,
+	KW_OUTPUT_WIDTH_0_7,
+	KW_OUTPUT_WIDTH_8_15,
+	KW_PADI,
+	KW_PADI_COMBINE,
+	KW_PADI_OR,
+	KW_PAIR,
+	KW_PAIR_TRIGGER_VALIDATION,
+	KW_PARALLEL_READOUT,
+	KW_PARANOID,
+	KW_PAUX,
+	KW_PEAK,
+	KW_PEAK_E,
+	KW_PEDESTAL,
+	KW_PEX_PARALLEL,
+	KW_PEX_V5,
+	KW_PEX_WAIT,
+	KW_PIGGY_TO_MOBO,
+	KW_PILEUP_LENGTH,
+	KW_PILEUP_TRIGOUT,
+	KW_PIPELINE_READOUT,
+	KW_POLARITY_DETECTION,
+	KW_POLE_ZERO,
+	KW_POLL,
+	KW_POLL_BACKOFF_MAX,
+	KW_POLL_SPIN,
+	KW_POS,
+	KW_POSTINIT_SLEEP,
+	KW_PRETRIGGER_DELAY,
+	KW_PRNG_POISSON,
+	KW_PSD_CUT_ABOVE,
+	KW_PSD_CUT_BELOW,
+	KW_PULSE_WIDTH,
+	KW_PULSER,
+	KW_PULSER_AMPLITUDE,
+	KW_PULSER_ENABLED,
+	KW_QDC_JUMPER,
+	KW_QUICK,
+	KW_RANGE,
+	KW_RATACLOCK_CLK_PERIOD,
+	KW_RATACLOCK_EXPECT_EDGE,
+	KW_RATACLOCK_PULSE_PERIOD_CLK,
+	KW_RATACLOCK_RECEIVE_DELAY,
+	KW_RATACLOCK_USE_AUTO_EDGE,
+	KW_RAW,
+	KW_RAW_TOT,
+	KW_RE_PILEUP_LENGTH,
+	KW_READOUT,
+	KW_REF_CH0,
+	KW_REINIT_CLEAR,
+	KW_REINIT_SLEEP,
+	KW_RESET,
+	KW_RESET_TIME,
+	KW_RESOLUTION,
+	KW_REWRITE,
+	KW_SAMPLE_LENGTH,
+	KW_SAMPLES_PRE,
+	KW_SAMPLES_TOT,
+	KW_SATURATED,
+	KW_SCALER_NAME,
+	KW_SHADOW_BYTES,
+	KW_SHADOW_GROUP,
+	KW_SHADOW_POLL,
+	KW_SHAPED_SELF_TRIGGER,
+	KW_SHAPING_TIME,
+	KW_SIGNAL_DECAYTIME,
+	KW_SIGNAL_POLARITY,
+	KW_SIGNAL_RISETIME,
+	KW_SIGNAL_WIDTH,
+	KW_SILICON,
+	KW_SINGLE,
+	KW_SKIP_DT,
+	KW_SLICE_NUM,
+	KW_SLIDING_SCALE,
+	KW_SLOPE,
+	KW_SLOPPY,
+	KW_SMOOTHING,
+	KW_SPAM,
+	KW_STATISTICS,
+	KW_SUPPRESS_INVALID,
+	KW_SUPPRESS_OVER_RANGE,
+	KW_SUPPRESS_PILEUP,
+	KW_SYNC,
+	KW_SYNC_CH,
+	KW_TAP_DELAY_FINE_TUNE,
+	KW_TAU_FACTOR,
+	KW_TAU_TABLE,
+	KW_TEST_PULSE,
+	KW_TEST_PULSE_CHANNEL,
+	KW_TEST_PULSE_DELAY,
+	KW_TEST_PULSE_FREQ,
+	KW_TEST_PULSE_POLARITY,
+	KW_THRESHOLD,
+	KW_THRESHOLD_BEGIN,
+	KW_THRESHOLD_HIGH_E,
+	KW_THRESHOLD_OFFSET,
+	KW_THRESHOLD_PSD,
+	KW_THRESHOLD_PUR_GAP,
+	KW_THRESHOLD_STEP,
+	KW_TIME_AFTER_TRIGGER,
+	KW_TIME_MERGE,
+	KW_TIME_MERGE_WINDOW,
+	KW_TIME_RANGE,
+	KW_TIMESTAMP,
+	KW_TIMING_RESOLUTION,
+	KW_TOGGLE,
+	KW_TRAILING,
+	KW_TRAILING_AND_LEADING,
+	KW_TRIG0,
+	KW_TRIG1,
+	KW_TRIG_COUNTS,
+	KW_TRIGGER0_ENABLE,
+	KW_TRIGGER1_ENABLE,
+	KW_TRIGGER2_ENABLE,
+	KW_TRIGGER3_ENABLE,
+	KW_TRIGGER4_ENABLE,
+	KW_TRIGGER_CHANNEL,
+	KW_TRIGGER_FILTER_GAP,
+	KW_TRIGGER_FILTER_LEFT_SUM,
+	KW_TRIGGER_FILTER_RIGHT_SUM,
+	KW_TRIGGER_FLAG_DOWNSCALE,
+	KW_TRIGGER_HYSTERESIS,
+	KW_TRIGGER_INPUT,
+	KW_TRIGGER_METHOD,
+	KW_TRIGGER_OUTPUT,
+	KW_TRIGGER_OUTPUT_SRC,
+	KW_TRIGGER_VALIDATION,
+	KW_TRIGOUT_ALL,
+	KW_TRUE,
+	KW_TS_SUBSYSTEM,
+	KW_TTL,
+	KW_TYPE,
+	KW_USE_ACCUMULATOR2,
+	KW_USE_ACCUMULATOR6,
+	KW_USE_AUTO_BANK_SWITCH,
+	KW_USE_CFD_TRIGGER,
+	KW_USE_CLOCK_FROM_VXS,
+	KW_USE_DITHERING,
+	KW_USE_DUAL_THRESHOLD,
+	KW_USE_EXTERNAL_GATE,
+	KW_USE_EXTERNAL_TRIGGER,
+	KW_USE_EXTERNAL_TRIGGER0,
+	KW_USE_EXTERNAL_TRIGGER1,
+	KW_USE_EXTERNAL_VETO,
+	KW_USE_FIFO,
+	KW_USE_INTERNAL_TRIGGER,
+	KW_USE_MAW3,
+	KW_USE_MAW_ENERGY_TEST_BUFFER,
+	KW_USE_MAW_TEST_BUFFER,
+	KW_USE_MAXE,
+	KW_USE_PEAK_CHARGE,
+	KW_USE_RATACLOCK,
+	KW_USE_RATACLOCK_TIMESTAMP,
+	KW_USE_TAU_CORRECTION,
+	KW_USE_TERMINATION,
+	KW_USE_TEST_PULSE,
+	KW_USE_USER_COUNTER,
+	KW_USE_VETO,
+	KW_UTIL_PATH,
+	KW_VERBOSE,
+	KW_VERIFY,
+	KW_VERIFY_BUDGET,
+	KW_VERIFY_LEVEL,
+	KW_VERIFY_NTH,
+	KW_VERSION,
+	KW_VETO_DIRECT,
+	KW_VETO_SOURCE,
+	KW_VETO_WIDTH,
+	KW_WIDTH,
+	KW_WRITE_CACHE,
+	KW_WRITE_HISTOGRAMS,
+	KW_WRITE_TRACES_MAW,
+	KW_WRITE_TRACES_MAW_ENERGY,
+	KW_WRITE_TRACES_RAW,
+	KW_YIELD,
+	KW_ZERO_CROSSING,
+	KW_ZERO_SUPPRESS,
+	KW_THIS_IS_ALWAYS_LAST
+};
+#endif
@@ -0,0 +1,226 @@
+#ifndef MODULE_CAEN_V1190_OFFSETS_H
+#define MODULE_CAEN_V1190_OFFSETS_H
+
+#define MOD_output_buffer 2
+#define BITS_output_buffer 32
+#define  LEN_output_buffer 0
+#define  OFS_output_buffer (0x0 + 0 * 4)
+#define MOD_control 5
+#define BITS_control 16
+#define  LEN_control 0
+#define  OFS_control (0x1000 + 0 * 2)
+#define MOD_status 1
+#define BITS_status 16
+#define  LEN_status 0
+#define  OFS_status (0x1002 + 0 * 2)
+#define MOD_ader_32 5
+#define BITS_ader_32 16
+#define  LEN_ader_32 0
+#define  OFS_ader_32 (0x1004 + 0 * 2)
+#define MOD_ader_24 5
+#define BITS_ader_24 16
+#define  LEN_ader_24 0
+#define  OFS_ader_24 (0x1006 + 0 * 2)
+#define MOD_enable_ader 5
+#define BITS_enable_ader 16
+#define  LEN_enable_ader 0
+#define  OFS_enable_ader (0x1008 + 0 * 2)
+#define MOD_interrupt_level 5
+#define BITS_interrupt_level 16
+#define  LEN_interrupt_level 0
+#define  OFS_interrupt_level (0x100a + 0 * 2)
+#define MOD_interrupt_vector 5
+#define BITS_interrupt_vector 16
+#define  LEN_interrupt_vector 0
+#define  OFS_interrupt_vector (0x100c + 0 * 2)
+#define MOD_geo_address 5
+#define BITS_geo_address 16
+#define  LEN_geo_address 0
+#define  OFS_geo_address (0x100e + 0 * 2)
+#define MOD_mcst_base_address 5
+#define BITS_mcst_base_address 16
+#define  LEN_mcst_base_address 0
+#define  OFS_mcst_base_address (0x1010 + 0 * 2)
+#define MOD_mcst_control 5
+#define BITS_mcst_control 16
+#define  LEN_mcst_control 0
+#define  OFS_mcst_control (0x1012 + 0 * 2)
+#define MOD_module_reset 4
+#define BITS_module_reset 16
+#define  LEN_module_reset 0
+#define  OFS_module_reset (0x1014 + 0 * 2)
+#define MOD_software_clear 4
+#define BITS_software_clear 16
+#define  LEN_software_clear 0
+#define  OFS_software_clear (0x1016 + 0 * 2)
+#define MOD_software_event_reset 4
+#define BITS_software_event_reset 16
+#define  LEN_software_event_reset 0
+#define  OFS_software_event_reset (0x1018 + 0 * 2)
+#define MOD_software_trigger 4
+#define BITS_software_trigger 16
+#define  LEN_software_trigger 0
+#define  OFS_software_trigger (0x101a + 0 * 2)
+#define MOD_event_counter 1
+#define BITS_event_counter 32
+#define  LEN_event_counter 0
+#define  OFS_event_counter (0x101c + 0 * 4)
+#define MOD_event_stored 1
+#define BITS_event_stored 16
+#define  LEN_event_stored 0
+#define  OFS_event_stored (0x1020 + 0 * 2)
+#define MOD_almost_full_level 5
+#define BITS_almost_full_level 16
+#define  LEN_almost_full_level 0
+#define  OFS_almost_full_level (0x1022 + 0 * 2)
+#define MOD_blt_event_number 5
+#define BITS_blt_event_number 16
+#define  LEN_blt_event_number 0
+#define  OFS_blt_event_number (0x1024 + 0 * 2)
+#define MOD_firmware_revision 1
+#define BITS_firmware_revision 16
+#define  LEN_firmware_revision 0
+#define  OFS_firmware_revision (0x1026 + 0 * 2)
+#define MOD_testreg 5
+#define BITS_testreg 32
+#define  LEN_testreg 0
+#define  OFS_testreg (0x1028 + 0 * 4)
+#define MOD_output_prog_control 5
+#define BITS_output_prog_control 16
+#define  LEN_output_prog_control 0
+#define  OFS_output_prog_control (0x102c + 0 * 2)
+#define MOD_micro 5
+#define BITS_micro 16
+#define  LEN_micro 0
+#define  OFS_micro (0x102e + 0 * 2)
+#define MOD_micro_handshake 1
+#define BITS_micro_handshake 16
+#define  LEN_micro_handshake 0
+#define  OFS_micro_handshake (0x1030 + 0 * 2)
+#define MOD_select_flash 5
+#define BITS_select_flash 16
+#define  LEN_select_flash 0
+#define  OFS_select_flash (0x1032 + 0 * 2)
+#define MOD_flash_memory 5
+#define BITS_flash_memory 16
+#define  LEN_flash_memory 0
+#define  OFS_flash_memory (0x1034 + 0 * 2)
+#define MOD_sram_page 5
+#define BITS_sram_page 16
+#define  LEN_sram_page 0
+#define  OFS_sram_page (0x1036 + 0 * 2)
+#define MOD_event_fifo 2
+#define BITS_event_fifo 32
+#define  LEN_event_fifo 0
+#define  OFS_event_fifo (0x1038 + 0 * 4)
+#define MOD_event_fifo_stored 1
+#define BITS_event_fifo_stored 16
+#define  LEN_event_fifo_stored 0
+#define  OFS_event_fifo_stored (0x103c + 0 * 2)
+#define MOD_event_fifo_status 1
+#define BITS_event_fifo_status 16
+#define  LEN_event_fifo_status 0
+#define  OFS_event_fifo_status (0x103e + 0 * 2)
+#define MOD_dummy32 5
+#define BITS_dummy32 32
+#define  LEN_dummy32 0
+#define  OFS_dummy32 (0x1200 + 0 * 4)
+#define MOD_dummy16 5
+#define BITS_dummy16 16
+#define  LEN_dummy16 0
+#define  OFS_dummy16 (0x1204 + 0 * 2)
+#define MOD_rom_checksum 1
+#define BITS_rom_checksum 16
+#define  LEN_rom_checksum 0
+#define  OFS_rom_checksum (0x4000 + 0 * 2)
+#define MOD_rom_checksum_length2 1
+#define BITS_rom_checksum_length2 16
+#define  LEN_rom_checksum_length2 0
+#define  OFS_rom_checksum_length2 (0x4004 + 0 * 2)
+#define MOD_rom_checksum_length1 1
+#define BITS_rom_checksum_length1 16
+#define  LEN_rom_checksum_length1 0
+#define  OFS_rom_checksum_length1 (0x4008 + 0 * 2)
+#define MOD_rom_checksum_length0 1
+#define BITS_rom_checksum_length0 16
+#define  LEN_rom_checksum_length0 0
+#define  OFS_rom_checksum_length0 (0x400c + 0 * 2)
+#define MOD_rom_constant2 1
+#define BITS_rom_constant2 16
+#define  LEN_rom_constant2 0
+#define  OFS_rom_constant2 (0x4010 + 0 * 2)
+#define MOD_rom_constant1 1
+#define BITS_rom_constant1 16
+#define  LEN_rom_constant1 0
+#define  OFS_rom_constant1 (0x4014 + 0 * 2)
+#define MOD_rom_constant0 1
+#define BITS_rom_constant0 16
+#define  LEN_rom_constant0 0
+#define  OFS_rom_constant0 (0x4018 + 0 * 2)
+#define MOD_rom_c_code 1
+#define BITS_rom_c_code 16
+#define  LEN_rom_c_code 0
+#define  OFS_rom_c_code (0x401c + 0 * 2)
+#define MOD_rom_r_code 1
+#define BITS_rom_r_code 16
+#define  LEN_rom_r_code 0
+#define  OFS_rom_r_code (0x4020 + 0 * 2)
+#define MOD_rom_oui2 1
+#define BITS_rom_oui2 16
+#define  LEN_rom_oui2 0
+#define  OFS_rom_oui2 (0x4024 + 0 * 2)
+#define MOD_rom_oui1 1
+#define BITS_rom_oui1 16
+#define  LEN_rom_oui1 0
+#define  OFS_rom_oui1 (0x4028 + 0 * 2)
+#define MOD_rom_oui0 1
+#define BITS_rom_oui0 16
+#define  LEN_rom_oui0 0
+#define  OFS_rom_oui0 (0x402c + 0 * 2)
+#define MOD_rom_vers 1
+#define BITS_rom_vers 16
+#define  LEN_rom_vers 0
+#define  OFS_rom_vers (0x4030 + 0 * 2)
+#define MOD_rom_board2 1
+#define BITS_rom_board2 16
+#define  LEN_rom_board2 0
+#define  OFS_rom_board2 (0x4034 + 0 * 2)
+#define MOD_rom_board1 1
+#define BITS_rom_board1 16
+#define  LEN_rom_board1 0
+#define  OFS_rom_board1 (0x4038 + 0 * 2)
+#define MOD_rom_board0 1
+#define BITS_rom_board0 16
+#define  LEN_rom_board0 0
+#define  OFS_rom_board0 (0x403c + 0 * 2)
+#define MOD_rom_revis3 1
+#define BITS_rom_revis3 16
+#define  LEN_rom_revis3 0
+#define  OFS_rom_revis3 (0x4040 + 0 * 2)
+#define MOD_rom_revis2 1
+#define BITS_rom_revis2 16
+#define  LEN_rom_revis2 0
+#define  OFS_rom_revis2 (0x4044 + 0 * 2)
+#define MOD_rom_revis1 1
+#define BITS_rom_revis1 16
+#define  LEN_rom_revis1 0
+#define  OFS_rom_revis1 (0x4048 + 0 * 2)
+#define MOD_rom_revis0 1
+#define BITS_rom_revis0 16
+#define  LEN_rom_revis0 0
+#define  OFS_rom_revis0 (0x404c + 0 * 2)
+#define MOD_rom_sernum1 1
+#define BITS_rom_sernum1 16
+#define  LEN_rom_sernum1 0
+#define  OFS_rom_sernum1 (0x4080 + 0 * 2)
+#define MOD_rom_sernum0 1
+#define BITS_rom_sernum0 16
+#define  LEN_rom_sernum0 0
+#define  OFS_rom_sernum0 (0x4084 + 0 * 2)
+#define MOD_compensation_sram 1
+#define BITS_compensation_sram 16
+#define  LEN_compensation_sram 0
+#define  OFS_compensation_sram (0x8000 + 0 * 2)
+#define MAP_SIZE 0x8002
+
+#endif
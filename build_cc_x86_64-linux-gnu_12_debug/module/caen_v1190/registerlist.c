@@ -0,0 +1,108 @@
+#include <stdlib.h>
+#include <module/reggen/registerlist.h>
+
+struct RegisterEntryClient const c_caen_v1190_register_list_client_[] = {
+	{0x00001000,  0, 16, "control"},
+	{0x00001002,  0, 16, "status"},
+	{0x00001004,  0, 16, "ader_32"},
+	{0x00001006,  0, 16, "ader_24"},
+	{0x00001008,  0, 16, "enable_ader"},
+	{0x0000100a,  0, 16, "interrupt_level"},
+	{0x0000100c,  0, 16, "interrupt_vector"},
+	{0x0000100e,  0, 16, "geo_address"},
+	{0x00001010,  0, 16, "mcst_base_address"},
+	{0x00001012,  0, 16, "mcst_control"},
+	{0x0000101c,  0, 32, "event_counter"},
+	{0x00001020,  0, 16, "event_stored"},
+	{0x00001022,  0, 16, "almost_full_level"},
+	{0x00001024,  0, 16, "blt_event_number"},
+	{0x00001026,  0, 16, "firmware_revision"},
+	{0x00001028,  0, 32, "testreg"},
+	{0x0000102c,  0, 16, "output_prog_control"},
+	{0x0000102e,  0, 16, "micro"},
+	{0x00001030,  0, 16, "micro_handshake"},
+	{0x00001032,  0, 16, "select_flash"},
+	{0x00001034,  0, 16, "flash_memory"},
+	{0x00001036,  0, 16, "sram_page"},
+	{0x0000103c,  0, 16, "event_fifo_stored"},
+	{0x0000103e,  0, 16, "event_fifo_status"},
+	{0x00001200,  0, 32, "dummy32"},
+	{0x00001204,  0, 16, "dummy16"},
+	{0x00004000,  0, 16, "rom_checksum"},
+	{0x00004004,  0, 16, "rom_checksum_length2"},
+	{0x00004008,  0, 16, "rom_checksum_length1"},
+	{0x0000400c,  0, 16, "rom_checksum_length0"},
+	{0x00004010,  0, 16, "rom_constant2"},
+	{0x00004014,  0, 16, "rom_constant1"},
+	{0x00004018,  0, 16, "rom_constant0"},
+	{0x0000401c,  0, 16, "rom_c_code"},
+	{0x00004020,  0, 16, "rom_r_code"},
+	{0x00004024,  0, 16, "rom_oui2"},
+	{0x00004028,  0, 16, "rom_oui1"},
+	{0x0000402c,  0, 16, "rom_oui0"},
+	{0x00004030,  0, 16, "rom_vers"},
+	{0x00004034,  0, 16, "rom_board2"},
+	{0x00004038,  0, 16, "rom_board1"},
+	{0x0000403c,  0, 16, "rom_board0"},
+	{0x00004040,  0, 16, "rom_revis3"},
+	{0x00004044,  0, 16, "rom_revis2"},
+	{0x00004048,  0, 16, "rom_revis1"},
+	{0x0000404c,  0, 16, "rom_revis0"},
+	{0x00004080,  0, 16, "rom_sernum1"},
+	{0x00004084,  0, 16, "rom_sernum0"},
+	{0x00008000,  0, 16, "compensation_sram"},
+	{0x00000000,  0,  0, NULL}
+};
+
+struct RegisterEntryServer const c_caen_v1190_register_list_server_[] = {
+	{0x00001000,  0, 16, 2},
+	{0x00001002,  0, 16, 2},
+	{0x00001004,  0, 16, 2},
+	{0x00001006,  0, 16, 2},
+	{0x00001008,  0, 16, 2},
+	{0x0000100a,  0, 16, 2},
+	{0x0000100c,  0, 16, 2},
+	{0x0000100e,  0, 16, 2},
+	{0x00001010,  0, 16, 2},
+	{0x00001012,  0, 16, 2},
+	{0x0000101c,  0, 32, 4},
+	{0x00001020,  0, 16, 2},
+	{0x00001022,  0, 16, 2},
+	{0x00001024,  0, 16, 2},
+	{0x00001026,  0, 16, 2},
+	{0x00001028,  0, 32, 4},
+	{0x0000102c,  0, 16, 2},
+	{0x0000102e,  0, 16, 2},
+	{0x00001030,  0, 16, 2},
+	{0x00001032,  0, 16, 2},
+	{0x00001034,  0, 16, 2},
+	{0x00001036,  0, 16, 2},
+	{0x0000103c,  0, 16, 2},
+	{0x0000103e,  0, 16, 2},
+	{0x00001200,  0, 32, 4},
+	{0x00001204,  0, 16, 2},
+	{0x00004000,  0, 16, 2},
+	{0x00004004,  0, 16, 2},
+	{0x00004008,  0, 16, 2},
+	{0x0000400c,  0, 16, 2},
+	{0x00004010,  0, 16, 2},
+	{0x00004014,  0, 16, 2},
+	{0x00004018,  0, 16, 2},
+	{0x0000401c,  0, 16, 2},
+	{0x00004020,  0, 16, 2},
+	{0x00004024,  0, 16, 2},
+	{0x00004028,  0, 16, 2},
+	{0x0000402c,  0, 16, 2},
+	{0x00004030,  0, 16, 2},
+	{0x00004034,  0, 16, 2},
+	{0x00004038,  0, 16, 2},
+	{0x0000403c,  0, 16, 2},
+	{0x00004040,  0, 16, 2},
+	{0x00004044,  0, 16, 2},
+	{0x00004048,  0, 16, 2},
+	{0x0000404c,  0, 16, 2},
+	{0x00004080,  0, 16, 2},
+	{0x00004084,  0, 16, 2},
+	{0x00008000,  0, 16, 2},
+	{0x00000000,  0,  0, 0}
+};
@@ -0,0 +1,370 @@
+#ifndef MODULE_CAEN_V1725_OFFSETS_H
+#define MODULE_CAEN_V1725_OFFSETS_H
+
+#define MOD_record_length 5
+#define BITS_record_length 32
+#define  LEN_record_length 0
+#define  OFS_record_length (0x1020 + 0 * 4)
+#define MOD_input_dynamic_range 5
+#define BITS_input_dynamic_range 32
+#define  LEN_input_dynamic_range 0
+#define  OFS_input_dynamic_range (0x1028 + 0 * 4)
+#define MOD_number_of_events_per_aggregate 5
+#define BITS_number_of_events_per_aggregate 32
+#define  LEN_number_of_events_per_aggregate 0
+#define  OFS_number_of_events_per_aggregate (0x1034 + 0 * 4)
+#define MOD_pre_trigger 5
+#define BITS_pre_trigger 32
+#define  LEN_pre_trigger 0
+#define  OFS_pre_trigger (0x1038 + 0 * 4)
+#define MOD_data_flush 4
+#define BITS_data_flush 32
+#define  LEN_data_flush 0
+#define  OFS_data_flush (0x103c + 0 * 4)
+#define MOD_channel_n_stop_acquisition 5
+#define BITS_channel_n_stop_acquisition 32
+#define  LEN_channel_n_stop_acquisition 0
+#define  OFS_channel_n_stop_acquisition (0x1040 + 0 * 4)
+#define MOD_rc_cr2_smoothing_factor 5
+#define BITS_rc_cr2_smoothing_factor 32
+#define  LEN_rc_cr2_smoothing_factor 0
+#define  OFS_rc_cr2_smoothing_factor (0x1054 + 0 * 4)
+#define MOD_input_rise_time 5
+#define BITS_input_rise_time 32
+#define  LEN_input_rise_time 0
+#define  OFS_input_rise_time (0x1058 + 0 * 4)
+#define MOD_trapezoid_rise_time 5
+#define BITS_trapezoid_rise_time 32
+#define  LEN_trapezoid_rise_time 0
+#define  OFS_trapezoid_rise_time (0x105c + 0 * 4)
+#define MOD_trapezoid_flat_top 5
+#define BITS_trapezoid_flat_top 32
+#define  LEN_trapezoid_flat_top 0
+#define  OFS_trapezoid_flat_top (0x1060 + 0 * 4)
+#define MOD_peaking_time 5
+#define BITS_peaking_time 32
+#define  LEN_peaking_time 0
+#define  OFS_peaking_time (0x1064 + 0 * 4)
+#define MOD_decay_time 5
+#define BITS_decay_time 32
+#define  LEN_decay_time 0
+#define  OFS_decay_time (0x1068 + 0 * 4)
+#define MOD_trigger_threshold 5
+#define BITS_trigger_threshold 32
+#define  LEN_trigger_threshold 0
+#define  OFS_trigger_threshold (0x106c + 0 * 4)
+#define MOD_rise_time_validation_window 5
+#define BITS_rise_time_validation_window 32
+#define  LEN_rise_time_validation_window 0
+#define  OFS_rise_time_validation_window (0x1070 + 0 * 4)
+#define MOD_trigger_hold_off_width 5
+#define BITS_trigger_hold_off_width 32
+#define  LEN_trigger_hold_off_width 0
+#define  OFS_trigger_hold_off_width (0x1074 + 0 * 4)
+#define MOD_peak_hold_off 5
+#define BITS_peak_hold_off 32
+#define  LEN_peak_hold_off 0
+#define  OFS_peak_hold_off (0x1078 + 0 * 4)
+#define MOD_dpp_algorithm_control 5
+#define BITS_dpp_algorithm_control 32
+#define  LEN_dpp_algorithm_control 0
+#define  OFS_dpp_algorithm_control (0x1080 + 0 * 4)
+#define MOD_shaped_trigger_width 5
+#define BITS_shaped_trigger_width 32
+#define  LEN_shaped_trigger_width 0
+#define  OFS_shaped_trigger_width (0x1084 + 0 * 4)
+#define MOD_channel_n_status 1
+#define BITS_channel_n_status 32
+#define  LEN_channel_n_status 0
+#define  OFS_channel_n_status (0x1088 + 0 * 4)
+#define MOD_amc_firmware_revision 1
+#define BITS_amc_firmware_revision 32
+#define  LEN_amc_firmware_revision 0
+#define  OFS_amc_firmware_revision (0x108c + 0 * 4)
+#define MOD_dc_offset 5
+#define BITS_dc_offset 32
+#define  LEN_dc_offset 0
+#define  OFS_dc_offset (0x1098 + 0 * 4)
+#define MOD_dpp_algorithm_control_2 5
+#define BITS_dpp_algorithm_control_2 32
+#define  LEN_dpp_algorithm_control_2 0
+#define  OFS_dpp_algorithm_control_2 (0x10a0 + 0 * 4)
+#define MOD_channel_n_adc_temperature 1
+#define BITS_channel_n_adc_temperature 32
+#define  LEN_channel_n_adc_temperature 0
+#define  OFS_channel_n_adc_temperature (0x10a8 + 0 * 4)
+#define MOD_individual_software_trigger 4
+#define BITS_individual_software_trigger 32
+#define  LEN_individual_software_trigger 0
+#define  OFS_individual_software_trigger (0x10c0 + 0 * 4)
+#define MOD_fine_gain 5
+#define BITS_fine_gain 32
+#define  LEN_fine_gain 0
+#define  OFS_fine_gain (0x10c4 + 0 * 4)
+#define MOD_veto_width 5
+#define BITS_veto_width 32
+#define  LEN_veto_width 0
+#define  OFS_veto_width (0x10d4 + 0 * 4)
+#define MOD_board_configuration 5
+#define BITS_board_configuration 32
+#define  LEN_board_configuration 0
+#define  OFS_board_configuration (0x8000 + 0 * 4)
+#define MOD_board_configuration_bit_set 5
+#define BITS_board_configuration_bit_set 32
+#define  LEN_board_configuration_bit_set 0
+#define  OFS_board_configuration_bit_set (0x8004 + 0 * 4)
+#define MOD_board_configuration_bit_clear 5
+#define BITS_board_configuration_bit_clear 32
+#define  LEN_board_configuration_bit_clear 0
+#define  OFS_board_configuration_bit_clear (0x8008 + 0 * 4)
+#define MOD_aggregate_organization 5
+#define BITS_aggregate_organization 32
+#define  LEN_aggregate_organization 0
+#define  OFS_aggregate_organization (0x800c + 0 * 4)
+#define MOD_channel_adc_calibration 4
+#define BITS_channel_adc_calibration 32
+#define  LEN_channel_adc_calibration 0
+#define  OFS_channel_adc_calibration (0x809c + 0 * 4)
+#define MOD_channels_shutdown 4
+#define BITS_channels_shutdown 32
+#define  LEN_channels_shutdown 0
+#define  OFS_channels_shutdown (0x80bc + 0 * 4)
+#define MOD_acquisition_control 5
+#define BITS_acquisition_control 32
+#define  LEN_acquisition_control 0
+#define  OFS_acquisition_control (0x8100 + 0 * 4)
+#define MOD_acquisition_status 1
+#define BITS_acquisition_status 32
+#define  LEN_acquisition_status 0
+#define  OFS_acquisition_status (0x8104 + 0 * 4)
+#define MOD_software_trigger 4
+#define BITS_software_trigger 32
+#define  LEN_software_trigger 0
+#define  OFS_software_trigger (0x8108 + 0 * 4)
+#define MOD_global_trigger_mask 5
+#define BITS_global_trigger_mask 32
+#define  LEN_global_trigger_mask 0
+#define  OFS_global_trigger_mask (0x810c + 0 * 4)
+#define MOD_front_panel_trg_out_gpo_enable_mask 5
+#define BITS_front_panel_trg_out_gpo_enable_mask 32
+#define  LEN_front_panel_trg_out_gpo_enable_mask 0
+#define  OFS_front_panel_trg_out_gpo_enable_mask (0x8110 + 0 * 4)
+#define MOD_lvds_i_o_data 5
+#define BITS_lvds_i_o_data 32
+#define  LEN_lvds_i_o_data 0
+#define  OFS_lvds_i_o_data (0x8118 + 0 * 4)
+#define MOD_front_panel_i_o_control 5
+#define BITS_front_panel_i_o_control 32
+#define  LEN_front_panel_i_o_control 0
+#define  OFS_front_panel_i_o_control (0x811c + 0 * 4)
+#define MOD_channel_enable_mask 5
+#define BITS_channel_enable_mask 32
+#define  LEN_channel_enable_mask 0
+#define  OFS_channel_enable_mask (0x8120 + 0 * 4)
+#define MOD_roc_fpga_firmware_revision 1
+#define BITS_roc_fpga_firmware_revision 32
+#define  LEN_roc_fpga_firmware_revision 0
+#define  OFS_roc_fpga_firmware_revision (0x8124 + 0 * 4)
+#define MOD_voltage_level_mode_configuration 5
+#define BITS_voltage_level_mode_configuration 32
+#define  LEN_voltage_level_mode_configuration 0
+#define  OFS_voltage_level_mode_configuration (0x8138 + 0 * 4)
+#define MOD_software_clock_sync 4
+#define BITS_software_clock_sync 32
+#define  LEN_software_clock_sync 0
+#define  OFS_software_clock_sync (0x813c + 0 * 4)
+#define MOD_board_info 1
+#define BITS_board_info 32
+#define  LEN_board_info 0
+#define  OFS_board_info (0x8140 + 0 * 4)
+#define MOD_analog_monitor_mode 5
+#define BITS_analog_monitor_mode 32
+#define  LEN_analog_monitor_mode 0
+#define  OFS_analog_monitor_mode (0x8144 + 0 * 4)
+#define MOD_event_size 1
+#define BITS_event_size 32
+#define  LEN_event_size 0
+#define  OFS_event_size (0x814c + 0 * 4)
+#define MOD_time_bomb_downcounter 1
+#define BITS_time_bomb_downcounter 32
+#define  LEN_time_bomb_downcounter 0
+#define  OFS_time_bomb_downcounter (0x8158 + 0 * 4)
+#define MOD_fan_speed_control 5
+#define BITS_fan_speed_control 32
+#define  LEN_fan_speed_control 0
+#define  OFS_fan_speed_control (0x8168 + 0 * 4)
+#define MOD_run_start_stop_delay 5
+#define BITS_run_start_stop_delay 32
+#define  LEN_run_start_stop_delay 0
+#define  OFS_run_start_stop_delay (0x8170 + 0 * 4)
+#define MOD_board_failure_status 1
+#define BITS_board_failure_status 32
+#define  LEN_board_failure_status 0
+#define  OFS_board_failure_status (0x8178 + 0 * 4)
+#define MOD_disable_external_trigger 5
+#define BITS_disable_external_trigger 32
+#define  LEN_disable_external_trigger 0
+#define  OFS_disable_external_trigger (0x817c + 0 * 4)
+#define MOD_trigger_validation_mask 5
+#define BITS_trigger_validation_mask 32
+#define  LEN_trigger_validation_mask 0
+#define  OFS_trigger_validation_mask (0x8180 + 0 * 4)
+#define MOD_front_panel_lvds_i_o_new_features 5
+#define BITS_front_panel_lvds_i_o_new_features 32
+#define  LEN_front_panel_lvds_i_o_new_features 0
+#define  OFS_front_panel_lvds_i_o_new_features (0x81a0 + 0 * 4)
+#define MOD_buffer_occupancy_gain 5
+#define BITS_buffer_occupancy_gain 32
+#define  LEN_buffer_occupancy_gain 0
+#define  OFS_buffer_occupancy_gain (0x81b4 + 0 * 4)
+#define MOD_extended_veto_delay 5
+#define BITS_extended_veto_delay 32
+#define  LEN_extended_veto_delay 0
+#define  OFS_extended_veto_delay (0x81c4 + 0 * 4)
+#define MOD_readout_control 5
+#define BITS_readout_control 32
+#define  LEN_readout_control 0
+#define  OFS_readout_control (0xef00 + 0 * 4)
+#define MOD_readout_status 1
+#define BITS_readout_status 32
+#define  LEN_readout_status 0
+#define  OFS_readout_status (0xef04 + 0 * 4)
+#define MOD_board_id 5
+#define BITS_board_id 32
+#define  LEN_board_id 0
+#define  OFS_board_id (0xef08 + 0 * 4)
+#define MOD_mcst_base_address_and_control 5
+#define BITS_mcst_base_address_and_control 32
+#define  LEN_mcst_base_address_and_control 0
+#define  OFS_mcst_base_address_and_control (0xef0c + 0 * 4)
+#define MOD_relocation_address 5
+#define BITS_relocation_address 32
+#define  LEN_relocation_address 0
+#define  OFS_relocation_address (0xef10 + 0 * 4)
+#define MOD_interrupt_status_id 5
+#define BITS_interrupt_status_id 32
+#define  LEN_interrupt_status_id 0
+#define  OFS_interrupt_status_id (0xef14 + 0 * 4)
+#define MOD_interrupt_event_number 5
+#define BITS_interrupt_event_number 32
+#define  LEN_interrupt_event_number 0
+#define  OFS_interrupt_event_number (0xef18 + 0 * 4)
+#define MOD_aggregate_number_per_blt 5
+#define BITS_aggregate_number_per_blt 32
+#define  LEN_aggregate_number_per_blt 0
+#define  OFS_aggregate_number_per_blt (0xef1c + 0 * 4)
+#define MOD_scratch 5
+#define BITS_scratch 32
+#define  LEN_scratch 0
+#define  OFS_scratch (0xef20 + 0 * 4)
+#define MOD_software_reset 4
+#define BITS_software_reset 32
+#define  LEN_software_reset 0
+#define  OFS_software_reset (0xef24 + 0 * 4)
+#define MOD_software_clear 4
+#define BITS_software_clear 32
+#define  LEN_software_clear 0
+#define  OFS_software_clear (0xef28 + 0 * 4)
+#define MOD_configuration_reload 4
+#define BITS_configuration_reload 32
+#define  LEN_configuration_reload 0
+#define  OFS_configuration_reload (0xef34 + 0 * 4)
+#define MOD_configuration_rom_checksum 1
+#define BITS_configuration_rom_checksum 32
+#define  LEN_configuration_rom_checksum 0
+#define  OFS_configuration_rom_checksum (0xf000 + 0 * 4)
+#define MOD_configuration_rom_checksum_length_byte_2 1
+#define BITS_configuration_rom_checksum_length_byte_2 32
+#define  LEN_configuration_rom_checksum_length_byte_2 0
+#define  OFS_configuration_rom_checksum_length_byte_2 (0xf004 + 0 * 4)
+#define MOD_configuration_rom_checksum_length_byte_1 1
+#define BITS_configuration_rom_checksum_length_byte_1 32
+#define  LEN_configuration_rom_checksum_length_byte_1 0
+#define  OFS_configuration_rom_checksum_length_byte_1 (0xf008 + 0 * 4)
+#define MOD_configuration_rom_checksum_length_byte_0 1
+#define BITS_configuration_rom_checksum_length_byte_0 32
+#define  LEN_configuration_rom_checksum_length_byte_0 0
+#define  OFS_configuration_rom_checksum_length_byte_0 (0xf00c + 0 * 4)
+#define MOD_configuration_rom_constant_byte_2 1
+#define BITS_configuration_rom_constant_byte_2 32
+#define  LEN_configuration_rom_constant_byte_2 0
+#define  OFS_configuration_rom_constant_byte_2 (0xf010 + 0 * 4)
+#define MOD_configuration_rom_constant_byte_1 1
+#define BITS_configuration_rom_constant_byte_1 32
+#define  LEN_configuration_rom_constant_byte_1 0
+#define  OFS_configuration_rom_constant_byte_1 (0xf014 + 0 * 4)
+#define MOD_configuration_rom_constant_byte_0 1
+#define BITS_configuration_rom_constant_byte_0 32
+#define  LEN_configuration_rom_constant_byte_0 0
+#define  OFS_configuration_rom_constant_byte_0 (0xf018 + 0 * 4)
+#define MOD_configuration_rom_c_code 1
+#define BITS_configuration_rom_c_code 32
+#define  LEN_configuration_rom_c_code 0
+#define  OFS_configuration_rom_c_code (0xf01c + 0 * 4)
+#define MOD_configuration_rom_r_code 1
+#define BITS_configuration_rom_r_code 32
+#define  LEN_configuration_rom_r_code 0
+#define  OFS_configuration_rom_r_code (0xf020 + 0 * 4)
+#define MOD_configuration_rom_ieee_oui_byte_2 1
+#define BITS_configuration_rom_ieee_oui_byte_2 32
+#define  LEN_configuration_rom_ieee_oui_byte_2 0
+#define  OFS_configuration_rom_ieee_oui_byte_2 (0xf024 + 0 * 4)
+#define MOD_configuration_rom_ieee_oui_byte_1 1
+#define BITS_configuration_rom_ieee_oui_byte_1 32
+#define  LEN_configuration_rom_ieee_oui_byte_1 0
+#define  OFS_configuration_rom_ieee_oui_byte_1 (0xf028 + 0 * 4)
+#define MOD_configuration_rom_ieee_oui_byte_0 1
+#define BITS_configuration_rom_ieee_oui_byte_0 32
+#define  LEN_configuration_rom_ieee_oui_byte_0 0
+#define  OFS_configuration_rom_ieee_oui_byte_0 (0xf02c + 0 * 4)
+#define MOD_configuration_rom_board_version 1
+#define BITS_configuration_rom_board_version 32
+#define  LEN_configuration_rom_board_version 0
+#define  OFS_configuration_rom_board_version (0xf030 + 0 * 4)
+#define MOD_configuration_rom_board_form_factor 1
+#define BITS_configuration_rom_board_form_factor 32
+#define  LEN_configuration_rom_board_form_factor 0
+#define  OFS_configuration_rom_board_form_factor (0xf034 + 0 * 4)
+#define MOD_configuration_rom_board_id_byte_1 1
+#define BITS_configuration_rom_board_id_byte_1 32
+#define  LEN_configuration_rom_board_id_byte_1 0
+#define  OFS_configuration_rom_board_id_byte_1 (0xf038 + 0 * 4)
+#define MOD_configuration_rom_board_id_byte_0 1
+#define BITS_configuration_rom_board_id_byte_0 32
+#define  LEN_configuration_rom_board_id_byte_0 0
+#define  OFS_configuration_rom_board_id_byte_0 (0xf03c + 0 * 4)
+#define MOD_configuration_rom_pcb_revision_byte_3 1
+#define BITS_configuration_rom_pcb_revision_byte_3 32
+#define  LEN_configuration_rom_pcb_revision_byte_3 0
+#define  OFS_configuration_rom_pcb_revision_byte_3 (0xf040 + 0 * 4)
+#define MOD_configuration_rom_pcb_revision_byte_2 1
+#define BITS_configuration_rom_pcb_revision_byte_2 32
+#define  LEN_configuration_rom_pcb_revision_byte_2 0
+#define  OFS_configuration_rom_pcb_revision_byte_2 (0xf044 + 0 * 4)
+#define MOD_configuration_rom_pcb_revision_byte_1 1
+#define BITS_configuration_rom_pcb_revision_byte_1 32
+#define  LEN_configuration_rom_pcb_revision_byte_1 0
+#define  OFS_configuration_rom_pcb_revision_byte_1 (0xf048 + 0 * 4)
+#define MOD_configuration_rom_pcb_revision_byte_0 1
+#define BITS_configuration_rom_pcb_revision_byte_0 32
+#define  LEN_configuration_rom_pcb_revision_byte_0 0
+#define  OFS_configuration_rom_pcb_revision_byte_0 (0xf04c + 0 * 4)
+#define MOD_configuration_rom_flash_type 1
+#define BITS_configuration_rom_flash_type 32
+#define  LEN_configuration_rom_flash_type 0
+#define  OFS_configuration_rom_flash_type (0xf050 + 0 * 4)
+#define MOD_configuration_rom_board_serial_number_byte_1 1
+#define BITS_configuration_rom_board_serial_number_byte_1 32
+#define  LEN_configuration_rom_board_serial_number_byte_1 0
+#define  OFS_configuration_rom_board_serial_number_byte_1 (0xf080 + 0 * 4)
+#define MOD_configuration_rom_board_serial_number_byte_0 1
+#define BITS_configuration_rom_board_serial_number_byte_0 32
+#define  LEN_configuration_rom_board_serial_number_byte_0 0
+#define  OFS_configuration_rom_board_serial_number_byte_0 (0xf084 + 0 * 4)
+#define MOD_configuration_rom_vcxo_type 1
+#define BITS_configuration_rom_vcxo_type 32
+#define  LEN_configuration_rom_vcxo_type 0
+#define  OFS_configuration_rom_vcxo_type (0xf088 + 0 * 4)
+#define MAP_SIZE 0xf08c
+
+#endif
@@ -0,0 +1,174 @@
+#include <stdlib.h>
+#include <module/reggen/registerlist.h>
+
+struct RegisterEntryClient const c_caen_v1725_register_list_client_[] = {
+	{0x00001020,  8, 32, "record_length"},
+	{0x00001028, 16, 32, "input_dynamic_range"},
+	{0x00001034,  8, 32, "number_of_events_per_aggregate"},
+	{0x00001038, 16, 32, "pre_trigger"},
+	{0x0000103c, 16, 32, "cfd_settings"},
+	{0x00001044, 16, 32, "charge_zero_suppression_threshold"},
+	{0x00001054, 16, 32, "short_gate_width"},
+	{0x00001058, 16, 32, "long_gate_width"},
+	{0x0000105c, 16, 32, "gate_offset"},
+	{0x00001060, 16, 32, "trigger_threshold"},
+	{0x00001064, 16, 32, "fixed_baseline"},
+	{0x0000106c, 16, 32, "trigger_latency"},
+	{0x00001070, 16, 32, "shaped_trigger_width"},
+	{0x00001074, 16, 32, "trigger_hold_off_width"},
+	{0x00001078, 16, 32, "threshold_for_the_psd_cut"},
+	{0x0000107c, 16, 32, "pur_gap_threshold"},
+	{0x00001080, 16, 32, "dpp_algorithm_control"},
+	{0x00001084,  8, 32, "dpp_algorithm_control_2"},
+	{0x00001088, 16, 32, "channel_n_status"},
+	{0x0000108c, 16, 32, "amc_firmware_revision"},
+	{0x00001098, 16, 32, "dc_offset"},
+	{0x000010a8, 16, 32, "channel_n_adc_temperature"},
+	{0x000010d4, 16, 32, "veto_width"},
+	{0x000010d8, 16, 32, "early_baseline_freeze"},
+	{0x00008000,  0, 32, "board_configuration"},
+	{0x00008004,  0, 32, "board_configuration_bit_set"},
+	{0x00008008,  0, 32, "board_configuration_bit_clear"},
+	{0x0000800c,  0, 32, "buffer_organization"},
+	{0x00008100,  0, 32, "acquisition_control"},
+	{0x00008104,  0, 32, "acquisition_status"},
+	{0x0000810c,  0, 32, "global_trigger_mask"},
+	{0x00008110,  0, 32, "front_panel_trg_out_gpo_enable_mask"},
+	{0x00008118,  0, 32, "lvds_i_o_data"},
+	{0x0000811c,  0, 32, "front_panel_i_o_control"},
+	{0x00008120,  0, 32, "channel_enable_mask"},
+	{0x00008124,  0, 32, "roc_fpga_firmware_revision"},
+	{0x00008138,  0, 32, "voltage_level_mode_configuration"},
+	{0x00008140,  0, 32, "board_info"},
+	{0x00008144,  0, 32, "analog_monitor_mode"},
+	{0x0000814c,  0, 32, "event_size"},
+	{0x00008158,  0, 32, "time_bomb_downcounter"},
+	{0x00008168,  0, 32, "fan_speed_control"},
+	{0x00008170,  0, 32, "run_start_stop_delay"},
+	{0x00008178,  0, 32, "board_failure_status"},
+	{0x0000817c,  0, 32, "disable_external_trigger"},
+	{0x00008180,  8, 32, "trigger_validation_mask"},
+	{0x000081a0,  0, 32, "front_panel_lvds_i_o_new_features"},
+	{0x000081b4,  0, 32, "buffer_occupancy_gain"},
+	{0x000081c4,  0, 32, "extended_veto_delay"},
+	{0x0000ef00,  0, 32, "readout_control"},
+	{0x0000ef04,  0, 32, "readout_status"},
+	{0x0000ef08,  0, 32, "board_id"},
+	{0x0000ef0c,  0, 32, "mcst_base_address_and_control"},
+	{0x0000ef10,  0, 32, "relocation_address"},
+	{0x0000ef14,  0, 32, "interrupt_status_id"},
+	{0x0000ef18,  0, 32, "interrupt_event_number"},
+	{0x0000ef1c,  0, 32, "aggregate_number_per_blt"},
+	{0x0000ef20,  0, 32, "scratch"},
+	{0x0000f000,  0, 32, "configuration_rom_checksum"},
+	{0x0000f004,  0, 32, "configuration_rom_checksum_length_byte_2"},
+	{0x0000f008,  0, 32, "configuration_rom_checksum_length_byte_1"},
+	{0x0000f00c,  0, 32, "configuration_rom_checksum_length_byte_0"},
+	{0x0000f010,  0, 32, "configuration_rom_constant_byte_2"},
+	{0x0000f014,  0, 32, "configuration_rom_constant_byte_1"},
+	{0x0000f018,  0, 32, "configuration_rom_constant_byte_0"},
+	{0x0000f01c,  0, 32, "configuration_rom_c_code"},
+	{0x0000f020,  0, 32, "configuration_rom_r_code"},
+	{0x0000f024,  0, 32, "configuration_rom_ieee_oui_byte_2"},
+	{0x0000f028,  0, 32, "configuration_rom_ieee_oui_byte_1"},
+	{0x0000f02c,  0, 32, "configuration_rom_ieee_oui_byte_0"},
+	{0x0000f030,  0, 32, "configuration_rom_board_version"},
+	{0x0000f034,  0, 32, "configuration_rom_board_form_factor"},
+	{0x0000f038,  0, 32, "configuration_rom_board_id_byte_1"},
+	{0x0000f03c,  0, 32, "configuration_rom_board_id_byte_0"},
+	{0x0000f040,  0, 32, "configuration_rom_pcb_revision_byte_3"},
+	{0x0000f044,  0, 32, "configuration_rom_pcb_revision_byte_2"},
+	{0x0000f048,  0, 32, "configuration_rom_pcb_revision_byte_1"},
+	{0x0000f04c,  0, 32, "configuration_rom_pcb_revision_byte_0"},
+	{0x0000f050,  0, 32, "configuration_rom_flash_type"},
+	{0x0000f080,  0, 32, "configuration_rom_board_serial_number_byte_1"},
+	{0x0000f084,  0, 32, "configuration_rom_board_serial_number_byte_0"},
+	{0x0000f088,  0, 32, "configuration_rom_vcxo_type"},
+	{0x00000000,  0,  0, NULL}
+};
+
+struct RegisterEntryServer const c_caen_v1725_register_list_server_[] = {
+	{0x00001020,  8, 32, 256},
+	{0x00001028, 16, 32, 256},
+	{0x00001034,  8, 32, 256},
+	{0x00001038, 16, 32, 256},
+	{0x0000103c, 16, 32, 256},
+	{0x00001044, 16, 32, 256},
+	{0x00001054, 16, 32, 256},
+	{0x00001058, 16, 32, 256},
+	{0x0000105c, 16, 32, 256},
+	{0x00001060, 16, 32, 256},
+	{0x00001064, 16, 32, 256},
+	{0x0000106c, 16, 32, 256},
+	{0x00001070, 16, 32, 256},
+	{0x00001074, 16, 32, 256},
+	{0x00001078, 16, 32, 256},
+	{0x0000107c, 16, 32, 256},
+	{0x00001080, 16, 32, 256},
+	{0x00001084,  8, 32, 256},
+	{0x00001088, 16, 32, 256},
+	{0x0000108c, 16, 32, 256},
+	{0x00001098, 16, 32, 256},
+	{0x000010a8, 16, 32, 256},
+	{0x000010d4, 16, 32, 256},
+	{0x000010d8, 16, 32, 256},
+	{0x00008000,  0, 32, 4},
+	{0x00008004,  0, 32, 4},
+	{0x00008008,  0, 32, 4},
+	{0x0000800c,  0, 32, 4},
+	{0x00008100,  0, 32, 4},
+	{0x00008104,  0, 32, 4},
+	{0x0000810c,  0, 32, 4},
+	{0x00008110,  0, 32, 4},
+	{0x00008118,  0, 32, 4},
+	{0x0000811c,  0, 32, 4},
+	{0x00008120,  0, 32, 4},
+	{0x00008124,  0, 32, 4},
+	{0x00008138,  0, 32, 4},
+	{0x00008140,  0, 32, 4},
+	{0x00008144,  0, 32, 4},
+	{0x0000814c,  0, 32, 4},
+	{0x00008158,  0, 32, 4},
+	{0x00008168,  0, 32, 4},
+	{0x00008170,  0, 32, 4},
+	{0x00008178,  0, 32, 4},
+	{0x0000817c,  0, 32, 4},
+	{0x00008180,  8, 32, 4},
+	{0x000081a0,  0, 32, 4},
+	{0x000081b4,  0, 32, 4},
+	{0x000081c4,  0, 32, 4},
+	{0x0000ef00,  0, 32, 4},
+	{0x0000ef04,  0, 32, 4},
+	{0x0000ef08,  0, 32, 4},
+	{0x0000ef0c,  0, 32, 4},
+	{0x0000ef10,  0, 32, 4},
+	{0x0000ef14,  0, 32, 4},
+	{0x0000ef18,  0, 32, 4},
+	{0x0000ef1c,  0, 32, 4},
+	{0x0000ef20,  0, 32, 4},
+	{0x0000f000,  0, 32, 4},
+	{0x0000f004,  0, 32, 4},
+	{0x0000f008,  0, 32, 4},
+	{0x0000f00c,  0, 32, 4},
+	{0x0000f010,  0, 32, 4},
+	{0x0000f014,  0, 32, 4},
+	{0x0000f018,  0, 32, 4},
+	{0x0000f01c,  0, 32, 4},
+	{0x0000f020,  0, 32, 4},
+	{0x0000f024,  0, 32, 4},
+	{0x0000f028,  0, 32, 4},
+	{0x0000f02c,  0, 32, 4},
+	{0x0000f030,  0, 32, 4},
+	{0x0000f034,  0, 32, 4},
+	{0x0000f038,  0, 32, 4},
+	{0x0000f03c,  0, 32, 4},
+	{0x0000f040,  0, 32, 4},
+	{0x0000f044,  0, 32, 4},
+	{0x0000f048,  0, 32, 4},
+	{0x0000f04c,  0, 32, 4},
+	{0x0000f050,  0, 32, 4},
+	{0x0000f080,  0, 32, 4},
+	{0x0000f084,  0, 32, 4},
+	{0x0000f088,  0, 32, 4},
+	{0x00000000,  0,  0, 0}
+};
@@ -0,0 +1,66 @@
+#ifndef MODULE_CAEN_V560_OFFSETS_H
+#define MODULE_CAEN_V560_OFFSETS_H
+
+#define MOD_interrupt_vector 5
+#define BITS_interrupt_vector 16
+#define  LEN_interrupt_vector 0
+#define  OFS_interrupt_vector (0x4 + 0 * 2)
+#define MOD_interrupt_level 5
+#define BITS_interrupt_level 16
+#define  LEN_interrupt_level 0
+#define  OFS_interrupt_level (0x6 + 0 * 2)
+#define MOD_enable_interrupt 5
+#define BITS_enable_interrupt 16
+#define  LEN_enable_interrupt 0
+#define  OFS_enable_interrupt (0x8 + 0 * 2)
+#define MOD_disable_interrupt 5
+#define BITS_disable_interrupt 16
+#define  LEN_disable_interrupt 0
+#define  OFS_disable_interrupt (0xa + 0 * 2)
+#define MOD_clear_interrupt 5
+#define BITS_clear_interrupt 16
+#define  LEN_clear_interrupt 0
+#define  OFS_clear_interrupt (0xc + 0 * 2)
+#define MOD_request 5
+#define BITS_request 16
+#define  LEN_request 0
+#define  OFS_request (0xe + 0 * 2)
+#define MOD_counter(i) 1
+#define BITS_counter(i) 32
+#define  LEN_counter(i) 16
+#define  OFS_counter(i) (0x10 + i * 4)
+#define MOD_scale_clear 5
+#define BITS_scale_clear 16
+#define  LEN_scale_clear 0
+#define  OFS_scale_clear (0x50 + 0 * 2)
+#define MOD_vme_veto_set 5
+#define BITS_vme_veto_set 16
+#define  LEN_vme_veto_set 0
+#define  OFS_vme_veto_set (0x52 + 0 * 2)
+#define MOD_vme_veto_reset 5
+#define BITS_vme_veto_reset 16
+#define  LEN_vme_veto_reset 0
+#define  OFS_vme_veto_reset (0x54 + 0 * 2)
+#define MOD_scale_increase 5
+#define BITS_scale_increase 16
+#define  LEN_scale_increase 0
+#define  OFS_scale_increase (0x56 + 0 * 2)
+#define MOD_scale_status 1
+#define BITS_scale_status 16
+#define  LEN_scale_status 0
+#define  OFS_scale_status (0x58 + 0 * 2)
+#define MOD_fixed_code 1
+#define BITS_fixed_code 16
+#define  LEN_fixed_code 0
+#define  OFS_fixed_code (0xfa + 0 * 2)
+#define MOD_manufacturer_module_type 1
+#define BITS_manufacturer_module_type 16
+#define  LEN_manufacturer_module_type 0
+#define  OFS_manufacturer_module_type (0xfc + 0 * 2)
+#define MOD_version_serial_number 1
+#define BITS_version_serial_number 16
+#define  LEN_version_serial_number 0
+#define  OFS_version_serial_number (0xfe + 0 * 2)
+#define MAP_SIZE 0x100
+
+#endif
@@ -0,0 +1,40 @@
+#include <stdlib.h>
+#include <module/reggen/registerlist.h>
+
+struct RegisterEntryClient const c_caen_v560_register_list_client_[] = {
+	{0x00000004,  0, 16, "interrupt_vector"},
+	{0x00000006,  0, 16, "interrupt_level"},
+	{0x00000008,  0, 16, "enable_interrupt"},
+	{0x0000000a,  0, 16, "disable_interrupt"},
+	{0x0000000c,  0, 16, "clear_interrupt"},
+	{0x0000000e,  0, 16, "request"},
+	{0x00000010, 16, 32, "counter"},
+	{0x00000050,  0, 16, "scale_clear"},
+	{0x00000052,  0, 16, "vme_veto_set"},
+	{0x00000054,  0, 16, "vme_veto_reset"},
+	{0x00000056,  0, 16, "scale_increase"},
+	{0x00000058,  0, 16, "scale_status"},
+	{0x000000fa,  0, 16, "fixed_code"},
+	{0x000000fc,  0, 16, "manufacturer_module_type"},
+	{0x000000fe,  0, 16, "version_serial_number"},
+	{0x00000000,  0,  0, NULL}
+};
+
+struct RegisterEntryServer const c_caen_v560_register_list_server_[] = {
+	{0x00000004,  0, 16, 2},
+	{0x00000006,  0, 16, 2},
+	{0x00000008,  0, 16, 2},
+	{0x0000000a,  0, 16, 2},
+	{0x0000000c,  0, 16, 2},
+	{0x0000000e,  0, 16, 2},
+	{0x00000010, 16, 32, 4},
+	{0x00000050,  0, 16, 2},
+	{0x00000052,  0, 16, 2},
+	{0x00000054,  0, 16, 2},
+	{0x00000056,  0, 16, 2},
+	{0x00000058,  0, 16, 2},
+	{0x000000fa,  0, 16, 2},
+	{0x000000fc,  0, 16, 2},
+	{0x000000fe,  0, 16, 2},
+	{0x00000000,  0,  0, 0}
+};
@@ -0,0 +1,82 @@
+#ifndef MODULE_CAEN_V767A_OFFSETS_H
+#define MODULE_CAEN_V767A_OFFSETS_H
+
+#define MOD_output_buffer 1
+#define BITS_output_buffer 32
+#define  LEN_output_buffer 0
+#define  OFS_output_buffer (0x0 + 0 * 4)
+#define MOD_geo_address 1
+#define BITS_geo_address 16
+#define  LEN_geo_address 0
+#define  OFS_geo_address (0x4 + 0 * 2)
+#define MOD_bit_set 5
+#define BITS_bit_set 16
+#define  LEN_bit_set 0
+#define  OFS_bit_set (0x6 + 0 * 2)
+#define MOD_bit_clear 5
+#define BITS_bit_clear 16
+#define  LEN_bit_clear 0
+#define  OFS_bit_clear (0x8 + 0 * 2)
+#define MOD_status 1
+#define BITS_status 16
+#define  LEN_status 0
+#define  OFS_status (0xe + 0 * 2)
+#define MOD_control 5
+#define BITS_control 16
+#define  LEN_control 0
+#define  OFS_control (0x10 + 0 * 2)
+#define MOD_single_shot_reset 4
+#define BITS_single_shot_reset 16
+#define  LEN_single_shot_reset 0
+#define  OFS_single_shot_reset (0x18 + 0 * 2)
+#define MOD_status_alt 1
+#define BITS_status_alt 16
+#define  LEN_status_alt 0
+#define  OFS_status_alt (0x48 + 0 * 2)
+#define MOD_control_alt 5
+#define BITS_control_alt 16
+#define  LEN_control_alt 0
+#define  OFS_control_alt (0x4a + 0 * 2)
+#define MOD_event_counter 1
+#define BITS_event_counter 16
+#define  LEN_event_counter 0
+#define  OFS_event_counter (0x4c + 0 * 2)
+#define MOD_clear_event_counter 4
+#define BITS_clear_event_counter 16
+#define  LEN_clear_event_counter 0
+#define  OFS_clear_event_counter (0x4e + 0 * 2)
+#define MOD_opcode_handshake 1
+#define BITS_opcode_handshake 16
+#define  LEN_opcode_handshake 0
+#define  OFS_opcode_handshake (0x50 + 0 * 2)
+#define MOD_opcode 5
+#define BITS_opcode 16
+#define  LEN_opcode 0
+#define  OFS_opcode (0x52 + 0 * 2)
+#define MOD_clear 4
+#define BITS_clear 16
+#define  LEN_clear 0
+#define  OFS_clear (0x54 + 0 * 2)
+#define MOD_testword_h 4
+#define BITS_testword_h 16
+#define  LEN_testword_h 0
+#define  OFS_testword_h (0x56 + 0 * 2)
+#define MOD_manufacturer_id 1
+#define BITS_manufacturer_id 16
+#define  LEN_manufacturer_id 0
+#define  OFS_manufacturer_id (0x1026 + 0 * 2)
+#define MOD_board_id 1
+#define BITS_board_id 16
+#define  LEN_board_id 0
+#define  OFS_board_id (0x1032 + 0 * 2)
+#define MOD_revision 1
+#define BITS_revision 16
+#define  LEN_revision 0
+#define  OFS_revision (0x104e + 0 * 2)
+#define MOD_serial_number 1
+#define BITS_serial_number 16
+#define  LEN_serial_number 0
+#define  OFS_serial_number (0x1f02 + 0 * 2)
+#define MAP_SIZE 0x1f04
+
+#endif
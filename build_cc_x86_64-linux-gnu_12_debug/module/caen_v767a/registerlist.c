@@ -0,0 +1,40 @@
+#include <stdlib.h>
+#include <module/reggen/registerlist.h>
+
+struct RegisterEntryClient const c_caen_v767a_register_list_client_[] = {
+	{0x00000000,  0, 32, "output_buffer"},
+	{0x00000004,  0, 16, "geo_address"},
+	{0x00000006,  0, 16, "bit_set"},
+	{0x00000008,  0, 16, "bit_clear"},
+	{0x0000000e,  0, 16, "status"},
+	{0x00000010,  0, 16, "control"},
+	{0x00000048,  0, 16, "status_alt"},
+	{0x0000004a,  0, 16, "control_alt"},
+	{0x0000004c,  0, 16, "event_counter"},
+	{0x00000050,  0, 16, "opcode_handshake"},
+	{0x00000052,  0, 16, "opcode"},
+	{0x00001026,  0, 16, "manufacturer_id"},
+	{0x00001032,  0, 16, "board_id"},
+	{0x0000104e,  0, 16, "revision"},
+	{0x00001f02,  0, 16, "serial_number"},
+	{0x00000000,  0,  0, NULL}
+};
+
+struct RegisterEntryServer const c_caen_v767a_register_list_server_[] = {
+	{0x00000000,  0, 32, 4},
+	{0x00000004,  0, 16, 2},
+	{0x00000006,  0, 16, 2},
+	{0x00000008,  0, 16, 2},
+	{0x0000000e,  0, 16, 2},
+	{0x00000010,  0, 16, 2},
+	{0x00000048,  0, 16, 2},
+	{0x0000004a,  0, 16, 2},
+	{0x0000004c,  0, 16, 2},
+	{0x00000050,  0, 16, 2},
+	{0x00000052,  0, 16, 2},
+	{0x00001026,  0, 16, 2},
+	{0x00001032,  0, 16, 2},
+	{0x0000104e,  0, 16, 2},
+	{0x00001f02,  0, 16, 2},
+	{0x00000000,  0,  0, 0}
+};
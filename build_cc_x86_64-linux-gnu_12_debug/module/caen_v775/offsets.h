@@ -0,0 +1,190 @@
+#ifndef MODULE_CAEN_V775_OFFSETS_H
+#define MODULE_CAEN_V775_OFFSETS_H
+
+#define MOD_output_buffer 2
+#define BITS_output_buffer 32
+#define  LEN_output_buffer 0
+#define  OFS_output_buffer (0x0 + 0 * 4)
+#define MOD_firmware_revision 1
+#define BITS_firmware_revision 16
+#define  LEN_firmware_revision 0
+#define  OFS_firmware_revision (0x1000 + 0 * 2)
+#define MOD_geo_address 5
+#define BITS_geo_address 16
+#define  LEN_geo_address 0
+#define  OFS_geo_address (0x1002 + 0 * 2)
+#define MOD_mcst_cblt_address 5
+#define BITS_mcst_cblt_address 16
+#define  LEN_mcst_cblt_address 0
+#define  OFS_mcst_cblt_address (0x1004 + 0 * 2)
+#define MOD_bit_set_1 5
+#define BITS_bit_set_1 16
+#define  LEN_bit_set_1 0
+#define  OFS_bit_set_1 (0x1006 + 0 * 2)
+#define MOD_bit_clear_1 5
+#define BITS_bit_clear_1 16
+#define  LEN_bit_clear_1 0
+#define  OFS_bit_clear_1 (0x1008 + 0 * 2)
+#define MOD_interrupt_level 5
+#define BITS_interrupt_level 16
+#define  LEN_interrupt_level 0
+#define  OFS_interrupt_level (0x100a + 0 * 2)
+#define MOD_interrupt_vector 5
+#define BITS_interrupt_vector 16
+#define  LEN_interrupt_vector 0
+#define  OFS_interrupt_vector (0x100c + 0 * 2)
+#define MOD_status_1 1
+#define BITS_status_1 16
+#define  LEN_status_1 0
+#define  OFS_status_1 (0x100e + 0 * 2)
+#define MOD_control_1 5
+#define BITS_control_1 16
+#define  LEN_control_1 0
+#define  OFS_control_1 (0x1010 + 0 * 2)
+#define MOD_ader_high 5
+#define BITS_ader_high 16
+#define  LEN_ader_high 0
+#define  OFS_ader_high (0x1012 + 0 * 2)
+#define MOD_ader_low 5
+#define BITS_ader_low 16
+#define  LEN_ader_low 0
+#define  OFS_ader_low (0x1014 + 0 * 2)
+#define MOD_single_shot_reset 4
+#define BITS_single_shot_reset 16
+#define  LEN_single_shot_reset 0
+#define  OFS_single_shot_reset (0x1016 + 0 * 2)
+#define MOD_mcst_cblt_ctrl 5
+#define BITS_mcst_cblt_ctrl 16
+#define  LEN_mcst_cblt_ctrl 0
+#define  OFS_mcst_cblt_ctrl (0x101a + 0 * 2)
+#define MOD_event_trigger 5
+#define BITS_event_trigger 16
+#define  LEN_event_trigger 0
+#define  OFS_event_trigger (0x1020 + 0 * 2)
+#define MOD_status_2 1
+#define BITS_status_2 16
+#define  LEN_status_2 0
+#define  OFS_status_2 (0x1022 + 0 * 2)
+#define MOD_event_counter_l 1
+#define BITS_event_counter_l 16
+#define  LEN_event_counter_l 0
+#define  OFS_event_counter_l (0x1024 + 0 * 2)
+#define MOD_event_counter_h 1
+#define BITS_event_counter_h 16
+#define  LEN_event_counter_h 0
+#define  OFS_event_counter_h (0x1026 + 0 * 2)
+#define MOD_increment_event 4
+#define BITS_increment_event 16
+#define  LEN_increment_event 0
+#define  OFS_increment_event (0x1028 + 0 * 2)
+#define MOD_increment_offset 4
+#define BITS_increment_offset 16
+#define  LEN_increment_offset 0
+#define  OFS_increment_offset (0x102a + 0 * 2)
+#define MOD_fclr_window 5
+#define BITS_fclr_window 16
+#define  LEN_fclr_window 0
+#define  OFS_fclr_window (0x102e + 0 * 2)
+#define MOD_bit_set_2 5
+#define BITS_bit_set_2 16
+#define  LEN_bit_set_2 0
+#define  OFS_bit_set_2 (0x1032 + 0 * 2)
+#define MOD_bit_clear_2 4
+#define BITS_bit_clear_2 16
+#define  LEN_bit_clear_2 0
+#define  OFS_bit_clear_2 (0x1034 + 0 * 2)
+#define MOD_w_memory_test_address 4
+#define BITS_w_memory_test_address 16
+#define  LEN_w_memory_test_address 0
+#define  OFS_w_memory_test_address (0x1036 + 0 * 2)
+#define MOD_memory_test_word_high 4
+#define BITS_memory_test_word_high 16
+#define  LEN_memory_test_word_high 0
+#define  OFS_memory_test_word_high (0x1038 + 0 * 2)
+#define MOD_memory_test_word_low 4
+#define BITS_memory_test_word_low 16
+#define  LEN_memory_test_word_low 0
+#define  OFS_memory_test_word_low (0x103a + 0 * 2)
+#define MOD_crate_select 5
+#define BITS_crate_select 16
+#define  LEN_crate_select 0
+#define  OFS_crate_select (0x103c + 0 * 2)
+#define MOD_test_event_write 4
+#define BITS_test_event_write 16
+#define  LEN_test_event_write 0
+#define  OFS_test_event_write (0x103e + 0 * 2)
+#define MOD_event_counter_reset 4
+#define BITS_event_counter_reset 16
+#define  LEN_event_counter_reset 0
+#define  OFS_event_counter_reset (0x1040 + 0 * 2)
+#define MOD_full_scale_range 5
+#define BITS_full_scale_range 16
+#define  LEN_full_scale_range 0
+#define  OFS_full_scale_range (0x1060 + 0 * 2)
+#define MOD_r_test_address 4
+#define BITS_r_test_address 16
+#define  LEN_r_test_address 0
+#define  OFS_r_test_address (0x1064 + 0 * 2)
+#define MOD_sw_comm 4
+#define BITS_sw_comm 16
+#define  LEN_sw_comm 0
+#define  OFS_sw_comm (0x1068 + 0 * 2)
+#define MOD_slide_constant 5
+#define BITS_slide_constant 16
+#define  LEN_slide_constant 0
+#define  OFS_slide_constant (0x106a + 0 * 2)
+#define MOD_aad 1
+#define BITS_aad 16
+#define  LEN_aad 0
+#define  OFS_aad (0x1070 + 0 * 2)
+#define MOD_bad 1
+#define BITS_bad 16
+#define  LEN_bad 0
+#define  OFS_bad (0x1072 + 0 * 2)
+#define MOD_thresholds(i) 5
+#define BITS_thresholds(i) 16
+#define  LEN_thresholds(i) 32
+#define  OFS_thresholds(i) (0x1080 + i * 2)
+#define MOD_oui_msb 1
+#define BITS_oui_msb 16
+#define  LEN_oui_msb 0
+#define  OFS_oui_msb (0x8026 + 0 * 2)
+#define MOD_oui 1
+#define BITS_oui 16
+#define  LEN_oui 0
+#define  OFS_oui (0x802a + 0 * 2)
+#define MOD_oui_lsb 1
+#define BITS_oui_lsb 16
+#define  LEN_oui_lsb 0
+#define  OFS_oui_lsb (0x802e + 0 * 2)
+#define MOD_version 1
+#define BITS_version 16
+#define  LEN_version 0
+#define  OFS_version (0x8032 + 0 * 2)
+#define MOD_board_id_msb 1
+#define BITS_board_id_msb 16
+#define  LEN_board_id_msb 0
+#define  OFS_board_id_msb (0x8036 + 0 * 2)
+#define MOD_board_id 1
+#define BITS_board_id 16
+#define  LEN_board_id 0
+#define  OFS_board_id (0x803a + 0 * 2)
+#define MOD_board_id_lsb 1
+#define BITS_board_id_lsb 16
+#define  LEN_board_id_lsb 0
+#define  OFS_board_id_lsb (0x803e + 0 * 2)
+#define MOD_revision 1
+#define BITS_revision 16
+#define  LEN_revision 0
+#define  OFS_revision (0x804e + 0 * 2)
+#define MOD_serial_msb 1
+#define BITS_serial_msb 16
+#define  LEN_serial_msb 0
+#define  OFS_serial_msb (0x8f02 + 0 * 2)
+#define MOD_serial_lsb 1
+#define BITS_serial_lsb 16
+#define  LEN_serial_lsb 0
+#define  OFS_serial_lsb (0x8f06 + 0 * 2)
+#define MAP_SIZE 0x8f08
+
+#endif
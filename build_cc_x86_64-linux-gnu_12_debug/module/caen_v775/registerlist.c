@@ -0,0 +1,78 @@
+#include <stdlib.h>
+#include <module/reggen/registerlist.h>
+
+struct RegisterEntryClient const c_caen_v775_register_list_client_[] = {
+	{0x00001000,  0, 16, "firmware_revision"},
+	{0x00001002,  0, 16, "geo_address"},
+	{0x00001004,  0, 16, "mcst_cblt_address"},
+	{0x00001006,  0, 16, "bit_set_1"},
+	{0x00001008,  0, 16, "bit_clear_1"},
+	{0x0000100a,  0, 16, "interrupt_level"},
+	{0x0000100c,  0, 16, "interrupt_vector"},
+	{0x0000100e,  0, 16, "status_1"},
+	{0x00001010,  0, 16, "control_1"},
+	{0x00001012,  0, 16, "ader_high"},
+	{0x00001014,  0, 16, "ader_low"},
+	{0x0000101a,  0, 16, "mcst_cblt_ctrl"},
+	{0x00001020,  0, 16, "event_trigger"},
+	{0x00001022,  0, 16, "status_2"},
+	{0x00001024,  0, 16, "event_counter_l"},
+	{0x00001026,  0, 16, "event_counter_h"},
+	{0x0000102e,  0, 16, "fclr_window"},
+	{0x00001032,  0, 16, "bit_set_2"},
+	{0x0000103c,  0, 16, "crate_select"},
+	{0x00001060,  0, 16, "full_scale_range"},
+	{0x0000106a,  0, 16, "slide_constant"},
+	{0x00001070,  0, 16, "aad"},
+	{0x00001072,  0, 16, "bad"},
+	{0x00001080, 32, 16, "thresholds"},
+	{0x00008026,  0, 16, "oui_msb"},
+	{0x0000802a,  0, 16, "oui"},
+	{0x0000802e,  0, 16, "oui_lsb"},
+	{0x00008032,  0, 16, "version"},
+	{0x00008036,  0, 16, "board_id_msb"},
+	{0x0000803a,  0, 16, "board_id"},
+	{0x0000803e,  0, 16, "board_id_lsb"},
+	{0x0000804e,  0, 16, "revision"},
+	{0x00008f02,  0, 16, "serial_msb"},
+	{0x00008f06,  0, 16, "serial_lsb"},
+	{0x00000000,  0,  0, NULL}
+};
+
+struct RegisterEntryServer const c_caen_v775_register_list_server_[] = {
+	{0x00001000,  0, 16, 2},
+	{0x00001002,  0, 16, 2},
+	{0x00001004,  0, 16, 2},
+	{0x00001006,  0, 16, 2},
+	{0x00001008,  0, 16, 2},
+	{0x0000100a,  0, 16, 2},
+	{0x0000100c,  0, 16, 2},
+	{0x0000100e,  0, 16, 2},
+	{0x00001010,  0, 16, 2},
+	{0x00001012,  0, 16, 2},
+	{0x00001014,  0, 16, 2},
+	{0x0000101a,  0, 16, 2},
+	{0x00001020,  0, 16, 2},
+	{0x00001022,  0, 16, 2},
+	{0x00001024,  0, 16, 2},
+	{0x00001026,  0, 16, 2},
+	{0x0000102e,  0, 16, 2},
+	{0x00001032,  0, 16, 2},
+	{0x0000103c,  0, 16, 2},
+	{0x00001060,  0, 16, 2},
+	{0x0000106a,  0, 16, 2},
+	{0x00001070,  0, 16, 2},
+	{0x00001072,  0, 16, 2},
+	{0x00001080, 32, 16, 2},
+	{0x00008026,  0, 16, 2},
+	{0x0000802a,  0, 16, 2},
+	{0x0000802e,  0, 16, 2},
+	{0x00008032,  0, 16, 2},
+	{0x00008036,  0, 16, 2},
+	{0x0000803a,  0, 16, 2},
+	{0x0000803e,  0, 16, 2},
+	{0x0000804e,  0, 16, 2},
+	{0x00008f02,  0, 16, 2},
+	{0x00008f06,  0, 16, 2},
+	{0x00000000,  0,  0, 0}
+};
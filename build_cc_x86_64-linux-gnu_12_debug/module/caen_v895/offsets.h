@@ -0,0 +1,42 @@
+#ifndef MODULE_CAEN_V895_OFFSETS_H
+#define MODULE_CAEN_V895_OFFSETS_H
+
+#define MOD_threshold(i) 4
+#define BITS_threshold(i) 16
+#define  LEN_threshold(i) 16
+#define  OFS_threshold(i) (0x0 + i * 2)
+#define MOD_output_width_0_to_7 4
+#define BITS_output_width_0_to_7 16
+#define  LEN_output_width_0_to_7 0
+#define  OFS_output_width_0_to_7 (0x40 + 0 * 2)
+#define MOD_output_width_8_to_15 4
+#define BITS_output_width_8_to_15 16
+#define  LEN_output_width_8_to_15 0
+#define  OFS_output_width_8_to_15 (0x42 + 0 * 2)
+#define MOD_majority_threshold 4
+#define BITS_majority_threshold 16
+#define  LEN_majority_threshold 0
+#define  OFS_majority_threshold (0x48 + 0 * 2)
+#define MOD_pattern_inhibit 4
+#define BITS_pattern_inhibit 16
+#define  LEN_pattern_inhibit 0
+#define  OFS_pattern_inhibit (0x4a + 0 * 2)
+#define MOD_test_pulse 4
+#define BITS_test_pulse 16
+#define  LEN_test_pulse 0
+#define  OFS_test_pulse (0x4c + 0 * 2)
+#define MOD_fixed_code 1
+#define BITS_fixed_code 16
+#define  LEN_fixed_code 0
+#define  OFS_fixed_code (0xfa + 0 * 2)
+#define MOD_manufacturer_module_type 1
+#define BITS_manufacturer_module_type 16
+#define  LEN_manufacturer_module_type 0
+#define  OFS_manufacturer_module_type (0xfc + 0 * 2)
+#define MOD_version_serial_number 1
+#define BITS_version_serial_number 16
+#define  LEN_version_serial_number 0
+#define  OFS_version_serial_number (0xfe + 0 * 2)
+#define MAP_SIZE 0x100
+
+#endif
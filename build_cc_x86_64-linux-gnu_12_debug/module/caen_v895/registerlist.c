@@ -0,0 +1,16 @@
+#include <stdlib.h>
+#include <module/reggen/registerlist.h>
+
+struct RegisterEntryClient const c_caen_v895_register_list_client_[] = {
+	{0x000000fa,  0, 16, "fixed_code"},
+	{0x000000fc,  0, 16, "manufacturer_module_type"},
+	{0x000000fe,  0, 16, "version_serial_number"},
+	{0x00000000,  0,  0, NULL}
+};
+
+struct RegisterEntryServer const c_caen_v895_register_list_server_[] = {
+	{0x000000fa,  0, 16, 2},
+	{0x000000fc,  0, 16, 2},
+	{0x000000fe,  0, 16, 2},
+	{0x00000000,  0,  0, 0}
+};
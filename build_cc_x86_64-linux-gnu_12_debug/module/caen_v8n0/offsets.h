@@ -0,0 +1,150 @@
+#ifndef MODULE_CAEN_V8N0_OFFSETS_H
+#define MODULE_CAEN_V8N0_OFFSETS_H
+
+#define MOD_counter(i) 1
+#define BITS_counter(i) 32
+#define  LEN_counter(i) 32
+#define  OFS_counter(i) (0x1000 + i * 4)
+#define MOD_testlcntl 5
+#define BITS_testlcntl 16
+#define  LEN_testlcntl 0
+#define  OFS_testlcntl (0x1090 + 0 * 2)
+#define MOD_testlcnth 5
+#define BITS_testlcnth 16
+#define  LEN_testlcnth 0
+#define  OFS_testlcnth (0x1094 + 0 * 2)
+#define MOD_testhcntl 5
+#define BITS_testhcntl 16
+#define  LEN_testhcntl 0
+#define  OFS_testhcntl (0x10a0 + 0 * 2)
+#define MOD_testhcnth 5
+#define BITS_testhcnth 16
+#define  LEN_testhcnth 0
+#define  OFS_testhcnth (0x10a4 + 0 * 2)
+#define MOD_dwell_time 5
+#define BITS_dwell_time 32
+#define  LEN_dwell_time 0
+#define  OFS_dwell_time (0x1104 + 0 * 4)
+#define MOD_control 5
+#define BITS_control 16
+#define  LEN_control 0
+#define  OFS_control (0x1108 + 0 * 2)
+#define MOD_bit_set 4
+#define BITS_bit_set 16
+#define  LEN_bit_set 0
+#define  OFS_bit_set (0x110a + 0 * 2)
+#define MOD_bit_clear 4
+#define BITS_bit_clear 16
+#define  LEN_bit_clear 0
+#define  OFS_bit_clear (0x110c + 0 * 2)
+#define MOD_status 5
+#define BITS_status 16
+#define  LEN_status 0
+#define  OFS_status (0x110e + 0 * 2)
+#define MOD_geo 5
+#define BITS_geo 16
+#define  LEN_geo 0
+#define  OFS_geo (0x1110 + 0 * 2)
+#define MOD_interrupt_level 5
+#define BITS_interrupt_level 16
+#define  LEN_interrupt_level 0
+#define  OFS_interrupt_level (0x1112 + 0 * 2)
+#define MOD_interrupt_vector 5
+#define BITS_interrupt_vector 16
+#define  LEN_interrupt_vector 0
+#define  OFS_interrupt_vector (0x1114 + 0 * 2)
+#define MOD_ader_32 5
+#define BITS_ader_32 16
+#define  LEN_ader_32 0
+#define  OFS_ader_32 (0x1116 + 0 * 2)
+#define MOD_ader_24 5
+#define BITS_ader_24 16
+#define  LEN_ader_24 0
+#define  OFS_ader_24 (0x1118 + 0 * 2)
+#define MOD_enable_ader 5
+#define BITS_enable_ader 16
+#define  LEN_enable_ader 0
+#define  OFS_enable_ader (0x111a + 0 * 2)
+#define MOD_mcst_base_address 5
+#define BITS_mcst_base_address 16
+#define  LEN_mcst_base_address 0
+#define  OFS_mcst_base_address (0x111c + 0 * 2)
+#define MOD_mcst_control 5
+#define BITS_mcst_control 16
+#define  LEN_mcst_control 0
+#define  OFS_mcst_control (0x111e + 0 * 2)
+#define MOD_module_reset 5
+#define BITS_module_reset 16
+#define  LEN_module_reset 0
+#define  OFS_module_reset (0x1120 + 0 * 2)
+#define MOD_software_clear 4
+#define BITS_software_clear 16
+#define  LEN_software_clear 0
+#define  OFS_software_clear (0x1122 + 0 * 2)
+#define MOD_software_trigger 4
+#define BITS_software_trigger 16
+#define  LEN_software_trigger 0
+#define  OFS_software_trigger (0x1124 + 0 * 2)
+#define MOD_blt_event_number 5
+#define BITS_blt_event_number 16
+#define  LEN_blt_event_number 0
+#define  OFS_blt_event_number (0x1130 + 0 * 2)
+#define MOD_firmware 1
+#define BITS_firmware 16
+#define  LEN_firmware 0
+#define  OFS_firmware (0x1132 + 0 * 2)
+#define MOD_dummy32 5
+#define BITS_dummy32 32
+#define  LEN_dummy32 0
+#define  OFS_dummy32 (0x1200 + 0 * 4)
+#define MOD_dummy16 5
+#define BITS_dummy16 16
+#define  LEN_dummy16 0
+#define  OFS_dummy16 (0x1204 + 0 * 2)
+#define MOD_configuration_rom 1
+#define BITS_configuration_rom 16
+#define  LEN_configuration_rom 0
+#define  OFS_configuration_rom (0x4000 + 0 * 2)
+#define MOD_oui_msb 1
+#define BITS_oui_msb 16
+#define  LEN_oui_msb 0
+#define  OFS_oui_msb (0x4026 + 0 * 2)
+#define MOD_oui 1
+#define BITS_oui 16
+#define  LEN_oui 0
+#define  OFS_oui (0x402a + 0 * 2)
+#define MOD_oui_lsb 1
+#define BITS_oui_lsb 16
+#define  LEN_oui_lsb 0
+#define  OFS_oui_lsb (0x402e + 0 * 2)
+#define MOD_version 1
+#define BITS_version 16
+#define  LEN_version 0
+#define  OFS_version (0x4032 + 0 * 2)
+#define MOD_board_id_msb 1
+#define BITS_board_id_msb 16
+#define  LEN_board_id_msb 0
+#define  OFS_board_id_msb (0x4036 + 0 * 2)
+#define MOD_board_id 1
+#define BITS_board_id 16
+#define  LEN_board_id 0
+#define  OFS_board_id (0x403a + 0 * 2)
+#define MOD_board_id_lsb 1
+#define BITS_board_id_lsb 16
+#define  LEN_board_id_lsb 0
+#define  OFS_board_id_lsb (0x403e + 0 * 2)
+#define MOD_revision 1
+#define BITS_revision 16
+#define  LEN_revision 0
+#define  OFS_revision (0x404e + 0 * 2)
+#define MOD_serial_msb 1
+#define BITS_serial_msb 16
+#define  LEN_serial_msb 0
+#define  OFS_serial_msb (0x4f02 + 0 * 2)
+#define MOD_serial_lsb 1
+#define BITS_serial_lsb 16
+#define  LEN_serial_lsb 0
+#define  OFS_serial_lsb (0x4f06 + 0 * 2)
+#define MAP_SIZE 0x4f08
+
+#endif
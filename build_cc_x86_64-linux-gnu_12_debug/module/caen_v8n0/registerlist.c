@@ -0,0 +1,74 @@
+#include <stdlib.h>
+#include <module/reggen/registerlist.h>
+
+struct RegisterEntryClient const c_caen_v8n0_register_list_client_[] = {
+	{0x00001000, 32, 32, "counter"},
+	{0x00001090,  0, 16, "testlcntl"},
+	{0x00001094,  0, 16, "testlcnth"},
+	{0x000010a0,  0, 16, "testhcntl"},
+	{0x000010a4,  0, 16, "testhcnth"},
+	{0x00001104,  0, 32, "dwell_time"},
+	{0x00001108,  0, 16, "control"},
+	{0x0000110e,  0, 16, "status"},
+	{0x00001110,  0, 16, "geo"},
+	{0x00001112,  0, 16, "interrupt_level"},
+	{0x00001114,  0, 16, "interrupt_vector"},
+	{0x00001116,  0, 16, "ader_32"},
+	{0x00001118,  0, 16, "ader_24"},
+	{0x0000111a,  0, 16, "enable_ader"},
+	{0x0000111c,  0, 16, "mcst_base_address"},
+	{0x0000111e,  0, 16, "mcst_control"},
+	{0x00001120,  0, 16, "module_reset"},
+	{0x00001130,  0, 16, "blt_event_number"},
+	{0x00001132,  0, 16, "firmware"},
+	{0x00001200,  0, 32, "dummy32"},
+	{0x00001204,  0, 16, "dummy16"},
+	{0x00004000,  0, 16, "configuration_rom"},
+	{0x00004026,  0, 16, "oui_msb"},
+	{0x0000402a,  0, 16, "oui"},
+	{0x0000402e,  0, 16, "oui_lsb"},
+	{0x00004032,  0, 16, "version"},
+	{0x00004036,  0, 16, "board_id_msb"},
+	{0x0000403a,  0, 16, "board_id"},
+	{0x0000403e,  0, 16, "board_id_lsb"},
+	{0x0000404e,  0, 16, "revision"},
+	{0x00004f02,  0, 16, "serial_msb"},
+	{0x00004f06,  0, 16, "serial_lsb"},
+	{0x00000000,  0,  0, NULL}
+};
+
+struct RegisterEntryServer const c_caen_v8n0_register_list_server_[] = {
+	{0x00001000, 32, 32, 4},
+	{0x00001090,  0, 16, 2},
+	{0x00001094,  0, 16, 2},
+	{0x000010a0,  0, 16, 2},
+	{0x000010a4,  0, 16, 2},
+	{0x00001104,  0, 32, 4},
+	{0x00001108,  0, 16, 2},
+	{0x0000110e,  0, 16, 2},
+	{0x00001110,  0, 16, 2},
+	{0x00001112,  0, 16, 2},
+	{0x00001114,  0, 16, 2},
+	{0x00001116,  0, 16, 2},
+	{0x00001118,  0, 16, 2},
+	{0x0000111a,  0, 16, 2},
+	{0x0000111c,  0, 16, 2},
+	{0x0000111e,  0, 16, 2},
+	{0x00001120,  0, 16, 2},
+	{0x00001130,  0, 16, 2},
+	{0x00001132,  0, 16, 2},
+	{0x00001200,  0, 32, 4},
+	{0x00001204,  0, 16, 2},
+	{0x00004000,  0, 16, 2},
+	{0x00004026,  0, 16, 2},
+	{0x0000402a,  0, 16, 2},
+	{0x0000402e,  0, 16, 2},
+	{0x00004032,  0, 16, 2},
+	{0x00004036,  0, 16, 2},
+	{0x0000403a,  0, 16, 2},
+	{0x0000403e,  0, 16, 2},
+	{0x0000404e,  0, 16, 2},
+	{0x00004f02,  0, 16, 2},
+	{0x00004f06,  0, 16, 2},
+	{0x00000000,  0,  0, 0}
+};
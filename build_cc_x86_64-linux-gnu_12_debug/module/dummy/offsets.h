@@ -0,0 +1,34 @@
+#ifndef MODULE_DUMMY_OFFSETS_H
+#define MODULE_DUMMY_OFFSETS_H
+
+#define MOD_buffer(i) 6
+#define BITS_buffer(i) 16
+#define  LEN_buffer(i) 8192
+#define  OFS_buffer(i) (0x0 + i * 2)
+#define MOD_clear 4
+#define BITS_clear 32
+#define  LEN_clear 0
+#define  OFS_clear (0x4000 + 0 * 4)
+#define MOD_multi_event 5
+#define BITS_multi_event 32
+#define  LEN_multi_event 0
+#define  OFS_multi_event (0x4004 + 0 * 4)
+#define MOD_counter 5
+#define BITS_counter 32
+#define  LEN_counter 0
+#define  OFS_counter (0x4008 + 0 * 4)
+#define MOD_read_only 1
+#define BITS_read_only 32
+#define  LEN_read_only 0
+#define  OFS_read_only (0x4010 + 0 * 4)
+#define MOD_write_only 4
+#define BITS_write_only 16
+#define  LEN_write_only 0
+#define  OFS_write_only (0x4014 + 0 * 2)
+#define MOD_threshold(i) 5
+#define BITS_threshold(i) 32
+#define  LEN_threshold(i) 32
+#define  OFS_threshold(i) (0x4100 + i * 4)
+#define MAP_SIZE 0x4180
+
+#endif
@@ -0,0 +1,18 @@
+#include <stdlib.h>
+#include <module/reggen/registerlist.h>
+
+struct RegisterEntryClient const c_dummy_register_list_client_[] = {
+	{0x00004004,  0, 32, "multi_event"},
+	{0x00004008,  0, 32, "counter"},
+	{0x00004010,  0, 32, "read_only"},
+	{0x00004100, 32, 32, "threshold"},
+	{0x00000000,  0,  0, NULL}
+};
+
+struct RegisterEntryServer const c_dummy_register_list_server_[] = {
+	{0x00004004,  0, 32, 4},
+	{0x00004008,  0, 32, 4},
+	{0x00004010,  0, 32, 4},
+	{0x00004100, 32, 32, 4},
+	{0x00000000,  0,  0, 0}
+};
@@ -0,0 +1,221 @@
+#include <module/genlist.h>
+#include <module/caen_v1190/caen_v1190.h>
+#include <module/caen_v1290/caen_v1290.h>
+#include <module/caen_v767a/caen_v767a.h>
+#include <module/caen_v775/caen_v775.h>
+#include <module/caen_v785/caen_v785.h>
+#include <module/caen_v785n/caen_v785n.h>
+#include <module/caen_v792/caen_v792.h>
+#include <module/caen_v965/caen_v965.h>
+#include <module/caen_v560/caen_v560.h>
+#include <module/caen_v820/caen_v820.h>
+#include <module/caen_v830/caen_v830.h>
+#include <module/caen_v895/caen_v895.h>
+#include <module/caen_v1725/caen_v1725.h>
+#include <module/dummy/dummy.h>
+#include <module/gsi_ctdc/gsi_ctdc.h>
+#include <module/gsi_febex/gsi_febex.h>
+#include <module/gsi_kilom/gsi_kilom.h>
+#include <module/gsi_mppc_rob/gsi_mppc_rob.h>
+#include <module/gsi_pexaria/gsi_pexaria.h>
+#include <module/gsi_sam/gsi_sam.h>
+#include <module/gsi_tamex/gsi_tamex.h>
+#include <module/gsi_tridi/gsi_tridi.h>
+#include <module/gsi_triva/gsi_triva.h>
+#include <module/gsi_vetar/gsi_vetar.h>
+#include <module/gsi_vftx2/gsi_vftx2.h>
+#include <module/gsi_vulom/gsi_vulom.h>
+#include <module/gsi_vuprom/gsi_vuprom.h>
+#include <module/gsi_rfx1/gsi_rfx1.h>
+#include <module/mesytec_madc32/mesytec_madc32.h>
+#include <module/mesytec_mqdc32/mesytec_mqdc32.h>
+#include <module/mesytec_mtdc32/mesytec_mtdc32.h>
+#include <module/mesytec_mdpp16scp/mesytec_mdpp16scp.h>
+#include <module/mesytec_mdpp16qdc/mesytec_mdpp16qdc.h>
+#include <module/mesytec_mdpp32qdc/mesytec_mdpp32qdc.h>
+#include <module/mesytec_mdpp32scp/mesytec_mdpp32scp.h>
+#include <module/mesytec_vmmr8/mesytec_vmmr8.h>
+#include <module/sis_3316/sis_3316.h>
+#include <module/sis_3801/sis_3801.h>
+#include <module/sis_3820/sis_3820.h>
+#include <module/sis_3820_scaler/sis_3820_scaler.h>
+#include <nurdlib/keyword.h>
+struct ModuleListEntry const c_module_list_[] = {
+	{KW_CAEN_V1190, caen_v1190_setup_, caen_v1190_create_, "caen_v1190.cfg"},
+	{KW_CAEN_V1290, caen_v1290_setup_, caen_v1290_create_, "caen_v1290.cfg"},
+	{KW_CAEN_V767A, caen_v767a_setup_, caen_v767a_create_, "caen_v767a.cfg"},
+	{KW_CAEN_V775, caen_v775_setup_, caen_v775_create_, "caen_v775.cfg"},
+	{KW_CAEN_V785, caen_v785_setup_, caen_v785_create_, "caen_v785.cfg"},
+	{KW_CAEN_V785N, caen_v785n_setup_, caen_v785n_create_, "caen_v785n.cfg"},
+	{KW_CAEN_V792, caen_v792_setup_, caen_v792_create_, "caen_v792.cfg"},
+	{KW_CAEN_V965, caen_v965_setup_, caen_v965_create_, "caen_v965.cfg"},
+	{KW_CAEN_V560, caen_v560_setup_, caen_v560_create_, "caen_v560.cfg"},
+	{KW_CAEN_V820, caen_v820_setup_, caen_v820_create_, "caen_v820.cfg"},
+	{KW_CAEN_V830, caen_v830_setup_, caen_v830_create_, "caen_v830.cfg"},
+	{KW_CAEN_V895, caen_v895_setup_, caen_v895_create_, "caen_v895.cfg"},
+	{KW_CAEN_V1725, caen_v1725_setup_, caen_v1725_create_, "caen_v1725.cfg"},
+	{KW_DUMMY, dummy_setup_, dummy_create_, "dummy.cfg"},
+	{KW_GSI_CTDC, gsi_ctdc_setup_, gsi_ctdc_create_, "gsi_ctdc.cfg"},
+	{KW_GSI_FEBEX, gsi_febex_setup_, gsi_febex_create_, "gsi_febex.cfg"},
+	{KW_GSI_KILOM, gsi_kilom_setup_, gsi_kilom_create_, "gsi_kilom.cfg"},
+	{KW_GSI_MPPC_ROB, gsi_mppc_rob_setup_, gsi_mppc_rob_create_, "gsi_mppc_rob.cfg"},
+	{KW_GSI_PEXARIA, gsi_pexaria_setup_, gsi_pexaria_create_, "gsi_pexaria.cfg"},
+	{KW_GSI_SAM, gsi_sam_setup_, gsi_sam_create_, "gsi_sam.cfg"},
+	{KW_GSI_TAMEX, gsi_tamex_setup_, gsi_tamex_create_, "gsi_tamex.cfg"},
+	{KW_GSI_TRIDI, gsi_tridi_setup_, gsi_tridi_create_, "gsi_tridi.cfg"},
+	{KW_GSI_TRIVA, gsi_triva_setup_, gsi_triva_create_, "gsi_triva.cfg"},
+	{KW_GSI_VETAR, gsi_vetar_setup_, gsi_vetar_create_, "gsi_vetar.cfg"},
+	{KW_GSI_VFTX2, gsi_vftx2_setup_, gsi_vftx2_create_, "gsi_vftx2.cfg"},
+	{KW_GSI_VULOM, gsi_vulom_setup_, gsi_vulom_create_, "gsi_vulom.cfg"},
+	{KW_GSI_VUPROM, gsi_vuprom_setup_, gsi_vuprom_create_, "gsi_vuprom.cfg"},
+	{KW_GSI_RFX1, gsi_rfx1_setup_, gsi_rfx1_create_, "gsi_rfx1.cfg"},
+	{KW_MESYTEC_MADC32, mesytec_madc32_setup_, mesytec_madc32_create_, "mesytec_madc32.cfg"},
+	{KW_MESYTEC_MQDC32, mesytec_mqdc32_setup_, mesytec_mqdc32_create_, "mesytec_mqdc32.cfg"},
+	{KW_MESYTEC_MTDC32, mesytec_mtdc32_setup_, mesytec_mtdc32_create_, "mesytec_mtdc32.cfg"},
+	{KW_MESYTEC_MDPP16SCP, mesytec_mdpp16scp_setup_, mesytec_mdpp16scp_create_, "mesytec_mdpp16scp.cfg"},
+	{KW_MESYTEC_MDPP16QDC, mesytec_mdpp16qdc_setup_, mesytec_mdpp16qdc_create_, "mesytec_mdpp16qdc.cfg"},
+	{KW_MESYTEC_MDPP32QDC, mesytec_mdpp32qdc_setup_, mesytec_mdpp32qdc_create_, "mesytec_mdpp32qdc.cfg"},
+	{KW_MESYTEC_MDPP32SCP, mesytec_mdpp32scp_setup_, mesytec_mdpp32scp_create_, "mesytec_mdpp32scp.cfg"},
+	{KW_MESYTEC_VMMR8, mesytec_vmmr8_setup_, mesytec_vmmr8_create_, "mesytec_vmmr8.cfg"},
+	{KW_SIS_3316, sis_3316_setup_, sis_3316_create_, "sis_3316.cfg"},
+	{KW_SIS_3801, sis_3801_setup_, sis_3801_create_, "sis_3801.cfg"},
+	{KW_SIS_3820, sis_3820_setup_, sis_3820_create_, "sis_3820.cfg"},
+	{KW_SIS_3820_SCALER, sis_3820_scaler_setup_, sis_3820_scaler_create_, "sis_3820_scaler.cfg"},
+	{KW_NONE, NULL, NULL, NULL}
+};
+extern struct RegisterEntryClient const c_caen_v1190_register_list_client_[];
+extern struct RegisterEntryServer const c_caen_v1190_register_list_server_[];
+extern struct RegisterEntryClient const c_caen_v1290_register_list_client_[];
+extern struct RegisterEntryServer const c_caen_v1290_register_list_server_[];
+extern struct RegisterEntryClient const c_caen_v1n90_register_list_client_[];
+extern struct RegisterEntryServer const c_caen_v1n90_register_list_server_[];
+extern struct RegisterEntryClient const c_caen_v767a_register_list_client_[];
+extern struct RegisterEntryServer const c_caen_v767a_register_list_server_[];
+extern struct RegisterEntryClient const c_caen_v775_register_list_client_[];
+extern struct RegisterEntryServer const c_caen_v775_register_list_server_[];
+extern struct RegisterEntryClient const c_caen_v785_register_list_client_[];
+extern struct RegisterEntryServer const c_caen_v785_register_list_server_[];
+extern struct RegisterEntryClient const c_caen_v785n_register_list_client_[];
+extern struct RegisterEntryServer const c_caen_v785n_register_list_server_[];
+extern struct RegisterEntryClient const c_caen_v792_register_list_client_[];
+extern struct RegisterEntryServer const c_caen_v792_register_list_server_[];
+extern struct RegisterEntryClient const c_caen_v7nn_register_list_client_[];
+extern struct RegisterEntryServer const c_caen_v7nn_register_list_server_[];
+extern struct RegisterEntryClient const c_caen_v965_register_list_client_[];
+extern struct RegisterEntryServer const c_caen_v965_register_list_server_[];
+extern struct RegisterEntryClient const c_caen_v560_register_list_client_[];
+extern struct RegisterEntryServer const c_caen_v560_register_list_server_[];
+extern struct RegisterEntryClient const c_caen_v820_register_list_client_[];
+extern struct RegisterEntryServer const c_caen_v820_register_list_server_[];
+extern struct RegisterEntryClient const c_caen_v830_register_list_client_[];
+extern struct RegisterEntryServer const c_caen_v830_register_list_server_[];
+extern struct RegisterEntryClient const c_caen_v8n0_register_list_client_[];
+extern struct RegisterEntryServer const c_caen_v8n0_register_list_server_[];
+extern struct RegisterEntryClient const c_caen_v895_register_list_client_[];
+extern struct RegisterEntryServer const c_caen_v895_register_list_server_[];
+extern struct RegisterEntryClient const c_caen_v1725_register_list_client_[];
+extern struct RegisterEntryServer const c_caen_v1725_register_list_server_[];
+extern struct RegisterEntryClient const c_dummy_register_list_client_[];
+extern struct RegisterEntryServer const c_dummy_register_list_server_[];
+extern struct RegisterEntryClient const c_gsi_etherbone_register_list_client_[];
+extern struct RegisterEntryServer const c_gsi_etherbone_register_list_server_[];
+extern struct RegisterEntryClient const c_gsi_pex_register_list_client_[];
+extern struct RegisterEntryServer const c_gsi_pex_register_list_server_[];
+extern struct RegisterEntryClient const c_gsi_sam_register_list_client_[];
+extern struct RegisterEntryServer const c_gsi_sam_register_list_server_[];
+extern struct RegisterEntryClient const c_gsi_triva_register_list_client_[];
+extern struct RegisterEntryServer const c_gsi_triva_register_list_server_[];
+extern struct RegisterEntryClient const c_gsi_vftx2_register_list_client_[];
+extern struct RegisterEntryServer const c_gsi_vftx2_register_list_server_[];
+extern struct RegisterEntryClient const c_gsi_vuprom_register_list_client_[];
+extern struct RegisterEntryServer const c_gsi_vuprom_register_list_server_[];
+extern struct RegisterEntryClient const c_mesytec_mxdc32_register_list_client_[];
+extern struct RegisterEntryServer const c_mesytec_mxdc32_register_list_server_[];
+extern struct RegisterEntryClient const c_mesytec_madc32_register_list_client_[];
+extern struct RegisterEntryServer const c_mesytec_madc32_register_list_server_[];
+extern struct RegisterEntryClient const c_mesytec_mqdc32_register_list_client_[];
+extern struct RegisterEntryServer const c_mesytec_mqdc32_register_list_server_[];
+extern struct RegisterEntryClient const c_mesytec_mtdc32_register_list_client_[];
+extern struct RegisterEntryServer const c_mesytec_mtdc32_register_list_server_[];
+extern struct RegisterEntryClient const c_mesytec_mdpp_register_list_client_[];
+extern struct RegisterEntryServer const c_mesytec_mdpp_register_list_server_[];
+extern struct RegisterEntryClient const c_mesytec_mdpp16scp_register_list_client_[];
+extern struct RegisterEntryServer const c_mesytec_mdpp16scp_register_list_server_[];
+extern struct RegisterEntryClient const c_mesytec_mdpp16qdc_register_list_client_[];
+extern struct RegisterEntryServer const c_mesytec_mdpp16qdc_register_list_server_[];
+extern struct RegisterEntryClient const c_mesytec_mdpp32qdc_register_list_client_[];
+extern struct RegisterEntryServer const c_mesytec_mdpp32qdc_register_list_server_[];
+extern struct RegisterEntryClient const c_mesytec_mdpp32scp_register_list_client_[];
+extern struct RegisterEntryServer const c_mesytec_mdpp32scp_register_list_server_[];
+extern struct RegisterEntryClient const c_mesytec_vmmr8_register_list_client_[];
+extern struct RegisterEntryServer const c_mesytec_vmmr8_register_list_server_[];
+extern struct RegisterEntryClient const c_sis_3801_register_list_client_[];
+extern struct RegisterEntryServer const c_sis_3801_register_list_server_[];
+extern struct RegisterEntryClient const c_sis_3820_register_list_client_[];
+extern struct RegisterEntryServer const c_sis_3820_register_list_server_[];
+extern struct RegisterEntryClient const c_sis_3820_scaler_register_list_client_[];
+extern struct RegisterEntryServer const c_sis_3820_scaler_register_list_server_[];
+struct ModuleRegisterListEntryClient const c_module_register_list_client_[] = {
+	{KW_CAEN_V1190, c_caen_v1190_register_list_client_},
+	{KW_CAEN_V1290, c_caen_v1290_register_list_client_},
+	{KW_CAEN_V767A, c_caen_v767a_register_list_client_},
+	{KW_CAEN_V775, c_caen_v775_register_list_client_},
+	{KW_CAEN_V785, c_caen_v785_register_list_client_},
+	{KW_CAEN_V785N, c_caen_v785n_register_list_client_},
+	{KW_CAEN_V792, c_caen_v792_register_list_client_},
+	{KW_CAEN_V965, c_caen_v965_register_list_client_},
+	{KW_CAEN_V560, c_caen_v560_register_list_client_},
+	{KW_CAEN_V820, c_caen_v820_register_list_client_},
+	{KW_CAEN_V830, c_caen_v830_register_list_client_},
+	{KW_CAEN_V895, c_caen_v895_register_list_client_},
+	{KW_CAEN_V1725, c_caen_v1725_register_list_client_},
+	{KW_DUMMY, c_dummy_register_list_client_},
+	{KW_GSI_SAM, c_gsi_sam_register_list_client_},
+	{KW_GSI_TRIVA, c_gsi_triva_register_list_client_},
+	{KW_GSI_VFTX2, c_gsi_vftx2_register_list_client_},
+	{KW_GSI_VUPROM, c_gsi_vuprom_register_list_client_},
+	{KW_MESYTEC_MADC32, c_mesytec_madc32_register_list_client_},
+	{KW_MESYTEC_MQDC32, c_mesytec_mqdc32_register_list_client_},
+	{KW_MESYTEC_MTDC32, c_mesytec_mtdc32_register_list_client_},
+	{KW_MESYTEC_MDPP16SCP, c_mesytec_mdpp16scp_register_list_client_},
+	{KW_MESYTEC_MDPP16QDC, c_mesytec_mdpp16qdc_register_list_client_},
+	{KW_MESYTEC_MDPP32QDC, c_mesytec_mdpp32qdc_register_list_client_},
+	{KW_MESYTEC_MDPP32SCP, c_mesytec_mdpp32scp_register_list_client_},
+	{KW_MESYTEC_VMMR8, c_mesytec_vmmr8_register_list_client_},
+	{KW_SIS_3801, c_sis_3801_register_list_client_},
+	{KW_SIS_3820, c_sis_3820_register_list_client_},
+	{KW_SIS_3820_SCALER, c_sis_3820_scaler_register_list_client_},
+	{KW_NONE, NULL}
+};
+struct ModuleRegisterListEntryServer const c_module_register_list_server_[] = {
+	{KW_CAEN_V1190, c_caen_v1190_register_list_server_},
+	{KW_CAEN_V1290, c_caen_v1290_register_list_server_},
+	{KW_CAEN_V767A, c_caen_v767a_register_list_server_},
+	{KW_CAEN_V775, c_caen_v775_register_list_server_},
+	{KW_CAEN_V785, c_caen_v785_register_list_server_},
+	{KW_CAEN_V785N, c_caen_v785n_register_list_server_},
+	{KW_CAEN_V792, c_caen_v792_register_list_server_},
+	{KW_CAEN_V965, c_caen_v965_register_list_server_},
+	{KW_CAEN_V560, c_caen_v560_register_list_server_},
+	{KW_CAEN_V820, c_caen_v820_register_list_server_},
+	{KW_CAEN_V830, c_caen_v830_register_list_server_},
+	{KW_CAEN_V895, c_caen_v895_register_list_server_},
+	{KW_CAEN_V1725, c_caen_v1725_register_list_server_},
+	{KW_DUMMY, c_dummy_register_list_server_},
+	{KW_GSI_SAM, c_gsi_sam_register_list_server_},
+	{KW_GSI_TRIVA, c_gsi_triva_register_list_server_},
+	{KW_GSI_VFTX2, c_gsi_vftx2_register_list_server_},
+	{KW_GSI_VUPROM, c_gsi_vuprom_register_list_server_},
+	{KW_MESYTEC_MADC32, c_mesytec_madc32_register_list_server_},
+	{KW_MESYTEC_MQDC32, c_mesytec_mqdc32_register_list_server_},
+	{KW_MESYTEC_MTDC32, c_mesytec_mtdc32_register_list_server_},
+	{KW_MESYTEC_MDPP16SCP, c_mesytec_mdpp16scp_register_list_server_},
+	{KW_MESYTEC_MDPP16QDC, c_mesytec_mdpp16qdc_register_list_server_},
+	{KW_MESYTEC_MDPP32QDC, c_mesytec_mdpp32qdc_register_list_server_},
+	{KW_MESYTEC_MDPP32SCP, c_mesytec_mdpp32scp_register_list_server_},
+	{KW_MESYTEC_VMMR8, c_mesytec_vmmr8_register_list_server_},
+	{KW_SIS_3801, c_sis_3801_register_list_server_},
+	{KW_SIS_3820, c_sis_3820_register_list_server_},
+	{KW_SIS_3820_SCALER, c_sis_3820_scaler_register_list_server_},
+	{KW_NONE, NULL}
+};
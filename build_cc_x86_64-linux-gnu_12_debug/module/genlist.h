@@ -0,0 +1,16 @@
+#ifndef MODULE_LIST_H
+#define MODULE_LIST_H
+#include <module/module.h>
+#include <module/reggen/registerlist.h>
+extern struct ModuleListEntry const c_module_list_[];
+struct ModuleRegisterListEntryClient {
+	enum Keyword type;
+	struct RegisterEntryClient const *list;
+};
+struct ModuleRegisterListEntryServer {
+	enum Keyword type;
+	struct RegisterEntryServer const *list;
+};
+extern struct ModuleRegisterListEntryClient const c_module_register_list_client_[];
+extern struct ModuleRegisterListEntryServer const c_module_register_list_server_[];
+#endif
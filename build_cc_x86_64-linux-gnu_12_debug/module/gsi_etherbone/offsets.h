@@ -0,0 +1,46 @@
+#ifndef MODULE_GSI_ETHERBONE_OFFSETS_H
+#define MODULE_GSI_ETHERBONE_OFFSETS_H
+
+#define MOD_fifo_ready 1
+#define BITS_fifo_ready 32
+#define  LEN_fifo_ready 0
+#define  OFS_fifo_ready (0x0 + 0 * 4)
+#define MOD_fifo_clear 4
+#define BITS_fifo_clear 32
+#define  LEN_fifo_clear 0
+#define  OFS_fifo_clear (0x4 + 0 * 4)
+#define MOD_trig_armset 4
+#define BITS_trig_armset 32
+#define  LEN_trig_armset 0
+#define  OFS_trig_armset (0x10 + 0 * 4)
+#define MOD_chns_fifosize 1
+#define BITS_chns_fifosize 32
+#define  LEN_chns_fifosize 0
+#define  OFS_chns_fifosize (0x38 + 0 * 4)
+#define MOD_ch_select 4
+#define BITS_ch_select 32
+#define  LEN_ch_select 0
+#define  OFS_ch_select (0x58 + 0 * 4)
+#define MOD_fifo_pop 4
+#define BITS_fifo_pop 32
+#define  LEN_fifo_pop 0
+#define  OFS_fifo_pop (0x5c + 0 * 4)
+#define MOD_fifo_cnt 1
+#define BITS_fifo_cnt 32
+#define  LEN_fifo_cnt 0
+#define  OFS_fifo_cnt (0x64 + 0 * 4)
+#define MOD_fifo_ftshi 1
+#define BITS_fifo_ftshi 32
+#define  LEN_fifo_ftshi 0
+#define  OFS_fifo_ftshi (0x68 + 0 * 4)
+#define MOD_fifo_ftslo 1
+#define BITS_fifo_ftslo 32
+#define  LEN_fifo_ftslo 0
+#define  OFS_fifo_ftslo (0x6c + 0 * 4)
+#define MOD_fifo_ftssub 1
+#define BITS_fifo_ftssub 32
+#define  LEN_fifo_ftssub 0
+#define  OFS_fifo_ftssub (0x70 + 0 * 4)
+#define MAP_SIZE 0x74
+
+#endif
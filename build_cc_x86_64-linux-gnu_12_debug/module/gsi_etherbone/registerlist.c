@@ -0,0 +1,22 @@
+#include <stdlib.h>
+#include <module/reggen/registerlist.h>
+
+struct RegisterEntryClient const c_gsi_etherbone_register_list_client_[] = {
+	{0x00000000,  0, 32, "fifo_ready"},
+	{0x00000038,  0, 32, "chns_fifosize"},
+	{0x00000064,  0, 32, "fifo_cnt"},
+	{0x00000068,  0, 32, "fifo_ftshi"},
+	{0x0000006c,  0, 32, "fifo_ftslo"},
+	{0x00000070,  0, 32, "fifo_ftssub"},
+	{0x00000000,  0,  0, NULL}
+};
+
+struct RegisterEntryServer const c_gsi_etherbone_register_list_server_[] = {
+	{0x00000000,  0, 32, 4},
+	{0x00000038,  0, 32, 4},
+	{0x00000064,  0, 32, 4},
+	{0x00000068,  0, 32, 4},
+	{0x0000006c,  0, 32, 4},
+	{0x00000070,  0, 32, 4},
+	{0x00000000,  0,  0, 0}
+};
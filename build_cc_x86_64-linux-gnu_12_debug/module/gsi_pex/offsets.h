@@ -0,0 +1,110 @@
+#ifndef MODULE_GSI_PEX_OFFSETS_H
+#define MODULE_GSI_PEX_OFFSETS_H
+
+#define MOD_heal 5
+#define BITS_heal 32
+#define  LEN_heal 0
+#define  OFS_heal (0x20010 + 0 * 4)
+#define MOD_req_comm 5
+#define BITS_req_comm 32
+#define  LEN_req_comm 0
+#define  OFS_req_comm (0x21000 + 0 * 4)
+#define MOD_req_addr 5
+#define BITS_req_addr 32
+#define  LEN_req_addr 0
+#define  OFS_req_addr (0x21004 + 0 * 4)
+#define MOD_req_data 5
+#define BITS_req_data 32
+#define  LEN_req_data 0
+#define  OFS_req_data (0x21008 + 0 * 4)
+#define MOD_rep_stat 1
+#define BITS_rep_stat 32
+#define  LEN_rep_stat 0
+#define  OFS_rep_stat (0x2100c + 0 * 4)
+#define MOD_rep_clr 4
+#define BITS_rep_clr 32
+#define  LEN_rep_clr 0
+#define  OFS_rep_clr (0x2100c + 0 * 4)
+#define MOD_rep_statn(i) 5
+#define BITS_rep_statn(i) 32
+#define  LEN_rep_statn(i) 4
+#define  OFS_rep_statn(i) (0x21010 + i * 4)
+#define MOD_rep_addrn(i) 5
+#define BITS_rep_addrn(i) 32
+#define  LEN_rep_addrn(i) 4
+#define  OFS_rep_addrn(i) (0x21020 + i * 4)
+#define MOD_rep_datan(i) 5
+#define BITS_rep_datan(i) 32
+#define  LEN_rep_datan(i) 4
+#define  OFS_rep_datan(i) (0x21030 + i * 4)
+#define MOD_rx_moni 5
+#define BITS_rx_moni 32
+#define  LEN_rx_moni 0
+#define  OFS_rx_moni (0x21040 + 0 * 4)
+#define MOD_rx_rst 5
+#define BITS_rx_rst 32
+#define  LEN_rx_rst 0
+#define  OFS_rx_rst (0x21044 + 0 * 4)
+#define MOD_sfp_disa 5
+#define BITS_sfp_disa 32
+#define  LEN_sfp_disa 0
+#define  OFS_sfp_disa (0x21048 + 0 * 4)
+#define MOD_sfp_fault 5
+#define BITS_sfp_fault 32
+#define  LEN_sfp_fault 0
+#define  OFS_sfp_fault (0x2104c + 0 * 4)
+#define MOD_sfp_fifo 5
+#define BITS_sfp_fifo 32
+#define  LEN_sfp_fifo 0
+#define  OFS_sfp_fifo (0x21050 + 0 * 4)
+#define MOD_sfp_tk_stat(i) 5
+#define BITS_sfp_tk_stat(i) 32
+#define  LEN_sfp_tk_stat(i) 1
+#define  OFS_sfp_tk_stat(i) (0x21060 + i * 4)
+#define MOD_sfp_tk_head 5
+#define BITS_sfp_tk_head 32
+#define  LEN_sfp_tk_head 0
+#define  OFS_sfp_tk_head (0x21070 + 0 * 4)
+#define MOD_sfp_tk_foot 5
+#define BITS_sfp_tk_foot 32
+#define  LEN_sfp_tk_foot 0
+#define  OFS_sfp_tk_foot (0x21080 + 0 * 4)
+#define MOD_sfp_tk_dsize 5
+#define BITS_sfp_tk_dsize 32
+#define  LEN_sfp_tk_dsize 0
+#define  OFS_sfp_tk_dsize (0x21090 + 0 * 4)
+#define MOD_sfp_tk_sel 5
+#define BITS_sfp_tk_sel 32
+#define  LEN_sfp_tk_sel 0
+#define  OFS_sfp_tk_sel (0x210a0 + 0 * 4)
+#define MOD_tk_mem_sizen(i) 5
+#define BITS_tk_mem_sizen(i) 32
+#define  LEN_tk_mem_sizen(i) 4
+#define  OFS_tk_mem_sizen(i) (0x210b0 + i * 4)
+#define MOD_prog_version 5
+#define BITS_prog_version 32
+#define  LEN_prog_version 0
+#define  OFS_prog_version (0x211fc + 0 * 4)
+#define MOD_tk_mem 5
+#define BITS_tk_mem 32
+#define  LEN_tk_mem 0
+#define  OFS_tk_mem (0x28000 + 0 * 4)
+#define MOD_tk_mem_0 5
+#define BITS_tk_mem_0 32
+#define  LEN_tk_mem_0 0
+#define  OFS_tk_mem_0 (0x100000 + 0 * 4)
+#define MOD_tk_mem_1 5
+#define BITS_tk_mem_1 32
+#define  LEN_tk_mem_1 0
+#define  OFS_tk_mem_1 (0x140000 + 0 * 4)
+#define MOD_tk_mem_2 5
+#define BITS_tk_mem_2 32
+#define  LEN_tk_mem_2 0
+#define  OFS_tk_mem_2 (0x180000 + 0 * 4)
+#define MOD_tk_mem_3 5
+#define BITS_tk_mem_3 32
+#define  LEN_tk_mem_3 0
+#define  OFS_tk_mem_3 (0x1c0000 + 0 * 4)
+#define MAP_SIZE 0x1c0004
+
+#endif
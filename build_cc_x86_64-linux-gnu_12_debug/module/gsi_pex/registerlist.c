@@ -0,0 +1,60 @@
+#include <stdlib.h>
+#include <module/reggen/registerlist.h>
+
+struct RegisterEntryClient const c_gsi_pex_register_list_client_[] = {
+	{0x00020010,  0, 32, "heal"},
+	{0x00021000,  0, 32, "req_comm"},
+	{0x00021004,  0, 32, "req_addr"},
+	{0x00021008,  0, 32, "req_data"},
+	{0x0002100c,  0, 32, "rep_stat"},
+	{0x00021010,  4, 32, "rep_statn"},
+	{0x00021020,  4, 32, "rep_addrn"},
+	{0x00021030,  4, 32, "rep_datan"},
+	{0x00021040,  0, 32, "rx_moni"},
+	{0x00021044,  0, 32, "rx_rst"},
+	{0x00021048,  0, 32, "sfp_disa"},
+	{0x0002104c,  0, 32, "sfp_fault"},
+	{0x00021050,  0, 32, "sfp_fifo"},
+	{0x00021060,  1, 32, "sfp_tk_stat"},
+	{0x00021070,  0, 32, "sfp_tk_head"},
+	{0x00021080,  0, 32, "sfp_tk_foot"},
+	{0x00021090,  0, 32, "sfp_tk_dsize"},
+	{0x000210a0,  0, 32, "sfp_tk_sel"},
+	{0x000210b0,  4, 32, "tk_mem_sizen"},
+	{0x000211fc,  0, 32, "prog_version"},
+	{0x00028000,  0, 32, "tk_mem"},
+	{0x00100000,  0, 32, "tk_mem_0"},
+	{0x00140000,  0, 32, "tk_mem_1"},
+	{0x00180000,  0, 32, "tk_mem_2"},
+	{0x001c0000,  0, 32, "tk_mem_3"},
+	{0x00000000,  0,  0, NULL}
+};
+
+struct RegisterEntryServer const c_gsi_pex_register_list_server_[] = {
+	{0x00020010,  0, 32, 4},
+	{0x00021000,  0, 32, 4},
+	{0x00021004,  0, 32, 4},
+	{0x00021008,  0, 32, 4},
+	{0x0002100c,  0, 32, 4},
+	{0x00021010,  4, 32, 4},
+	{0x00021020,  4, 32, 4},
+	{0x00021030,  4, 32, 4},
+	{0x00021040,  0, 32, 4},
+	{0x00021044,  0, 32, 4},
+	{0x00021048,  0, 32, 4},
+	{0x0002104c,  0, 32, 4},
+	{0x00021050,  0, 32, 4},
+	{0x00021060,  1, 32, 4},
+	{0x00021070,  0, 32, 4},
+	{0x00021080,  0, 32, 4},
+	{0x00021090,  0, 32, 4},
+	{0x000210a0,  0, 32, 4},
+	{0x000210b0,  4, 32, 4},
+	{0x000211fc,  0, 32, 4},
+	{0x00028000,  0, 32, 4},
+	{0x00100000,  0, 32, 4},
+	{0x00140000,  0, 32, 4},
+	{0x00180000,  0, 32, 4},
+	{0x001c0000,  0, 32, 4},
+	{0x00000000,  0,  0, 0}
+};
@@ -0,0 +1,34 @@
+#ifndef MODULE_GSI_SAM_OFFSETS_H
+#define MODULE_GSI_SAM_OFFSETS_H
+
+#define MOD_trcl 5
+#define BITS_trcl 32
+#define  LEN_trcl 0
+#define  OFS_trcl (0x0 + 0 * 4)
+#define MOD_prot 5
+#define BITS_prot 32
+#define  LEN_prot 0
+#define  OFS_prot (0x4 + 0 * 4)
+#define MOD_init 5
+#define BITS_init 32
+#define  LEN_init 0
+#define  OFS_init (0x8 + 0 * 4)
+#define MOD_size 5
+#define BITS_size 32
+#define  LEN_size 0
+#define  OFS_size (0xc + 0 * 4)
+#define MOD_sam_gtb_id 5
+#define BITS_sam_gtb_id 32
+#define  LEN_sam_gtb_id 0
+#define  OFS_sam_gtb_id (0x10 + 0 * 4)
+#define MOD_event_no 5
+#define BITS_event_no 32
+#define  LEN_event_no 0
+#define  OFS_event_no (0x14 + 0 * 4)
+#define MOD_buf(i) 2
+#define BITS_buf(i) 32
+#define  LEN_buf(i) 262138
+#define  OFS_buf(i) (0x18 + i * 4)
+#define MAP_SIZE 0x100000
+
+#endif
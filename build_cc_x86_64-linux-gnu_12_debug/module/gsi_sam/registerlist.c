@@ -0,0 +1,22 @@
+#include <stdlib.h>
+#include <module/reggen/registerlist.h>
+
+struct RegisterEntryClient const c_gsi_sam_register_list_client_[] = {
+	{0x00000000,  0, 32, "trcl"},
+	{0x00000004,  0, 32, "prot"},
+	{0x00000008,  0, 32, "init"},
+	{0x0000000c,  0, 32, "size"},
+	{0x00000010,  0, 32, "sam_gtb_id"},
+	{0x00000014,  0, 32, "event_no"},
+	{0x00000000,  0,  0, NULL}
+};
+
+struct RegisterEntryServer const c_gsi_sam_register_list_server_[] = {
+	{0x00000000,  0, 32, 4},
+	{0x00000004,  0, 32, 4},
+	{0x00000008,  0, 32, 4},
+	{0x0000000c,  0, 32, 4},
+	{0x00000010,  0, 32, 4},
+	{0x00000014,  0, 32, 4},
+	{0x00000000,  0,  0, 0}
+};
@@ -0,0 +1,38 @@
+#ifndef MODULE_GSI_TRIVA_OFFSETS_H
+#define MODULE_GSI_TRIVA_OFFSETS_H
+
+#define MOD_status_register 5
+#define BITS_status_register 32
+#define  LEN_status_register 0
+#define  OFS_status_register (0x0 + 0 * 4)
+#define MOD_control_register 5
+#define BITS_control_register 32
+#define  LEN_control_register 0
+#define  OFS_control_register (0x4 + 0 * 4)
+#define MOD_fcatime 5
+#define BITS_fcatime 32
+#define  LEN_fcatime 0
+#define  OFS_fcatime (0x8 + 0 * 4)
+#define MOD_ctime 5
+#define BITS_ctime 32
+#define  LEN_ctime 0
+#define  OFS_ctime (0xc + 0 * 4)
+#define MOD_gate_generator_pulse_delay 4
+#define BITS_gate_generator_pulse_delay 32
+#define  LEN_gate_generator_pulse_delay 0
+#define  OFS_gate_generator_pulse_delay (0x10 + 0 * 4)
+#define MOD_gate_generator_pulse_width 4
+#define BITS_gate_generator_pulse_width 32
+#define  LEN_gate_generator_pulse_width 0
+#define  OFS_gate_generator_pulse_width (0x14 + 0 * 4)
+#define MOD_pulse_generator_period 4
+#define BITS_pulse_generator_period 32
+#define  LEN_pulse_generator_period 0
+#define  OFS_pulse_generator_period (0x18 + 0 * 4)
+#define MOD_pulse_generator_width 4
+#define BITS_pulse_generator_width 32
+#define  LEN_pulse_generator_width 0
+#define  OFS_pulse_generator_width (0x1c + 0 * 4)
+#define MAP_SIZE 0x20
+
+#endif
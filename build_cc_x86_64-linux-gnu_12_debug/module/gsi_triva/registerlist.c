@@ -0,0 +1,18 @@
+#include <stdlib.h>
+#include <module/reggen/registerlist.h>
+
+struct RegisterEntryClient const c_gsi_triva_register_list_client_[] = {
+	{0x00000000,  0, 32, "status_register"},
+	{0x00000004,  0, 32, "control_register"},
+	{0x00000008,  0, 32, "fcatime"},
+	{0x0000000c,  0, 32, "ctime"},
+	{0x00000000,  0,  0, NULL}
+};
+
+struct RegisterEntryServer const c_gsi_triva_register_list_server_[] = {
+	{0x00000000,  0, 32, 4},
+	{0x00000004,  0, 32, 4},
+	{0x00000008,  0, 32, 4},
+	{0x0000000c,  0, 32, 4},
+	{0x00000000,  0,  0, 0}
+};
@@ -0,0 +1,46 @@
+#ifndef MODULE_GSI_VFTX2_OFFSETS_H
+#define MODULE_GSI_VFTX2_OFFSETS_H
+
+#define MOD_channel_enable 5
+#define BITS_channel_enable 32
+#define  LEN_channel_enable 0
+#define  OFS_channel_enable (0x0 + 0 * 4)
+#define MOD_trigger_enable 5
+#define BITS_trigger_enable 32
+#define  LEN_trigger_enable 0
+#define  OFS_trigger_enable (0x4 + 0 * 4)
+#define MOD_allow_new_trigger 6
+#define BITS_allow_new_trigger 32
+#define  LEN_allow_new_trigger 0
+#define  OFS_allow_new_trigger (0xc + 0 * 4)
+#define MOD_channel_reset 6
+#define BITS_channel_reset 32
+#define  LEN_channel_reset 0
+#define  OFS_channel_reset (0x10 + 0 * 4)
+#define MOD_fifo_status 1
+#define BITS_fifo_status 32
+#define  LEN_fifo_status 0
+#define  OFS_fifo_status (0x14 + 0 * 4)
+#define MOD_trigger_window 5
+#define BITS_trigger_window 32
+#define  LEN_trigger_window 0
+#define  OFS_trigger_window (0x18 + 0 * 4)
+#define MOD_data_fifo 2
+#define BITS_data_fifo 32
+#define  LEN_data_fifo 0
+#define  OFS_data_fifo (0x1c + 0 * 4)
+#define MOD_start_reset 6
+#define BITS_start_reset 32
+#define  LEN_start_reset 0
+#define  OFS_start_reset (0x30 + 0 * 4)
+#define MOD_channel_invert 6
+#define BITS_channel_invert 32
+#define  LEN_channel_invert 0
+#define  OFS_channel_invert (0x38 + 0 * 4)
+#define MOD_cpld 5
+#define BITS_cpld 32
+#define  LEN_cpld 0
+#define  OFS_cpld (0x800008 + 0 * 4)
+#define MAP_SIZE 0x80000c
+
+#endif
@@ -0,0 +1,20 @@
+#include <stdlib.h>
+#include <module/reggen/registerlist.h>
+
+struct RegisterEntryClient const c_gsi_vftx2_register_list_client_[] = {
+	{0x00000000,  0, 32, "channel_enable"},
+	{0x00000004,  0, 32, "trigger_enable"},
+	{0x00000014,  0, 32, "fifo_status"},
+	{0x00000018,  0, 32, "trigger_window"},
+	{0x00800008,  0, 32, "cpld"},
+	{0x00000000,  0,  0, NULL}
+};
+
+struct RegisterEntryServer const c_gsi_vftx2_register_list_server_[] = {
+	{0x00000000,  0, 32, 4},
+	{0x00000004,  0, 32, 4},
+	{0x00000014,  0, 32, 4},
+	{0x00000018,  0, 32, 4},
+	{0x00800008,  0, 32, 4},
+	{0x00000000,  0,  0, 0}
+};
@@ -0,0 +1,154 @@
+#ifndef MODULE_GSI_VUPROM_OFFSETS_H
+#define MODULE_GSI_VUPROM_OFFSETS_H
+
+#define MOD_tdc_data(i) 1
+#define BITS_tdc_data(i) 32
+#define  LEN_tdc_data(i) 192
+#define  OFS_tdc_data(i) (0x0 + i * 4)
+#define MOD_fifo_data 1
+#define BITS_fifo_data 32
+#define  LEN_fifo_data 0
+#define  OFS_fifo_data (0x300 + 0 * 4)
+#define MOD_fifo_size 1
+#define BITS_fifo_size 32
+#define  LEN_fifo_size 0
+#define  OFS_fifo_size (0x304 + 0 * 4)
+#define MOD_fifo_ad 1
+#define BITS_fifo_ad 32
+#define  LEN_fifo_ad 0
+#define  OFS_fifo_ad (0x308 + 0 * 4)
+#define MOD_parameters 1
+#define BITS_parameters 32
+#define  LEN_parameters 0
+#define  OFS_parameters (0x400 + 0 * 4)
+#define MOD_full_range 5
+#define BITS_full_range 32
+#define  LEN_full_range 0
+#define  OFS_full_range (0x404 + 0 * 4)
+#define MOD_data_ready 5
+#define BITS_data_ready 32
+#define  LEN_data_ready 0
+#define  OFS_data_ready (0x408 + 0 * 4)
+#define MOD_zero_suppress 5
+#define BITS_zero_suppress 32
+#define  LEN_zero_suppress 0
+#define  OFS_zero_suppress (0x40c + 0 * 4)
+#define MOD_tdc_fifo_counter 1
+#define BITS_tdc_fifo_counter 32
+#define  LEN_tdc_fifo_counter 0
+#define  OFS_tdc_fifo_counter (0x410 + 0 * 4)
+#define MOD_tdc_ad 1
+#define BITS_tdc_ad 32
+#define  LEN_tdc_ad 0
+#define  OFS_tdc_ad (0x414 + 0 * 4)
+#define MOD_tdc_fifo_ad 1
+#define BITS_tdc_fifo_ad 32
+#define  LEN_tdc_fifo_ad 0
+#define  OFS_tdc_fifo_ad (0x418 + 0 * 4)
+#define MOD_disable(i) 5
+#define BITS_disable(i) 32
+#define  LEN_disable(i) 6
+#define  OFS_disable(i) (0x420 + i * 4)
+#define MOD_module_id 5
+#define BITS_module_id 32
+#define  LEN_module_id 0
+#define  OFS_module_id (0x440 + 0 * 4)
+#define MOD_ram(i) 1
+#define BITS_ram(i) 32
+#define  LEN_ram(i) 256
+#define  OFS_ram(i) (0x800 + i * 4)
+#define MOD_debug_fixed 1
+#define BITS_debug_fixed 32
+#define  LEN_debug_fixed 0
+#define  OFS_debug_fixed (0xf00 + 0 * 4)
+#define MOD_debug_ram_state 1
+#define BITS_debug_ram_state 32
+#define  LEN_debug_ram_state 0
+#define  OFS_debug_ram_state (0xf04 + 0 * 4)
+#define MOD_vme_test 4
+#define BITS_vme_test 32
+#define  LEN_vme_test 0
+#define  OFS_vme_test (0xf08 + 0 * 4)
+#define MOD_vme_stop 1
+#define BITS_vme_stop 32
+#define  LEN_vme_stop 0
+#define  OFS_vme_stop (0xf0c + 0 * 4)
+#define MOD_scaler(i) 1
+#define BITS_scaler(i) 32
+#define  LEN_scaler(i) 192
+#define  OFS_scaler(i) (0x1000 + i * 4)
+#define MOD_scaler_in 1
+#define BITS_scaler_in 32
+#define  LEN_scaler_in 0
+#define  OFS_scaler_in (0x1300 + 0 * 4)
+#define MOD_scaler_clk_1hz 1
+#define BITS_scaler_clk_1hz 32
+#define  LEN_scaler_clk_1hz 0
+#define  OFS_scaler_clk_1hz (0x1304 + 0 * 4)
+#define MOD_scaler_clk_1khz 1
+#define BITS_scaler_clk_1khz 32
+#define  LEN_scaler_clk_1khz 0
+#define  OFS_scaler_clk_1khz (0x1308 + 0 * 4)
+#define MOD_scaler_raw(i) 1
+#define BITS_scaler_raw(i) 32
+#define  LEN_scaler_raw(i) 192
+#define  OFS_scaler_raw(i) (0x1400 + i * 4)
+#define MOD_scaler_raw_in 1
+#define BITS_scaler_raw_in 32
+#define  LEN_scaler_raw_in 0
+#define  OFS_scaler_raw_in (0x1700 + 0 * 4)
+#define MOD_scaler_clr 4
+#define BITS_scaler_clr 32
+#define  LEN_scaler_clr 0
+#define  OFS_scaler_clr (0x1808 + 0 * 4)
+#define MOD_scaler_stop 1
+#define BITS_scaler_stop 32
+#define  LEN_scaler_stop 0
+#define  OFS_scaler_stop (0x180c + 0 * 4)
+#define MOD_scaler_debug 1
+#define BITS_scaler_debug 32
+#define  LEN_scaler_debug 0
+#define  OFS_scaler_debug (0x1f00 + 0 * 4)
+#define MOD_scaler_num_ch 1
+#define BITS_scaler_num_ch 32
+#define  LEN_scaler_num_ch 0
+#define  OFS_scaler_num_ch (0x1f04 + 0 * 4)
+#define MOD_scaler_bit_ch 1
+#define BITS_scaler_bit_ch 32
+#define  LEN_scaler_bit_ch 0
+#define  OFS_scaler_bit_ch (0x1f08 + 0 * 4)
+#define MOD_trig_sel 5
+#define BITS_trig_sel 32
+#define  LEN_trig_sel 0
+#define  OFS_trig_sel (0x2000 + 0 * 4)
+#define MOD_trig_out 5
+#define BITS_trig_out 32
+#define  LEN_trig_out 0
+#define  OFS_trig_out (0x2004 + 0 * 4)
+#define MOD_trig_debug 1
+#define BITS_trig_debug 32
+#define  LEN_trig_debug 0
+#define  OFS_trig_debug (0x2008 + 0 * 4)
+#define MOD_clock_status 5
+#define BITS_clock_status 32
+#define  LEN_clock_status 0
+#define  OFS_clock_status (0x4000 + 0 * 4)
+#define MOD_firmware_date 1
+#define BITS_firmware_date 32
+#define  LEN_firmware_date 0
+#define  OFS_firmware_date (0x4004 + 0 * 4)
+#define MOD_version 1
+#define BITS_version 32
+#define  LEN_version 0
+#define  OFS_version (0x4008 + 0 * 4)
+#define MOD_disp_sel 1
+#define BITS_disp_sel 32
+#define  LEN_disp_sel 0
+#define  OFS_disp_sel (0x5000 + 0 * 4)
+#define MOD_disp_image(i) 1
+#define BITS_disp_image(i) 32
+#define  LEN_disp_image(i) 25
+#define  OFS_disp_image(i) (0x5100 + i * 4)
+#define MAP_SIZE 0x5164
+
+#endif
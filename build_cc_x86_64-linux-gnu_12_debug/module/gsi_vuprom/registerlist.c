@@ -0,0 +1,80 @@
+#include <stdlib.h>
+#include <module/reggen/registerlist.h>
+
+struct RegisterEntryClient const c_gsi_vuprom_register_list_client_[] = {
+	{0x00000000, 192, 32, "tdc_data"},
+	{0x00000300,  0, 32, "fifo_data"},
+	{0x00000304,  0, 32, "fifo_size"},
+	{0x00000308,  0, 32, "fifo_ad"},
+	{0x00000400,  0, 32, "parameters"},
+	{0x00000404,  0, 32, "full_range"},
+	{0x00000408,  0, 32, "data_ready"},
+	{0x0000040c,  0, 32, "zero_suppress"},
+	{0x00000410,  0, 32, "tdc_fifo_counter"},
+	{0x00000414,  0, 32, "tdc_ad"},
+	{0x00000418,  0, 32, "tdc_fifo_ad"},
+	{0x00000420,  6, 32, "disable"},
+	{0x00000440,  0, 32, "module_id"},
+	{0x00000800, 256, 32, "ram"},
+	{0x00000f00,  0, 32, "debug_fixed"},
+	{0x00000f04,  0, 32, "debug_ram_state"},
+	{0x00000f0c,  0, 32, "vme_stop"},
+	{0x00001000, 192, 32, "scaler"},
+	{0x00001300,  0, 32, "scaler_in"},
+	{0x00001304,  0, 32, "scaler_clk_1hz"},
+	{0x00001308,  0, 32, "scaler_clk_1khz"},
+	{0x00001400, 192, 32, "scaler_raw"},
+	{0x00001700,  0, 32, "scaler_raw_in"},
+	{0x0000180c,  0, 32, "scaler_stop"},
+	{0x00001f00,  0, 32, "scaler_debug"},
+	{0x00001f04,  0, 32, "scaler_num_ch"},
+	{0x00001f08,  0, 32, "scaler_bit_ch"},
+	{0x00002000,  0, 32, "trig_sel"},
+	{0x00002004,  0, 32, "trig_out"},
+	{0x00002008,  0, 32, "trig_debug"},
+	{0x00004000,  0, 32, "clock_status"},
+	{0x00004004,  0, 32, "firmware_date"},
+	{0x00004008,  0, 32, "version"},
+	{0x00005000,  0, 32, "disp_sel"},
+	{0x00005100, 25, 32, "disp_image"},
+	{0x00000000,  0,  0, NULL}
+};
+
+struct RegisterEntryServer const c_gsi_vuprom_register_list_server_[] = {
+	{0x00000000, 192, 32, 4},
+	{0x00000300,  0, 32, 4},
+	{0x00000304,  0, 32, 4},
+	{0x00000308,  0, 32, 4},
+	{0x00000400,  0, 32, 4},
+	{0x00000404,  0, 32, 4},
+	{0x00000408,  0, 32, 4},
+	{0x0000040c,  0, 32, 4},
+	{0x00000410,  0, 32, 4},
+	{0x00000414,  0, 32, 4},
+	{0x00000418,  0, 32, 4},
+	{0x00000420,  6, 32, 4},
+	{0x00000440,  0, 32, 4},
+	{0x00000800, 256, 32, 4},
+	{0x00000f00,  0, 32, 4},
+	{0x00000f04,  0, 32, 4},
+	{0x00000f0c,  0, 32, 4},
+	{0x00001000, 192, 32, 4},
+	{0x00001300,  0, 32, 4},
+	{0x00001304,  0, 32, 4},
+	{0x00001308,  0, 32, 4},
+	{0x00001400, 192, 32, 4},
+	{0x00001700,  0, 32, 4},
+	{0x0000180c,  0, 32, 4},
+	{0x00001f00,  0, 32, 4},
+	{0x00001f04,  0, 32, 4},
+	{0x00001f08,  0, 32, 4},
+	{0x00002000,  0, 32, 4},
+	{0x00002004,  0, 32, 4},
+	{0x00002008,  0, 32, 4},
+	{0x00004000,  0, 32, 4},
+	{0x00004004,  0, 32, 4},
+	{0x00004008,  0, 32, 4},
+	{0x00005000,  0, 32, 4},
+	{0x00005100, 25, 32, 4},
+	{0x00000000,  0,  0, 0}
+};
@@ -0,0 +1,322 @@
+#ifndef MODULE_MESYTEC_MDPP16SCP_OFFSETS_H
+#define MODULE_MESYTEC_MDPP16SCP_OFFSETS_H
+
+#define MOD_data_fifo(i) 6
+#define BITS_data_fifo(i) 32
+#define  LEN_data_fifo(i) 1
+#define  OFS_data_fifo(i) (0x0 + i * 4)
+#define MOD_address_source 5
+#define BITS_address_source 16
+#define  LEN_address_source 0
+#define  OFS_address_source (0x6000 + 0 * 2)
+#define MOD_address_reg 5
+#define BITS_address_reg 16
+#define  LEN_address_reg 0
+#define  OFS_address_reg (0x6002 + 0 * 2)
+#define MOD_module_id 5
+#define BITS_module_id 16
+#define  LEN_module_id 0
+#define  OFS_module_id (0x6004 + 0 * 2)
+#define MOD_fast_mblt 5
+#define BITS_fast_mblt 16
+#define  LEN_fast_mblt 0
+#define  OFS_fast_mblt (0x6006 + 0 * 2)
+#define MOD_soft_reset 5
+#define BITS_soft_reset 16
+#define  LEN_soft_reset 0
+#define  OFS_soft_reset (0x6008 + 0 * 2)
+#define MOD_firmware_revision 1
+#define BITS_firmware_revision 16
+#define  LEN_firmware_revision 0
+#define  OFS_firmware_revision (0x600e + 0 * 2)
+#define MOD_irq_level 5
+#define BITS_irq_level 16
+#define  LEN_irq_level 0
+#define  OFS_irq_level (0x6010 + 0 * 2)
+#define MOD_irq_vector 5
+#define BITS_irq_vector 16
+#define  LEN_irq_vector 0
+#define  OFS_irq_vector (0x6012 + 0 * 2)
+#define MOD_irq_test 4
+#define BITS_irq_test 16
+#define  LEN_irq_test 0
+#define  OFS_irq_test (0x6014 + 0 * 2)
+#define MOD_irq_reset 4
+#define BITS_irq_reset 16
+#define  LEN_irq_reset 0
+#define  OFS_irq_reset (0x6016 + 0 * 2)
+#define MOD_irq_threshold 5
+#define BITS_irq_threshold 16
+#define  LEN_irq_threshold 0
+#define  OFS_irq_threshold (0x6018 + 0 * 2)
+#define MOD_max_transfer_data 5
+#define BITS_max_transfer_data 16
+#define  LEN_max_transfer_data 0
+#define  OFS_max_transfer_data (0x601a + 0 * 2)
+#define MOD_irq_source 5
+#define BITS_irq_source 16
+#define  LEN_irq_source 0
+#define  OFS_irq_source (0x601c + 0 * 2)
+#define MOD_irq_event_threshold 5
+#define BITS_irq_event_threshold 16
+#define  LEN_irq_event_threshold 0
+#define  OFS_irq_event_threshold (0x601e + 0 * 2)
+#define MOD_cblt_mcst_control 5
+#define BITS_cblt_mcst_control 16
+#define  LEN_cblt_mcst_control 0
+#define  OFS_cblt_mcst_control (0x6020 + 0 * 2)
+#define MOD_cblt_address 5
+#define BITS_cblt_address 16
+#define  LEN_cblt_address 0
+#define  OFS_cblt_address (0x6022 + 0 * 2)
+#define MOD_mcst_address 1
+#define BITS_mcst_address 16
+#define  LEN_mcst_address 0
+#define  OFS_mcst_address (0x6024 + 0 * 2)
+#define MOD_buffer_data_length 1
+#define BITS_buffer_data_length 16
+#define  LEN_buffer_data_length 0
+#define  OFS_buffer_data_length (0x6030 + 0 * 2)
+#define MOD_data_len_format 5
+#define BITS_data_len_format 16
+#define  LEN_data_len_format 0
+#define  OFS_data_len_format (0x6032 + 0 * 2)
+#define MOD_readout_reset 4
+#define BITS_readout_reset 16
+#define  LEN_readout_reset 0
+#define  OFS_readout_reset (0x6034 + 0 * 2)
+#define MOD_multievent 5
+#define BITS_multievent 16
+#define  LEN_multievent 0
+#define  OFS_multievent (0x6036 + 0 * 2)
+#define MOD_marking_type 5
+#define BITS_marking_type 16
+#define  LEN_marking_type 0
+#define  OFS_marking_type (0x6038 + 0 * 2)
+#define MOD_start_acq 5
+#define BITS_start_acq 16
+#define  LEN_start_acq 0
+#define  OFS_start_acq (0x603a + 0 * 2)
+#define MOD_fifo_reset 4
+#define BITS_fifo_reset 16
+#define  LEN_fifo_reset 0
+#define  OFS_fifo_reset (0x603c + 0 * 2)
+#define MOD_data_ready 1
+#define BITS_data_ready 16
+#define  LEN_data_ready 0
+#define  OFS_data_ready (0x603e + 0 * 2)
+#define MOD_tdc_resolution 5
+#define BITS_tdc_resolution 16
+#define  LEN_tdc_resolution 0
+#define  OFS_tdc_resolution (0x6042 + 0 * 2)
+#define MOD_output_format 5
+#define BITS_output_format 16
+#define  LEN_output_format 0
+#define  OFS_output_format (0x6044 + 0 * 2)
+#define MOD_adc_resolution 5
+#define BITS_adc_resolution 16
+#define  LEN_adc_resolution 0
+#define  OFS_adc_resolution (0x6046 + 0 * 2)
+#define MOD_win_start 5
+#define BITS_win_start 16
+#define  LEN_win_start 0
+#define  OFS_win_start (0x6050 + 0 * 2)
+#define MOD_win_width 5
+#define BITS_win_width 16
+#define  LEN_win_width 0
+#define  OFS_win_width (0x6054 + 0 * 2)
+#define MOD_trig_source 5
+#define BITS_trig_source 16
+#define  LEN_trig_source 0
+#define  OFS_trig_source (0x6058 + 0 * 2)
+#define MOD_trig_source_2 5
+#define BITS_trig_source_2 16
+#define  LEN_trig_source_2 0
+#define  OFS_trig_source_2 (0x605a + 0 * 2)
+#define MOD_first_hit 5
+#define BITS_first_hit 16
+#define  LEN_first_hit 0
+#define  OFS_first_hit (0x605c + 0 * 2)
+#define MOD_trigger_output 5
+#define BITS_trigger_output 16
+#define  LEN_trigger_output 0
+#define  OFS_trigger_output (0x605e + 0 * 2)
+#define MOD_ecl3 5
+#define BITS_ecl3 16
+#define  LEN_ecl3 0
+#define  OFS_ecl3 (0x6060 + 0 * 2)
+#define MOD_ecl2 5
+#define BITS_ecl2 16
+#define  LEN_ecl2 0
+#define  OFS_ecl2 (0x6062 + 0 * 2)
+#define MOD_ecl1 5
+#define BITS_ecl1 16
+#define  LEN_ecl1 0
+#define  OFS_ecl1 (0x6064 + 0 * 2)
+#define MOD_ecl0 5
+#define BITS_ecl0 16
+#define  LEN_ecl0 0
+#define  OFS_ecl0 (0x6066 + 0 * 2)
+#define MOD_nim4 5
+#define BITS_nim4 16
+#define  LEN_nim4 0
+#define  OFS_nim4 (0x6068 + 0 * 2)
+#define MOD_nim3 5
+#define BITS_nim3 16
+#define  LEN_nim3 0
+#define  OFS_nim3 (0x606a + 0 * 2)
+#define MOD_nim2 5
+#define BITS_nim2 16
+#define  LEN_nim2 0
+#define  OFS_nim2 (0x606c + 0 * 2)
+#define MOD_nim1 5
+#define BITS_nim1 16
+#define  LEN_nim1 0
+#define  OFS_nim1 (0x606e + 0 * 2)
+#define MOD_pulser_status 5
+#define BITS_pulser_status 16
+#define  LEN_pulser_status 0
+#define  OFS_pulser_status (0x6070 + 0 * 2)
+#define MOD_pulser_amplitude 5
+#define BITS_pulser_amplitude 16
+#define  LEN_pulser_amplitude 0
+#define  OFS_pulser_amplitude (0x6072 + 0 * 2)
+#define MOD_nim0 5
+#define BITS_nim0 16
+#define  LEN_nim0 0
+#define  OFS_nim0 (0x6074 + 0 * 2)
+#define MOD_monitor_on 5
+#define BITS_monitor_on 16
+#define  LEN_monitor_on 0
+#define  OFS_monitor_on (0x607a + 0 * 2)
+#define MOD_set_mon_channel 5
+#define BITS_set_mon_channel 16
+#define  LEN_set_mon_channel 0
+#define  OFS_set_mon_channel (0x607c + 0 * 2)
+#define MOD_set_wave 5
+#define BITS_set_wave 16
+#define  LEN_set_wave 0
+#define  OFS_set_wave (0x607e + 0 * 2)
+#define MOD_rc_busno 5
+#define BITS_rc_busno 16
+#define  LEN_rc_busno 0
+#define  OFS_rc_busno (0x6080 + 0 * 2)
+#define MOD_rc_modnum 5
+#define BITS_rc_modnum 16
+#define  LEN_rc_modnum 0
+#define  OFS_rc_modnum (0x6082 + 0 * 2)
+#define MOD_rc_opcode 5
+#define BITS_rc_opcode 16
+#define  LEN_rc_opcode 0
+#define  OFS_rc_opcode (0x6084 + 0 * 2)
+#define MOD_rc_adr 5
+#define BITS_rc_adr 16
+#define  LEN_rc_adr 0
+#define  OFS_rc_adr (0x6086 + 0 * 2)
+#define MOD_rc_dat 5
+#define BITS_rc_dat 16
+#define  LEN_rc_dat 0
+#define  OFS_rc_dat (0x6088 + 0 * 2)
+#define MOD_send_return_status 1
+#define BITS_send_return_status 16
+#define  LEN_send_return_status 0
+#define  OFS_send_return_status (0x608a + 0 * 2)
+#define MOD_reset_ctr_ab 5
+#define BITS_reset_ctr_ab 16
+#define  LEN_reset_ctr_ab 0
+#define  OFS_reset_ctr_ab (0x6090 + 0 * 2)
+#define MOD_evctr_lo 1
+#define BITS_evctr_lo 16
+#define  LEN_evctr_lo 0
+#define  OFS_evctr_lo (0x6092 + 0 * 2)
+#define MOD_evctr_hi 1
+#define BITS_evctr_hi 16
+#define  LEN_evctr_hi 0
+#define  OFS_evctr_hi (0x6094 + 0 * 2)
+#define MOD_ts_sources 5
+#define BITS_ts_sources 16
+#define  LEN_ts_sources 0
+#define  OFS_ts_sources (0x6096 + 0 * 2)
+#define MOD_ts_divisor 5
+#define BITS_ts_divisor 16
+#define  LEN_ts_divisor 0
+#define  OFS_ts_divisor (0x6098 + 0 * 2)
+#define MOD_ts_counter_lo 1
+#define BITS_ts_counter_lo 16
+#define  LEN_ts_counter_lo 0
+#define  OFS_ts_counter_lo (0x609c + 0 * 2)
+#define MOD_ts_counter_hi 1
+#define BITS_ts_counter_hi 16
+#define  LEN_ts_counter_hi 0
+#define  OFS_ts_counter_hi (0x609e + 0 * 2)
+#define MOD_time_0 1
+#define BITS_time_0 16
+#define  LEN_time_0 0
+#define  OFS_time_0 (0x60a8 + 0 * 2)
+#define MOD_time_1 1
+#define BITS_time_1 16
+#define  LEN_time_1 0
+#define  OFS_time_1 (0x60aa + 0 * 2)
+#define MOD_time_2 1
+#define BITS_time_2 16
+#define  LEN_time_2 0
+#define  OFS_time_2 (0x60ac + 0 * 2)
+#define MOD_stop_ctr 5
+#define BITS_stop_ctr 16
+#define  LEN_stop_ctr 0
+#define  OFS_stop_ctr (0x60ae + 0 * 2)
+#define MOD_high_limit0 5
+#define BITS_high_limit0 16
+#define  LEN_high_limit0 0
+#define  OFS_high_limit0 (0x60b0 + 0 * 2)
+#define MOD_low_limit0 5
+#define BITS_low_limit0 16
+#define  LEN_low_limit0 0
+#define  OFS_low_limit0 (0x60b2 + 0 * 2)
+#define MOD_select_chan_pair 5
+#define BITS_select_chan_pair 16
+#define  LEN_select_chan_pair 0
+#define  OFS_select_chan_pair (0x6100 + 0 * 2)
+#define MOD_tf_int_diff 5
+#define BITS_tf_int_diff 16
+#define  LEN_tf_int_diff 0
+#define  OFS_tf_int_diff (0x6110 + 0 * 2)
+#define MOD_pz0 5
+#define BITS_pz0 16
+#define  LEN_pz0 0
+#define  OFS_pz0 (0x6112 + 0 * 2)
+#define MOD_pz1 5
+#define BITS_pz1 16
+#define  LEN_pz1 0
+#define  OFS_pz1 (0x6114 + 0 * 2)
+#define MOD_gain 5
+#define BITS_gain 16
+#define  LEN_gain 0
+#define  OFS_gain (0x611a + 0 * 2)
+#define MOD_threshold0 5
+#define BITS_threshold0 16
+#define  LEN_threshold0 0
+#define  OFS_threshold0 (0x611c + 0 * 2)
+#define MOD_threshold1 5
+#define BITS_threshold1 16
+#define  LEN_threshold1 0
+#define  OFS_threshold1 (0x611e + 0 * 2)
+#define MOD_shaping_time 5
+#define BITS_shaping_time 16
+#define  LEN_shaping_time 0
+#define  OFS_shaping_time (0x6124 + 0 * 2)
+#define MOD_blr 5
+#define BITS_blr 16
+#define  LEN_blr 0
+#define  OFS_blr (0x6126 + 0 * 2)
+#define MOD_reset_time 5
+#define BITS_reset_time 16
+#define  LEN_reset_time 0
+#define  OFS_reset_time (0x6128 + 0 * 2)
+#define MOD_signal_rise_time 5
+#define BITS_signal_rise_time 16
+#define  LEN_signal_rise_time 0
+#define  OFS_signal_rise_time (0x612a + 0 * 2)
+#define MAP_SIZE 0x612c
+
+#endif
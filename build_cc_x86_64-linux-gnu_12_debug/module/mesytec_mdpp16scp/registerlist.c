@@ -0,0 +1,158 @@
+#include <stdlib.h>
+#include <module/reggen/registerlist.h>
+
+struct RegisterEntryClient const c_mesytec_mdpp16scp_register_list_client_[] = {
+	{0x00006000,  0, 16, "address_source"},
+	{0x00006002,  0, 16, "address_reg"},
+	{0x00006004,  0, 16, "module_id"},
+	{0x00006006,  0, 16, "fast_mblt"},
+	{0x00006008,  0, 16, "soft_reset"},
+	{0x0000600e,  0, 16, "firmware_revision"},
+	{0x00006010,  0, 16, "irq_level"},
+	{0x00006012,  0, 16, "irq_vector"},
+	{0x00006018,  0, 16, "irq_threshold"},
+	{0x0000601a,  0, 16, "max_transfer_data"},
+	{0x0000601c,  0, 16, "irq_source"},
+	{0x0000601e,  0, 16, "irq_event_threshold"},
+	{0x00006020,  0, 16, "cblt_mcst_control"},
+	{0x00006022,  0, 16, "cblt_address"},
+	{0x00006024,  0, 16, "mcst_address"},
+	{0x00006030,  0, 16, "buffer_data_length"},
+	{0x00006032,  0, 16, "data_len_format"},
+	{0x00006036,  0, 16, "multievent"},
+	{0x00006038,  0, 16, "marking_type"},
+	{0x0000603a,  0, 16, "start_acq"},
+	{0x0000603e,  0, 16, "data_ready"},
+	{0x00006042,  0, 16, "tdc_resolution"},
+	{0x00006044,  0, 16, "output_format"},
+	{0x00006046,  0, 16, "adc_resolution"},
+	{0x00006050,  0, 16, "win_start"},
+	{0x00006054,  0, 16, "win_width"},
+	{0x00006058,  0, 16, "trig_source"},
+	{0x0000605a,  0, 16, "trig_source_2"},
+	{0x0000605c,  0, 16, "first_hit"},
+	{0x0000605e,  0, 16, "trigger_output"},
+	{0x00006060,  0, 16, "ecl3"},
+	{0x00006062,  0, 16, "ecl2"},
+	{0x00006064,  0, 16, "ecl1"},
+	{0x00006066,  0, 16, "ecl0"},
+	{0x00006068,  0, 16, "nim4"},
+	{0x0000606a,  0, 16, "nim3"},
+	{0x0000606c,  0, 16, "nim2"},
+	{0x0000606e,  0, 16, "nim1"},
+	{0x00006070,  0, 16, "pulser_status"},
+	{0x00006072,  0, 16, "pulser_amplitude"},
+	{0x00006074,  0, 16, "nim0"},
+	{0x0000607a,  0, 16, "monitor_on"},
+	{0x0000607c,  0, 16, "set_mon_channel"},
+	{0x0000607e,  0, 16, "set_wave"},
+	{0x00006080,  0, 16, "rc_busno"},
+	{0x00006082,  0, 16, "rc_modnum"},
+	{0x00006084,  0, 16, "rc_opcode"},
+	{0x00006086,  0, 16, "rc_adr"},
+	{0x00006088,  0, 16, "rc_dat"},
+	{0x0000608a,  0, 16, "send_return_status"},
+	{0x00006090,  0, 16, "reset_ctr_ab"},
+	{0x00006092,  0, 16, "evctr_lo"},
+	{0x00006094,  0, 16, "evctr_hi"},
+	{0x00006096,  0, 16, "ts_sources"},
+	{0x00006098,  0, 16, "ts_divisor"},
+	{0x0000609c,  0, 16, "ts_counter_lo"},
+	{0x0000609e,  0, 16, "ts_counter_hi"},
+	{0x000060a8,  0, 16, "time_0"},
+	{0x000060aa,  0, 16, "time_1"},
+	{0x000060ac,  0, 16, "time_2"},
+	{0x000060ae,  0, 16, "stop_ctr"},
+	{0x000060b0,  0, 16, "high_limit0"},
+	{0x000060b2,  0, 16, "low_limit0"},
+	{0x00006100,  0, 16, "select_chan_pair"},
+	{0x00006110,  0, 16, "tf_int_diff"},
+	{0x00006112,  0, 16, "pz0"},
+	{0x00006114,  0, 16, "pz1"},
+	{0x0000611a,  0, 16, "gain"},
+	{0x0000611c,  0, 16, "threshold0"},
+	{0x0000611e,  0, 16, "threshold1"},
+	{0x00006124,  0, 16, "shaping_time"},
+	{0x00006126,  0, 16, "blr"},
+	{0x00006128,  0, 16, "reset_time"},
+	{0x0000612a,  0, 16, "signal_rise_time"},
+	{0x00000000,  0,  0, NULL}
+};
+
+struct RegisterEntryServer const c_mesytec_mdpp16scp_register_list_server_[] = {
+	{0x00006000,  0, 16, 2},
+	{0x00006002,  0, 16, 2},
+	{0x00006004,  0, 16, 2},
+	{0x00006006,  0, 16, 2},
+	{0x00006008,  0, 16, 2},
+	{0x0000600e,  0, 16, 2},
+	{0x00006010,  0, 16, 2},
+	{0x00006012,  0, 16, 2},
+	{0x00006018,  0, 16, 2},
+	{0x0000601a,  0, 16, 2},
+	{0x0000601c,  0, 16, 2},
+	{0x0000601e,  0, 16, 2},
+	{0x00006020,  0, 16, 2},
+	{0x00006022,  0, 16, 2},
+	{0x00006024,  0, 16, 2},
+	{0x00006030,  0, 16, 2},
+	{0x00006032,  0, 16, 2},
+	{0x00006036,  0, 16, 2},
+	{0x00006038,  0, 16, 2},
+	{0x0000603a,  0, 16, 2},
+	{0x0000603e,  0, 16, 2},
+	{0x00006042,  0, 16, 2},
+	{0x00006044,  0, 16, 2},
+	{0x00006046,  0, 16, 2},
+	{0x00006050,  0, 16, 2},
+	{0x00006054,  0, 16, 2},
+	{0x00006058,  0, 16, 2},
+	{0x0000605a,  0, 16, 2},
+	{0x0000605c,  0, 16, 2},
+	{0x0000605e,  0, 16, 2},
+	{0x00006060,  0, 16, 2},
+	{0x00006062,  0, 16, 2},
+	{0x00006064,  0, 16, 2},
+	{0x00006066,  0, 16, 2},
+	{0x00006068,  0, 16, 2},
+	{0x0000606a,  0, 16, 2},
+	{0x0000606c,  0, 16, 2},
+	{0x0000606e,  0, 16, 2},
+	{0x00006070,  0, 16, 2},
+	{0x00006072,  0, 16, 2},
+	{0x00006074,  0, 16, 2},
+	{0x0000607a,  0, 16, 2},
+	{0x0000607c,  0, 16, 2},
+	{0x0000607e,  0, 16, 2},
+	{0x00006080,  0, 16, 2},
+	{0x00006082,  0, 16, 2},
+	{0x00006084,  0, 16, 2},
+	{0x00006086,  0, 16, 2},
+	{0x00006088,  0, 16, 2},
+	{0x0000608a,  0, 16, 2},
+	{0x00006090,  0, 16, 2},
+	{0x00006092,  0, 16, 2},
+	{0x00006094,  0, 16, 2},
+	{0x00006096,  0, 16, 2},
+	{0x00006098,  0, 16, 2},
+	{0x0000609c,  0, 16, 2},
+	{0x0000609e,  0, 16, 2},
+	{0x000060a8,  0, 16, 2},
+	{0x000060aa,  0, 16, 2},
+	{0x000060ac,  0, 16, 2},
+	{0x000060ae,  0, 16, 2},
+	{0x000060b0,  0, 16, 2},
+	{0x000060b2,  0, 16, 2},
+	{0x00006100,  0, 16, 2},
+	{0x00006110,  0, 16, 2},
+	{0x00006112,  0, 16, 2},
+	{0x00006114,  0, 16, 2},
+	{0x0000611a,  0, 16, 2},
+	{0x0000611c,  0, 16, 2},
+	{0x0000611e,  0, 16, 2},
+	{0x00006124,  0, 16, 2},
+	{0x00006126,  0, 16, 2},
+	{0x00006128,  0, 16, 2},
+	{0x0000612a,  0, 16, 2},
+	{0x00000000,  0,  0, 0}
+};
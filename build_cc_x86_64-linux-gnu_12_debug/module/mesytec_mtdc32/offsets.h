@@ -0,0 +1,266 @@
+#ifndef MODULE_MESYTEC_MTDC32_OFFSETS_H
+#define MODULE_MESYTEC_MTDC32_OFFSETS_H
+
+#define MOD_data_fifo(i) 6
+#define BITS_data_fifo(i) 32
+#define  LEN_data_fifo(i) 1
+#define  OFS_data_fifo(i) (0x0 + i * 4)
+#define MOD_address_source 5
+#define BITS_address_source 16
+#define  LEN_address_source 0
+#define  OFS_address_source (0x6000 + 0 * 2)
+#define MOD_address_reg 5
+#define BITS_address_reg 16
+#define  LEN_address_reg 0
+#define  OFS_address_reg (0x6002 + 0 * 2)
+#define MOD_module_id 5
+#define BITS_module_id 16
+#define  LEN_module_id 0
+#define  OFS_module_id (0x6004 + 0 * 2)
+#define MOD_soft_reset 4
+#define BITS_soft_reset 16
+#define  LEN_soft_reset 0
+#define  OFS_soft_reset (0x6008 + 0 * 2)
+#define MOD_firmware_revision 1
+#define BITS_firmware_revision 16
+#define  LEN_firmware_revision 0
+#define  OFS_firmware_revision (0x600e + 0 * 2)
+#define MOD_irq_level 5
+#define BITS_irq_level 16
+#define  LEN_irq_level 0
+#define  OFS_irq_level (0x6010 + 0 * 2)
+#define MOD_irq_vector 5
+#define BITS_irq_vector 16
+#define  LEN_irq_vector 0
+#define  OFS_irq_vector (0x6012 + 0 * 2)
+#define MOD_irq_test 4
+#define BITS_irq_test 16
+#define  LEN_irq_test 0
+#define  OFS_irq_test (0x6014 + 0 * 2)
+#define MOD_irq_reset 4
+#define BITS_irq_reset 16
+#define  LEN_irq_reset 0
+#define  OFS_irq_reset (0x6016 + 0 * 2)
+#define MOD_irq_threshold 5
+#define BITS_irq_threshold 16
+#define  LEN_irq_threshold 0
+#define  OFS_irq_threshold (0x6018 + 0 * 2)
+#define MOD_max_transfer_data 5
+#define BITS_max_transfer_data 16
+#define  LEN_max_transfer_data 0
+#define  OFS_max_transfer_data (0x601a + 0 * 2)
+#define MOD_withdraw_irq 5
+#define BITS_withdraw_irq 16
+#define  LEN_withdraw_irq 0
+#define  OFS_withdraw_irq (0x601c + 0 * 2)
+#define MOD_cblt_mcst_control 5
+#define BITS_cblt_mcst_control 16
+#define  LEN_cblt_mcst_control 0
+#define  OFS_cblt_mcst_control (0x6020 + 0 * 2)
+#define MOD_cblt_address 5
+#define BITS_cblt_address 16
+#define  LEN_cblt_address 0
+#define  OFS_cblt_address (0x6022 + 0 * 2)
+#define MOD_mcst_address 1
+#define BITS_mcst_address 16
+#define  LEN_mcst_address 0
+#define  OFS_mcst_address (0x6024 + 0 * 2)
+#define MOD_buffer_data_length 1
+#define BITS_buffer_data_length 16
+#define  LEN_buffer_data_length 0
+#define  OFS_buffer_data_length (0x6030 + 0 * 2)
+#define MOD_data_len_format 5
+#define BITS_data_len_format 16
+#define  LEN_data_len_format 0
+#define  OFS_data_len_format (0x6032 + 0 * 2)
+#define MOD_readout_reset 4
+#define BITS_readout_reset 16
+#define  LEN_readout_reset 0
+#define  OFS_readout_reset (0x6034 + 0 * 2)
+#define MOD_multi_event 5
+#define BITS_multi_event 16
+#define  LEN_multi_event 0
+#define  OFS_multi_event (0x6036 + 0 * 2)
+#define MOD_marking_type 5
+#define BITS_marking_type 16
+#define  LEN_marking_type 0
+#define  OFS_marking_type (0x6038 + 0 * 2)
+#define MOD_start_acq 5
+#define BITS_start_acq 16
+#define  LEN_start_acq 0
+#define  OFS_start_acq (0x603a + 0 * 2)
+#define MOD_fifo_reset 4
+#define BITS_fifo_reset 16
+#define  LEN_fifo_reset 0
+#define  OFS_fifo_reset (0x603c + 0 * 2)
+#define MOD_data_ready 1
+#define BITS_data_ready 16
+#define  LEN_data_ready 0
+#define  OFS_data_ready (0x603e + 0 * 2)
+#define MOD_bank_operation 5
+#define BITS_bank_operation 16
+#define  LEN_bank_operation 0
+#define  OFS_bank_operation (0x6040 + 0 * 2)
+#define MOD_tdc_resolution 5
+#define BITS_tdc_resolution 16
+#define  LEN_tdc_resolution 0
+#define  OFS_tdc_resolution (0x6042 + 0 * 2)
+#define MOD_output_format 5
+#define BITS_output_format 16
+#define  LEN_output_format 0
+#define  OFS_output_format (0x6044 + 0 * 2)
+#define MOD_bank0_win_start 5
+#define BITS_bank0_win_start 16
+#define  LEN_bank0_win_start 0
+#define  OFS_bank0_win_start (0x6050 + 0 * 2)
+#define MOD_bank1_win_start 5
+#define BITS_bank1_win_start 16
+#define  LEN_bank1_win_start 0
+#define  OFS_bank1_win_start (0x6052 + 0 * 2)
+#define MOD_bank0_win_width 5
+#define BITS_bank0_win_width 16
+#define  LEN_bank0_win_width 0
+#define  OFS_bank0_win_width (0x6054 + 0 * 2)
+#define MOD_bank1_win_width 5
+#define BITS_bank1_win_width 16
+#define  LEN_bank1_win_width 0
+#define  OFS_bank1_win_width (0x6056 + 0 * 2)
+#define MOD_bank0_trig_source 5
+#define BITS_bank0_trig_source 16
+#define  LEN_bank0_trig_source 0
+#define  OFS_bank0_trig_source (0x6058 + 0 * 2)
+#define MOD_bank1_trig_source 5
+#define BITS_bank1_trig_source 16
+#define  LEN_bank1_trig_source 0
+#define  OFS_bank1_trig_source (0x605a + 0 * 2)
+#define MOD_first_hit 5
+#define BITS_first_hit 16
+#define  LEN_first_hit 0
+#define  OFS_first_hit (0x605c + 0 * 2)
+#define MOD_negative_edge 5
+#define BITS_negative_edge 16
+#define  LEN_negative_edge 0
+#define  OFS_negative_edge (0x6060 + 0 * 2)
+#define MOD_ecl_term 5
+#define BITS_ecl_term 16
+#define  LEN_ecl_term 0
+#define  OFS_ecl_term (0x6062 + 0 * 2)
+#define MOD_ecl_trig1_osc 5
+#define BITS_ecl_trig1_osc 16
+#define  LEN_ecl_trig1_osc 0
+#define  OFS_ecl_trig1_osc (0x6064 + 0 * 2)
+#define MOD_trig_select 5
+#define BITS_trig_select 16
+#define  LEN_trig_select 0
+#define  OFS_trig_select (0x6068 + 0 * 2)
+#define MOD_nim_trig1_osc 5
+#define BITS_nim_trig1_osc 16
+#define  LEN_nim_trig1_osc 0
+#define  OFS_nim_trig1_osc (0x606a + 0 * 2)
+#define MOD_nim_busy 5
+#define BITS_nim_busy 16
+#define  LEN_nim_busy 0
+#define  OFS_nim_busy (0x606e + 0 * 2)
+#define MOD_pulser_status 5
+#define BITS_pulser_status 16
+#define  LEN_pulser_status 0
+#define  OFS_pulser_status (0x6070 + 0 * 2)
+#define MOD_pulser_pattern 5
+#define BITS_pulser_pattern 16
+#define  LEN_pulser_pattern 0
+#define  OFS_pulser_pattern (0x6072 + 0 * 2)
+#define MOD_bank0_input_thr 5
+#define BITS_bank0_input_thr 16
+#define  LEN_bank0_input_thr 0
+#define  OFS_bank0_input_thr (0x6078 + 0 * 2)
+#define MOD_bank1_input_thr 5
+#define BITS_bank1_input_thr 16
+#define  LEN_bank1_input_thr 0
+#define  OFS_bank1_input_thr (0x607a + 0 * 2)
+#define MOD_rc_busno 5
+#define BITS_rc_busno 16
+#define  LEN_rc_busno 0
+#define  OFS_rc_busno (0x6080 + 0 * 2)
+#define MOD_rc_modnum 5
+#define BITS_rc_modnum 16
+#define  LEN_rc_modnum 0
+#define  OFS_rc_modnum (0x6082 + 0 * 2)
+#define MOD_rc_opcode 5
+#define BITS_rc_opcode 16
+#define  LEN_rc_opcode 0
+#define  OFS_rc_opcode (0x6084 + 0 * 2)
+#define MOD_rc_adr 5
+#define BITS_rc_adr 16
+#define  LEN_rc_adr 0
+#define  OFS_rc_adr (0x6086 + 0 * 2)
+#define MOD_rc_dat 5
+#define BITS_rc_dat 16
+#define  LEN_rc_dat 0
+#define  OFS_rc_dat (0x6088 + 0 * 2)
+#define MOD_send_return_status 1
+#define BITS_send_return_status 16
+#define  LEN_send_return_status 0
+#define  OFS_send_return_status (0x608a + 0 * 2)
+#define MOD_reset_ctr_ab 5
+#define BITS_reset_ctr_ab 16
+#define  LEN_reset_ctr_ab 0
+#define  OFS_reset_ctr_ab (0x6090 + 0 * 2)
+#define MOD_evctr_lo 1
+#define BITS_evctr_lo 16
+#define  LEN_evctr_lo 0
+#define  OFS_evctr_lo (0x6092 + 0 * 2)
+#define MOD_evctr_hi 1
+#define BITS_evctr_hi 16
+#define  LEN_evctr_hi 0
+#define  OFS_evctr_hi (0x6094 + 0 * 2)
+#define MOD_ts_sources 5
+#define BITS_ts_sources 16
+#define  LEN_ts_sources 0
+#define  OFS_ts_sources (0x6096 + 0 * 2)
+#define MOD_ts_divisor 5
+#define BITS_ts_divisor 16
+#define  LEN_ts_divisor 0
+#define  OFS_ts_divisor (0x6098 + 0 * 2)
+#define MOD_ts_counter_lo 1
+#define BITS_ts_counter_lo 16
+#define  LEN_ts_counter_lo 0
+#define  OFS_ts_counter_lo (0x609c + 0 * 2)
+#define MOD_ts_counter_hi 1
+#define BITS_ts_counter_hi 16
+#define  LEN_ts_counter_hi 0
+#define  OFS_ts_counter_hi (0x609e + 0 * 2)
+#define MOD_time_0 1
+#define BITS_time_0 16
+#define  LEN_time_0 0
+#define  OFS_time_0 (0x60a8 + 0 * 2)
+#define MOD_time_1 1
+#define BITS_time_1 16
+#define  LEN_time_1 0
+#define  OFS_time_1 (0x60aa + 0 * 2)
+#define MOD_time_2 1
+#define BITS_time_2 16
+#define  LEN_time_2 0
+#define  OFS_time_2 (0x60ac + 0 * 2)
+#define MOD_stop_ctr 5
+#define BITS_stop_ctr 16
+#define  LEN_stop_ctr 0
+#define  OFS_stop_ctr (0x60ae + 0 * 2)
+#define MOD_high_limit0 5
+#define BITS_high_limit0 16
+#define  LEN_high_limit0 0
+#define  OFS_high_limit0 (0x60b0 + 0 * 2)
+#define MOD_low_limit0 5
+#define BITS_low_limit0 16
+#define  LEN_low_limit0 0
+#define  OFS_low_limit0 (0x60b2 + 0 * 2)
+#define MOD_high_limit1 5
+#define BITS_high_limit1 16
+#define  LEN_high_limit1 0
+#define  OFS_high_limit1 (0x60b4 + 0 * 2)
+#define MOD_low_limit1 5
+#define BITS_low_limit1 16
+#define  LEN_low_limit1 0
+#define  OFS_low_limit1 (0x60b6 + 0 * 2)
+#define MAP_SIZE 0x60b8
+
+#endif
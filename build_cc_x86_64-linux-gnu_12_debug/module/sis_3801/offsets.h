@@ -0,0 +1,74 @@
+#ifndef MODULE_SIS_3801_OFFSETS_H
+#define MODULE_SIS_3801_OFFSETS_H
+
+#define MOD_status 1
+#define BITS_status 32
+#define  LEN_status 0
+#define  OFS_status (0x0 + 0 * 4)
+#define MOD_control 4
+#define BITS_control 32
+#define  LEN_control 0
+#define  OFS_control (0x0 + 0 * 4)
+#define MOD_id_and_irq 5
+#define BITS_id_and_irq 32
+#define  LEN_id_and_irq 0
+#define  OFS_id_and_irq (0x4 + 0 * 4)
+#define MOD_copy_disable 4
+#define BITS_copy_disable 32
+#define  LEN_copy_disable 0
+#define  OFS_copy_disable (0xc + 0 * 4)
+#define MOD_fifo_write 4
+#define BITS_fifo_write 32
+#define  LEN_fifo_write 0
+#define  OFS_fifo_write (0x10 + 0 * 4)
+#define MOD_clear 4
+#define BITS_clear 32
+#define  LEN_clear 0
+#define  OFS_clear (0x20 + 0 * 4)
+#define MOD_next_clock 4
+#define BITS_next_clock 32
+#define  LEN_next_clock 0
+#define  OFS_next_clock (0x24 + 0 * 4)
+#define MOD_enable_next_clock_logic 4
+#define BITS_enable_next_clock_logic 32
+#define  LEN_enable_next_clock_logic 0
+#define  OFS_enable_next_clock_logic (0x28 + 0 * 4)
+#define MOD_disable_next_clock_logic 4
+#define BITS_disable_next_clock_logic 32
+#define  LEN_disable_next_clock_logic 0
+#define  OFS_disable_next_clock_logic (0x2c + 0 * 4)
+#define MOD_enable_pulser 4
+#define BITS_enable_pulser 32
+#define  LEN_enable_pulser 0
+#define  OFS_enable_pulser (0x50 + 0 * 4)
+#define MOD_disable_pulser 4
+#define BITS_disable_pulser 32
+#define  LEN_disable_pulser 0
+#define  OFS_disable_pulser (0x54 + 0 * 4)
+#define MOD_enable_roak 4
+#define BITS_enable_roak 32
+#define  LEN_enable_roak 0
+#define  OFS_enable_roak (0x58 + 0 * 4)
+#define MOD_enable_rora 4
+#define BITS_enable_rora 32
+#define  LEN_enable_rora 0
+#define  OFS_enable_rora (0x5c + 0 * 4)
+#define MOD_reset 4
+#define BITS_reset 32
+#define  LEN_reset 0
+#define  OFS_reset (0x60 + 0 * 4)
+#define MOD_test_pulse 4
+#define BITS_test_pulse 32
+#define  LEN_test_pulse 0
+#define  OFS_test_pulse (0x68 + 0 * 4)
+#define MOD_prescaler_factor 5
+#define BITS_prescaler_factor 32
+#define  LEN_prescaler_factor 0
+#define  OFS_prescaler_factor (0x80 + 0 * 4)
+#define MOD_fifo(i) 2
+#define BITS_fifo(i) 32
+#define  LEN_fifo(i) 1
+#define  OFS_fifo(i) (0x100 + i * 4)
+#define MAP_SIZE 0x104
+
+#endif
@@ -0,0 +1,16 @@
+#include <stdlib.h>
+#include <module/reggen/registerlist.h>
+
+struct RegisterEntryClient const c_sis_3801_register_list_client_[] = {
+	{0x00000000,  0, 32, "status"},
+	{0x00000004,  0, 32, "id_and_irq"},
+	{0x00000080,  0, 32, "prescaler_factor"},
+	{0x00000000,  0,  0, NULL}
+};
+
+struct RegisterEntryServer const c_sis_3801_register_list_server_[] = {
+	{0x00000000,  0, 32, 4},
+	{0x00000004,  0, 32, 4},
+	{0x00000080,  0, 32, 4},
+	{0x00000000,  0,  0, 0}
+};
@@ -0,0 +1,38 @@
+#ifndef MODULE_SIS_3820_OFFSETS_H
+#define MODULE_SIS_3820_OFFSETS_H
+
+#define MOD_control_status 5
+#define BITS_control_status 32
+#define  LEN_control_status 0
+#define  OFS_control_status (0x0 + 0 * 4)
+#define MOD_module_id_firmware 5
+#define BITS_module_id_firmware 32
+#define  LEN_module_id_firmware 0
+#define  OFS_module_id_firmware (0x4 + 0 * 4)
+#define MOD_clock_source 5
+#define BITS_clock_source 32
+#define  LEN_clock_source 0
+#define  OFS_clock_source (0x10 + 0 * 4)
+#define MOD_clock_frequency 5
+#define BITS_clock_frequency 32
+#define  LEN_clock_frequency 0
+#define  OFS_clock_frequency (0x14 + 0 * 4)
+#define MOD_reset 4
+#define BITS_reset 32
+#define  LEN_reset 0
+#define  OFS_reset (0x60 + 0 * 4)
+#define MOD_clock_test 4
+#define BITS_clock_test 32
+#define  LEN_clock_test 0
+#define  OFS_clock_test (0x64 + 0 * 4)
+#define MOD_strobe_1 4
+#define BITS_strobe_1 32
+#define  LEN_strobe_1 0
+#define  OFS_strobe_1 (0x68 + 0 * 4)
+#define MOD_strobe_2 4
+#define BITS_strobe_2 32
+#define  LEN_strobe_2 0
+#define  OFS_strobe_2 (0x6c + 0 * 4)
+#define MAP_SIZE 0x70
+
+#endif
@@ -0,0 +1,18 @@
+#include <stdlib.h>
+#include <module/reggen/registerlist.h>
+
+struct RegisterEntryClient const c_sis_3820_register_list_client_[] = {
+	{0x00000000,  0, 32, "control_status"},
+	{0x00000004,  0, 32, "module_id_firmware"},
+	{0x00000010,  0, 32, "clock_source"},
+	{0x00000014,  0, 32, "clock_frequency"},
+	{0x00000000,  0,  0, NULL}
+};
+
+struct RegisterEntryServer const c_sis_3820_register_list_server_[] = {
+	{0x00000000,  0, 32, 4},
+	{0x00000004,  0, 32, 4},
+	{0x00000010,  0, 32, 4},
+	{0x00000014,  0, 32, 4},
+	{0x00000000,  0,  0, 0}
+};
@@ -0,0 +1,162 @@
+#ifndef MODULE_SIS_3820_SCALER_OFFSETS_H
+#define MODULE_SIS_3820_SCALER_OFFSETS_H
+
+#define MOD_control_status 5
+#define BITS_control_status 32
+#define  LEN_control_status 0
+#define  OFS_control_status (0x0 + 0 * 4)
+#define MOD_id_and_firmware 1
+#define BITS_id_and_firmware 32
+#define  LEN_id_and_firmware 0
+#define  OFS_id_and_firmware (0x4 + 0 * 4)
+#define MOD_irq_conf 5
+#define BITS_irq_conf 32
+#define  LEN_irq_conf 0
+#define  OFS_irq_conf (0x8 + 0 * 4)
+#define MOD_irq_control_status 5
+#define BITS_irq_control_status 32
+#define  LEN_irq_control_status 0
+#define  OFS_irq_control_status (0xc + 0 * 4)
+#define MOD_acq_preset 5
+#define BITS_acq_preset 32
+#define  LEN_acq_preset 0
+#define  OFS_acq_preset (0x10 + 0 * 4)
+#define MOD_acq_count 1
+#define BITS_acq_count 32
+#define  LEN_acq_count 0
+#define  OFS_acq_count (0x14 + 0 * 4)
+#define MOD_lne_prescale_factor 5
+#define BITS_lne_prescale_factor 32
+#define  LEN_lne_prescale_factor 0
+#define  OFS_lne_prescale_factor (0x18 + 0 * 4)
+#define MOD_preset_val_group1 5
+#define BITS_preset_val_group1 32
+#define  LEN_preset_val_group1 0
+#define  OFS_preset_val_group1 (0x20 + 0 * 4)
+#define MOD_preset_val_group2 5
+#define BITS_preset_val_group2 32
+#define  LEN_preset_val_group2 0
+#define  OFS_preset_val_group2 (0x24 + 0 * 4)
+#define MOD_preset_enable_hit 5
+#define BITS_preset_enable_hit 32
+#define  LEN_preset_enable_hit 0
+#define  OFS_preset_enable_hit (0x28 + 0 * 4)
+#define MOD_cblt_broadcast_setup 5
+#define BITS_cblt_broadcast_setup 32
+#define  LEN_cblt_broadcast_setup 0
+#define  OFS_cblt_broadcast_setup (0x30 + 0 * 4)
+#define MOD_sdram_page 5
+#define BITS_sdram_page 32
+#define  LEN_sdram_page 0
+#define  OFS_sdram_page (0x34 + 0 * 4)
+#define MOD_fifo_word_count 1
+#define BITS_fifo_word_count 32
+#define  LEN_fifo_word_count 0
+#define  OFS_fifo_word_count (0x38 + 0 * 4)
+#define MOD_fifo_word_count_thrs 5
+#define BITS_fifo_word_count_thrs 32
+#define  LEN_fifo_word_count_thrs 0
+#define  OFS_fifo_word_count_thrs (0x3c + 0 * 4)
+#define MOD_hiscal_start_preset 5
+#define BITS_hiscal_start_preset 32
+#define  LEN_hiscal_start_preset 0
+#define  OFS_hiscal_start_preset (0x40 + 0 * 4)
+#define MOD_hiscal_start_counter 1
+#define BITS_hiscal_start_counter 32
+#define  LEN_hiscal_start_counter 0
+#define  OFS_hiscal_start_counter (0x44 + 0 * 4)
+#define MOD_hiscal_last_acq_counter 1
+#define BITS_hiscal_last_acq_counter 32
+#define  LEN_hiscal_last_acq_counter 0
+#define  OFS_hiscal_last_acq_counter (0x48 + 0 * 4)
+#define MOD_op_mode 5
+#define BITS_op_mode 32
+#define  LEN_op_mode 0
+#define  OFS_op_mode (0x100 + 0 * 4)
+#define MOD_copy_disable 5
+#define BITS_copy_disable 32
+#define  LEN_copy_disable 0
+#define  OFS_copy_disable (0x104 + 0 * 4)
+#define MOD_lne_ch_select 5
+#define BITS_lne_ch_select 32
+#define  LEN_lne_ch_select 0
+#define  OFS_lne_ch_select (0x108 + 0 * 4)
+#define MOD_preset_ch_select 5
+#define BITS_preset_ch_select 32
+#define  LEN_preset_ch_select 0
+#define  OFS_preset_ch_select (0x10c + 0 * 4)
+#define MOD_mux_out_ch_select 5
+#define BITS_mux_out_ch_select 32
+#define  LEN_mux_out_ch_select 0
+#define  OFS_mux_out_ch_select (0x110 + 0 * 4)
+#define MOD_inhibit_count_disable 5
+#define BITS_inhibit_count_disable 32
+#define  LEN_inhibit_count_disable 0
+#define  OFS_inhibit_count_disable (0x200 + 0 * 4)
+#define MOD_counter_clear 4
+#define BITS_counter_clear 32
+#define  LEN_counter_clear 0
+#define  OFS_counter_clear (0x204 + 0 * 4)
+#define MOD_counter_ov_read_clear 5
+#define BITS_counter_ov_read_clear 32
+#define  LEN_counter_ov_read_clear 0
+#define  OFS_counter_ov_read_clear (0x208 + 0 * 4)
+#define MOD_ch_1_17_bits_33_48 1
+#define BITS_ch_1_17_bits_33_48 32
+#define  LEN_ch_1_17_bits_33_48 0
+#define  OFS_ch_1_17_bits_33_48 (0x210 + 0 * 4)
+#define MOD_veto_ext_count_inh 5
+#define BITS_veto_ext_count_inh 32
+#define  LEN_veto_ext_count_inh 0
+#define  OFS_veto_ext_count_inh (0x214 + 0 * 4)
+#define MOD_test_pulse_mask 5
+#define BITS_test_pulse_mask 32
+#define  LEN_test_pulse_mask 0
+#define  OFS_test_pulse_mask (0x218 + 0 * 4)
+#define MOD_key_reset 4
+#define BITS_key_reset 32
+#define  LEN_key_reset 0
+#define  OFS_key_reset (0x400 + 0 * 4)
+#define MOD_key_sdram_fifo_reset 4
+#define BITS_key_sdram_fifo_reset 32
+#define  LEN_key_sdram_fifo_reset 0
+#define  OFS_key_sdram_fifo_reset (0x404 + 0 * 4)
+#define MOD_key_test_pulse 4
+#define BITS_key_test_pulse 32
+#define  LEN_key_test_pulse 0
+#define  OFS_key_test_pulse (0x408 + 0 * 4)
+#define MOD_key_counter_clear 4
+#define BITS_key_counter_clear 32
+#define  LEN_key_counter_clear 0
+#define  OFS_key_counter_clear (0x40c + 0 * 4)
+#define MOD_key_vme_shadow 4
+#define BITS_key_vme_shadow 32
+#define  LEN_key_vme_shadow 0
+#define  OFS_key_vme_shadow (0x410 + 0 * 4)
+#define MOD_key_op_arm 4
+#define BITS_key_op_arm 32
+#define  LEN_key_op_arm 0
+#define  OFS_key_op_arm (0x414 + 0 * 4)
+#define MOD_key_op_enable 4
+#define BITS_key_op_enable 32
+#define  LEN_key_op_enable 0
+#define  OFS_key_op_enable (0x418 + 0 * 4)
+#define MOD_key_op_disable 4
+#define BITS_key_op_disable 32
+#define  LEN_key_op_disable 0
+#define  OFS_key_op_disable (0x41c + 0 * 4)
+#define MOD_shadow_register(i) 2
+#define BITS_shadow_register(i) 32
+#define  LEN_shadow_register(i) 32
+#define  OFS_shadow_register(i) (0x800 + i * 4)
+#define MOD_counter_register(i) 2
+#define BITS_counter_register(i) 32
+#define  LEN_counter_register(i) 32
+#define  OFS_counter_register(i) (0xa00 + i * 4)
+#define MOD_fifo 6
+#define BITS_fifo 32
+#define  LEN_fifo 0
+#define  OFS_fifo (0x800000 + 0 * 4)
+#define MAP_SIZE 0x800004
+
+#endif
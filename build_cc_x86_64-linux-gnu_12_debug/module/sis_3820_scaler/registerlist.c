@@ -0,0 +1,64 @@
+#include <stdlib.h>
+#include <module/reggen/registerlist.h>
+
+struct RegisterEntryClient const c_sis_3820_scaler_register_list_client_[] = {
+	{0x00000000,  0, 32, "control_status"},
+	{0x00000004,  0, 32, "id_and_firmware"},
+	{0x00000008,  0, 32, "irq_conf"},
+	{0x0000000c,  0, 32, "irq_control_status"},
+	{0x00000010,  0, 32, "acq_preset"},
+	{0x00000014,  0, 32, "acq_count"},
+	{0x00000018,  0, 32, "lne_prescale_factor"},
+	{0x00000020,  0, 32, "preset_val_group1"},
+	{0x00000024,  0, 32, "preset_val_group2"},
+	{0x00000028,  0, 32, "preset_enable_hit"},
+	{0x00000030,  0, 32, "cblt_broadcast_setup"},
+	{0x00000034,  0, 32, "sdram_page"},
+	{0x00000038,  0, 32, "fifo_word_count"},
+	{0x0000003c,  0, 32, "fifo_word_count_thrs"},
+	{0x00000040,  0, 32, "hiscal_start_preset"},
+	{0x00000044,  0, 32, "hiscal_start_counter"},
+	{0x00000048,  0, 32, "hiscal_last_acq_counter"},
+	{0x00000100,  0, 32, "op_mode"},
+	{0x00000104,  0, 32, "copy_disable"},
+	{0x00000108,  0, 32, "lne_ch_select"},
+	{0x0000010c,  0, 32, "preset_ch_select"},
+	{0x00000110,  0, 32, "mux_out_ch_select"},
+	{0x00000200,  0, 32, "inhibit_count_disable"},
+	{0x00000208,  0, 32, "counter_ov_read_clear"},
+	{0x00000210,  0, 32, "ch_1_17_bits_33_48"},
+	{0x00000214,  0, 32, "veto_ext_count_inh"},
+	{0x00000218,  0, 32, "test_pulse_mask"},
+	{0x00000000,  0,  0, NULL}
+};
+
+struct RegisterEntryServer const c_sis_3820_scaler_register_list_server_[] = {
+	{0x00000000,  0, 32, 4},
+	{0x00000004,  0, 32, 4},
+	{0x00000008,  0, 32, 4},
+	{0x0000000c,  0, 32, 4},
+	{0x00000010,  0, 32, 4},
+	{0x00000014,  0, 32, 4},
+	{0x00000018,  0, 32, 4},
+	{0x00000020,  0, 32, 4},
+	{0x00000024,  0, 32, 4},
+	{0x00000028,  0, 32, 4},
+	{0x00000030,  0, 32, 4},
+	{0x00000034,  0, 32, 4},
+	{0x00000038,  0, 32, 4},
+	{0x0000003c,  0, 32, 4},
+	{0x00000040,  0, 32, 4},
+	{0x00000044,  0, 32, 4},
+	{0x00000048,  0, 32, 4},
+	{0x00000100,  0, 32, 4},
+	{0x00000104,  0, 32, 4},
+	{0x00000108,  0, 32, 4},
+	{0x0000010c,  0, 32, 4},
+	{0x00000110,  0, 32, 4},
+	{0x00000200,  0, 32, 4},
+	{0x00000208,  0, 32, 4},
+	{0x00000210,  0, 32, 4},
+	{0x00000214,  0, 32, 4},
+	{0x00000218,  0, 32, 4},
+	{0x00000000,  0,  0, 0}
+};
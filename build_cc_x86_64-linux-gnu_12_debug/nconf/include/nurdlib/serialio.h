@@ -0,0 +1,4 @@
+#ifndef NCONF_INCLUDE_NURDLIB_SERIALIO_H
+#define NCONF_INCLUDE_NURDLIB_SERIALIO_H
+	#define NCONF_mSERIALIO_bMFENCE 1
+#endif
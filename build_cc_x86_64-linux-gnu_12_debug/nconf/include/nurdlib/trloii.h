@@ -0,0 +1,6 @@
+#ifndef NCONF_INCLUDE_NURDLIB_TRLOII_H
+#define NCONF_INCLUDE_NURDLIB_TRLOII_H
+	#define NCONF_mTRIDI_bNO 1
+	#define NCONF_mVULOM4_bNO 1
+	#define NCONF_mRFX1_bNO 1
+#endif
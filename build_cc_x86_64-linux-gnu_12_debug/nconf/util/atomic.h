@@ -0,0 +1,4 @@
+#ifndef NCONF_UTIL_ATOMIC_H
+#define NCONF_UTIL_ATOMIC_H
+	#define NCONF_mATOMIC_bGCC_ATOMIC 1
+#endif
@@ -0,0 +1,7 @@
+#ifndef NCONF_UTIL_COMPILER_H
+#define NCONF_UTIL_COMPILER_H
+	#define NCONF_mWEXTRA_bWEXTRA 1
+	#define NCONF_mWSTRICT_ALIASING_bYES 1
+	#define NCONF_mWSTRICT_OVERFLOW_bYES 1
+	#define NCONF_mQUNUSED_ARGUMENTS_bNO 1
+#endif
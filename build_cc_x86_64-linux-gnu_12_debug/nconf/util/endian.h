@@ -0,0 +1,4 @@
+#ifndef NCONF_UTIL_ENDIAN_H
+#define NCONF_UTIL_ENDIAN_H
+	#define NCONF_mENDIAN_bENDIAN_H_DOUBLE 1
+#endif
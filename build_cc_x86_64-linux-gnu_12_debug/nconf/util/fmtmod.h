@@ -0,0 +1,5 @@
+#ifndef NCONF_UTIL_FMTMOD_H
+#define NCONF_UTIL_FMTMOD_H
+	#define NCONF_mFMTMOD_SIZET_bULONG 1
+	#define NCONF_mFMTMOD_UINTPTRT_bULONG 1
+#endif
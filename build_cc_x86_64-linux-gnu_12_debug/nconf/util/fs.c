@@ -0,0 +1,4 @@
+#ifndef NCONF_UTIL_FS_C
+#define NCONF_UTIL_FS_C
+	#define NCONF_mFTRUNCATE_bDEFAULT_SOURCE 1
+#endif
@@ -0,0 +1,4 @@
+#ifndef NCONF_UTIL_HUGEPAGE_C
+#define NCONF_UTIL_HUGEPAGE_C
+	#define NCONF_mHUGEPAGE_bMAP_HUGETLB 1
+#endif
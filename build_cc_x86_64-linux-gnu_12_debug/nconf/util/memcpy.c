@@ -0,0 +1,4 @@
+#ifndef NCONF_UTIL_MEMCPY_C
+#define NCONF_UTIL_MEMCPY_C
+	#define NCONF_mMEMCPY_bGLIBC 1
+#endif
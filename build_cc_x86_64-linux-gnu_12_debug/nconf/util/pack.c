@@ -0,0 +1,4 @@
+#ifndef NCONF_UTIL_PACK_C
+#define NCONF_UTIL_PACK_C
+	#define NCONF_mPACK_bARPA_INET_H 1
+#endif
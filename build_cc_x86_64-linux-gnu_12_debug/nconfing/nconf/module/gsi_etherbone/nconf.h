@@ -0,0 +1,4 @@
+#ifndef NCONF_MODULE_GSI_ETHERBONE_NCONF_H
+#define NCONF_MODULE_GSI_ETHERBONE_NCONF_H
+	#define NCONF_mGSI_ETHERBONE_bNO 1
+#endif
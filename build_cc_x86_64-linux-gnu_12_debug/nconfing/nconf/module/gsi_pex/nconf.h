@@ -0,0 +1,4 @@
+#ifndef NCONF_MODULE_GSI_PEX_NCONF_H
+#define NCONF_MODULE_GSI_PEX_NCONF_H
+	#define NCONF_mGSI_PEX_bNO 1
+#endif
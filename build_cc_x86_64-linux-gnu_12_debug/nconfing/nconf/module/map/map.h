@@ -0,0 +1,4 @@
+#ifndef NCONF_MODULE_MAP_MAP_H
+#define NCONF_MODULE_MAP_MAP_H
+	#define NCONF_mMAP_bDUMB 1
+#endif
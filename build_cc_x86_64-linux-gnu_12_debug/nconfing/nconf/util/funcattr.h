@@ -0,0 +1,9 @@
+#ifndef NCONF_UTIL_FUNCATTR_H
+#define NCONF_UTIL_FUNCATTR_H
+	#define NCONF_mFUNC_NONNULL_bYES 1
+	#define NCONF_mFUNC_NORETURN_bYES 1
+	#define NCONF_mFUNC_PRINTF_bYES 1
+	#define NCONF_mFUNC_PURE_bNO 1
+	#define NCONF_mFUNC_RETURNS_bYES 1
+	#define NCONF_mFUNC_UNUSED_bYES 1
+#endif
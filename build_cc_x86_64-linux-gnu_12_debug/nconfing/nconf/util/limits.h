@@ -0,0 +1,4 @@
+#ifndef NCONF_UTIL_LIMITS_H
+#define NCONF_UTIL_LIMITS_H
+	#define NCONF_mLIMITS_bLIMITS_H 1
+#endif
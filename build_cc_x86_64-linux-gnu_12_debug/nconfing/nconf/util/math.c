@@ -0,0 +1,4 @@
+#ifndef NCONF_UTIL_MATH_C
+#define NCONF_UTIL_MATH_C
+	#define NCONF_mMATH_LINK_bNOTHING 1
+#endif
@@ -0,0 +1,14 @@
+#define NCONFING 1
+#define NCONFING_mPACK 1
+#include <util/pack.c>
+int main(int argc, char **argv) {
+	(void)argc; (void)argv;
+#ifdef NCONF_TEST
+	return !(NCONF_TEST);
+#else
+#ifdef NCONF_TEST_VOID
+	NCONF_TEST_VOID;
+#endif
+	return 0;
+#endif
+}
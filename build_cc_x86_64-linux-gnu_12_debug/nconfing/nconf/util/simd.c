@@ -0,0 +1,4 @@
+#ifndef NCONF_UTIL_SIMD_C
+#define NCONF_UTIL_SIMD_C
+	#define NCONF_mSIMD_bSSE2 1
+#endif
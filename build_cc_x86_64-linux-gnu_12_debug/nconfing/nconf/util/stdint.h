@@ -0,0 +1,5 @@
+#ifndef NCONF_UTIL_STDINT_H
+#define NCONF_UTIL_STDINT_H
+	#define NCONF_mSTDINT_LIMITS_bSTD_H 1
+	#define NCONF_mSTDINT_TYPES_bSTD_H 1
+#endif
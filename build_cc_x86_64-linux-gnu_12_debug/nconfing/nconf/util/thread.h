@@ -0,0 +1,4 @@
+#ifndef NCONF_UTIL_THREAD_H
+#define NCONF_UTIL_THREAD_H
+	#define NCONF_mTHREAD_bPTHREAD 1
+#endif
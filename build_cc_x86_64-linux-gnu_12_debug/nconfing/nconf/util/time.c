@@ -0,0 +1,7 @@
+#ifndef NCONF_UTIL_TIME_C
+#define NCONF_UTIL_TIME_C
+	#define NCONF_mTIME_GET_bCLOCK_GETTIME 1
+	#define NCONF_mTIME_CYCLES_bX86 1
+	#define NCONF_mTIME_SLEEP_bNANOSLEEP 1
+	#define NCONF_mTIME_DRAFT9_bNO 1
+#endif
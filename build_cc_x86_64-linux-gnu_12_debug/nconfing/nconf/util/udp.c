@@ -0,0 +1,7 @@
+#ifndef NCONF_UTIL_UDP_C
+#define NCONF_UTIL_UDP_C
+	#define NCONF_mSOCKET_H_bSYS_SOCKET_H 1
+	#define NCONF_mIPPROTO_UDP_bNETINET_IN_H 1
+	#define NCONF_mUDP_LOOKUP_bGETHOSTBYNAME_SOCKLEN 1
+	#define NCONF_mUDP_EVENT_bPOLL 1
+#endif
@@ -0,0 +1,4 @@
+#ifndef UTIL_MD5SUM_H
+#define UTIL_MD5SUM_H
+#define NURDLIB_MD5 0xe192c587
+#endif
@@ -108,11 +108,15 @@ static char const g_keyword_array[][52] = {
 	"accept_trig",
 	"active_buses",
 	"acvt",
+	"acvt_miss",
+	"acvt_window",
+	"adaptive",
 	"aggregate_num",
 	"all_or",
 	"amplitude",
 	"and",
 	"anticoincidence",
+	"async",
 	"auto_pedestals",
 	"auto_thresholds",
 	"auto_thresholds_rewind",
@@ -121,6 +125,7 @@ static char const g_keyword_array[][52] = {
 	"average_length",
 	"average_mode",
 	"average_pretrigger",
+	"backoff",
 	"backplane",
 	"banks_operation",
 	"baseline_average",
@@ -137,9 +142,12 @@ static char const g_keyword_array[][52] = {
 	"blt_2evme",
 	"blt_ext",
 	"blt_mode",
+	"blt_pool_bytes",
+	"budget",
 	"buf_bytes",
 	"buf_ofs",
 	"buf_ofs_hi",
+	"bus",
 	"busy",
 	"cbus",
 	"cfd",
@@ -172,6 +180,7 @@ static char const g_keyword_array[][52] = {
 	"correction_short_gain",
 	"correction_timing_filter_gain",
 	"csi",
+	"cycle_clock",
 	"dark",
 	"data_format",
 	"data_path",
@@ -179,6 +188,7 @@ static char const g_keyword_array[][52] = {
 	"data_threshold",
 	"deadtime",
 	"deadtime_release",
+	"deadtime_reorder",
 	"debug",
 	"detector_type",
 	"differentiation",
@@ -198,7 +208,10 @@ static char const g_keyword_array[][52] = {
 	"error",
 	"etherbone",
 	"even_odd",
+	"event_max_auto",
+	"event_max_fill",
 	"event_max_override",
+	"event_max_window",
 	"event_threshold",
 	"exp_trig",
 	"exp_trig_delay0",
@@ -219,6 +232,7 @@ static char const g_keyword_array[][52] = {
 	"fixed",
 	"free_running",
 	"frontend",
+	"full",
 	"gain",
 	"gap",
 	"gap_e",
@@ -227,6 +241,7 @@ static char const g_keyword_array[][52] = {
 	"gate_long",
 	"gate_offset",
 	"gate_short",
+	"header",
 	"header_id",
 	"hires",
 	"hpge",
@@ -234,6 +249,7 @@ static char const g_keyword_array[][52] = {
 	"independent",
 	"info",
 	"inherit",
+	"init_group",
 	"init_sleep",
 	"input_coinc",
 	"integration_long",
@@ -254,6 +270,7 @@ static char const g_keyword_array[][52] = {
 	"link_ip",
 	"link_number",
 	"liquid",
+	"log_async",
 	"log_level",
 	"long_range",
 	"lvds",
@@ -268,6 +285,7 @@ static char const g_keyword_array[][52] = {
 	"mmr64_thrs_bank1",
 	"mobo",
 	"mode",
+	"module",
 	"monitor_channel",
 	"monitor_on",
 	"monitor_wave",
@@ -276,6 +294,7 @@ static char const g_keyword_array[][52] = {
 	"nim",
 	"nim_busy",
 	"noblt",
+	"nth",
 	"off",
 	"offset",
 	"on",
@@ -289,6 +308,7 @@ static char const g_keyword_array[][52] = {
 	"padi_or",
 	"pair",
 	"pair_trigger_validation",
+	"parallel_readout",
 	"paranoid",
 	"paux",
 	"peak",
@@ -300,8 +320,12 @@ static char const g_keyword_array[][52] = {
 	"piggy_to_mobo",
 	"pileup_length",
 	"pileup_trigout",
+	"pipeline_readout",
 	"polarity_detection",
 	"pole_zero",
+	"poll",
+	"poll_backoff_max",
+	"poll_spin",
 	"pos",
 	"postinit_sleep",
 	"pretrigger_delay",
@@ -325,6 +349,7 @@ static char const g_keyword_array[][52] = {
 	"re_pileup_length",
 	"readout",
 	"ref_ch0",
+	"reinit_clear",
 	"reinit_sleep",
 	"reset",
 	"reset_time",
@@ -336,6 +361,8 @@ static char const g_keyword_array[][52] = {
 	"saturated",
 	"scaler_name",
 	"shadow_bytes",
+	"shadow_group",
+	"shadow_poll",
 	"shaped_self_trigger",
 	"shaping_time",
 	"signal_decaytime",
@@ -343,6 +370,7 @@ static char const g_keyword_array[][52] = {
 	"signal_risetime",
 	"signal_width",
 	"silicon",
+	"single",
 	"skip_dt",
 	"slice_num",
 	"sliding_scale",
@@ -372,6 +400,8 @@ static char const g_keyword_array[][52] = {
 	"threshold_pur_gap",
 	"threshold_step",
 	"time_after_trigger",
+	"time_merge",
+	"time_merge_window",
 	"time_range",
 	"timestamp",
 	"timing_resolution",
@@ -430,15 +460,21 @@ static char const g_keyword_array[][52] = {
 	"use_veto",
 	"util_path",
 	"verbose",
+	"verify",
+	"verify_budget",
+	"verify_level",
+	"verify_nth",
 	"version",
 	"veto_direct",
 	"veto_source",
 	"veto_width",
 	"width",
+	"write_cache",
 	"write_histograms",
 	"write_traces_maw",
 	"write_traces_maw_energy",
 	"write_traces_raw",
+	"yield",
 	"zero_crossing",
 	"zero_suppress"
 };
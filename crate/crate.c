@@ -52,6 +52,7 @@
 #include <nurdlib/log.h>
 #include <nurdlib/trloii.h>
 #include <util/assert.h>
+#include <util/atomic.h>
 #include <util/bits.h>
 #include <util/fmtmod.h>
 #include <util/math.h>
@@ -65,7 +66,15 @@
 #include <module/map/map_cmvlc.h>
 
 #define BARRIER_WORD 0xbabababa
+#define SHADOW_ALIGN 8
+#define SHADOW_RECORD_PAD 0xffffffff
+/* Events in a row with a full ring before the rings are re-split. */
+#define SHADOW_FULL_STREAK 8
 #define DT_TIMEOUT 1.0
+#define THREAD_IDLE_MAX_S 1e-3
+#define ACVT_STEP_NS 100
+#define ACVT_STEP_MIN_NS 10
+#define ACVT_STEP_MAX_NS 1000
 
 /*
  * Basic lock contention profiling.
@@ -150,6 +159,8 @@ struct CrateTag {
 	struct	CounterRefVector counter_ref_vec;
 	unsigned	module_num;
 	unsigned	event_max;
+	/* Hardware/override limit, event_max_auto tunes below it. */
+	unsigned	event_max_cap;
 	int	gsi_pex_is_needed;
 	int	do_pedestals;
 	TAILQ_ENTRY(CrateTag)	next;
@@ -164,19 +175,115 @@ struct ModuleID {
 	unsigned	id;
 	TAILQ_ENTRY(ModuleID)	next;
 };
+/*
+ * Independent hardware access paths, modules on different buses can be read
+ * out concurrently in parallel readout mode.
+ */
+enum CrateBus {
+	BUS_MAP,
+	BUS_GSI_PEX,
+	BUS_GSI_ETHERBONE,
+	BUS_NUM
+};
+/*
+ * One readout step in parallel mode, slots mirror the readout steps and own
+ * a slice of the event buffer for each readout.
+ */
+struct CrateParallelSlot {
+	struct	Module *module;
+	unsigned	flags;
+	enum	CrateBus bus;
+	int	is_main;
+	struct	EventBuffer slice;
+	size_t	bytes;
+	size_t	bytes_max;
+	uint32_t	result;
+	int	is_read;
+	int	is_done;
+};
+VECTOR_HEAD(CrateParallelSlotVector, struct CrateParallelSlot);
+struct CrateBusWorker {
+	struct	Crate *crate;
+	enum	CrateBus bus;
+	size_t	slot_num;
+	struct	Thread thread;
+	int	do_read;
+};
+/* Shadow modules sharing one thread, the mutex guards their hardware. */
+struct CrateShadowGroup {
+	struct	Crate *crate;
+	struct	ModuleRefVector module_ref_vec;
+	struct	Mutex mutex;
+	struct	Thread thread;
+	int	is_running;
+};
+/* Modules slow-inited in sequence by one thread. */
+struct CrateInitGroup {
+	struct	Crate *crate;
+	struct	ModuleRefVector module_ref_vec;
+	struct	Thread thread;
+	int	do_log_level;
+	unsigned	init_id;
+	int	is_ok;
+};
+/* Module data waiting to be parsed by the verification thread. */
+struct CrateVerifyJob {
+	struct	Module *module;
+	struct	EventConstBuffer ceb;
+	uint32_t	counter;
+	uint32_t	result;
+};
+VECTOR_HEAD(CrateVerifyJobVector, struct CrateVerifyJob);
+/*
+ * Hot loop entries resolved at init, so the per-event loops don't re-check
+ * module types, config and props.
+ */
+enum {
+	STEP_BARRIER = 0x1,
+	STEP_SHADOW = 0x2,
+	STEP_EARLY_DT = 0x4
+};
+struct CrateStep {
+	struct	Module *module;
+	uint32_t	(*readout_dt)(struct Crate *, struct Module *);
+	uint32_t	(*check_empty)(struct Module *);
+	/* Position in the module list. */
+	unsigned	for_it;
+	unsigned	flags;
+};
+VECTOR_HEAD(CrateStepVector, struct CrateStep);
 TAILQ_HEAD(CrateList, Crate);
+/*
+ * Shadow ring record header, followed by the payload padded to
+ * SHADOW_ALIGN. A pad record skips to the start of the store.
+ */
+struct ShadowRecord {
+	uint32_t	bytes;
+	uint32_t	counter;
+};
 struct Crate {
 	char	*name;
 	enum	CrateState state;
 	unsigned	event_max_override;
+	struct {
+		int	do_it;
+		/* Fraction of the event buffer to fill per readout. */
+		double	fill;
+		/* Readouts per adjustment. */
+		unsigned	window;
+		unsigned	readout_num;
+		/* Smallest event buffer seen in the window. */
+		size_t	buf_bytes;
+	} event_max_auto;
 	struct {
 		int	do_it;
 		int	do_inhibit;
 		int	is_on;
 		void	(*func)(void *);
 		void	*data;
-		unsigned	for_it;
-		unsigned	for_it_prev;
+		int	do_reorder;
+		/* Readout step before which dt is released. */
+		unsigned	step_i;
 	} dt_release;
 	struct	GsiCTDCCrate gsi_ctdc_crate;
 	struct	GsiFebexCrate gsi_febex_crate;
@@ -199,9 +306,24 @@ struct Crate {
 	struct	ModuleRefVector module_configed_vec;
 	struct {
 		int	yes;
-		unsigned	pioneer_counter;
 		unsigned	ns;
+		/* Set by polls and modules that had to wait for data. */
 		int	do_grow;
+		/* Allowed fraction of waiting events per window. */
+		double	miss_rate;
+		unsigned	window;
+		/* Doubles while moving one way, halves on turns. */
+		unsigned	step_ns;
+		int	dir;
+		unsigned	event_num;
+		unsigned	miss_num;
+		uint32_t	poll_hist[CTRL_ACVT_POLL_BUCKETS];
+		struct {
+			unsigned	ns;
+			unsigned	event_num;
+			unsigned	miss_num;
+		} history[CTRL_ACVT_HISTORY_MAX];
+		size_t	history_num;
 		struct	Module *module;
 		void	(*set_cvt)(struct Module *, unsigned);
 	} acvt;
@@ -209,11 +331,47 @@ struct Crate {
 		size_t	buf_bytes;
 		struct	MapBltDst *dst;
 		int	is_running;
-		struct	Thread thread;
+		enum	Keyword group_by;
+		double	poll_max_s;
+		struct	CrateShadowGroup group[BUS_NUM];
 		size_t	max_bytes;
-		size_t	module_readable_num;
 		int	do_buf_rebuild;
 	} shadow;
+	/* DMA destination chunks, recycled every crate_readout. */
+	struct	MapBltPool *blt_pool;
+	/* Scatter-gather output, see crate_readout_sg. */
+	struct {
+		int	is_on;
+		int	is_held;
+		uint8_t	const *flush_ptr;
+		size_t	num;
+		size_t	capacity;
+		struct	EventConstBuffer *array;
+		/* Module data gathered from several segments for parsing. */
+		uint8_t	*scratch;
+		size_t	scratch_bytes;
+	} sg;
+	struct {
+		enum	Keyword strategy;
+		void	(*wait)(struct Crate *, struct Module *, unsigned,
+		    double);
+		double	spin_s;
+		double	backoff_s;
+		double	backoff_max_s;
+		uint32_t	event_num;
+		uint32_t	sum;
+		uint32_t	max;
+	} poll;
+	struct {
+		int	yes;
+		int	is_running;
+		struct	Mutex mutex;
+		struct	CondVar work;
+		struct	CondVar done;
+		unsigned	pending;
+		struct	CrateParallelSlotVector slot_vec;
+		struct	CrateBusWorker worker[BUS_NUM];
+	} parallel;
 	struct {
 		struct	Module *module;
 		char	const *tag_name;
@@ -221,9 +379,72 @@ struct Crate {
 	} trloii_multi_event;
 	double	reinit_sleep_s;
 	double	postinit_sleep_s;
+	struct {
+		int	do_clear;
+		int	was_cleared;
+		/* Held segments point into rings, recover on release. */
+		int	is_deferred;
+		int	is_final;
+	} recover;
 	int	is_free_running;
 	unsigned	module_init_id;
 	struct	ModuleIDList module_init_id_list;
+	struct {
+		enum	Keyword group_by;
+		/* Guards the id list and remapping during slow-init. */
+		struct	Mutex mutex;
+		size_t	group_num;
+		struct	CrateInitGroup *group_array;
+		size_t	thread_num;
+	} init;
+	/* Dead-time breakdown, only written by the readout thread. */
+	struct	TimeStat dt_stat[CTRL_DT_PHASE_NUM];
+	struct {
+		/* Modules polled in readout_dt. */
+		struct	CrateStepVector dt_vec;
+		/* Barriers and modules read out or merged. */
+		struct	CrateStepVector readout_vec;
+		/* Modules with props, for check_empty. */
+		struct	CrateStepVector empty_vec;
+	} step;
+	struct {
+		int	do_it;
+		uint64_t	window;
+		/* Copy of the unsorted event, the sources point in here. */
+		uint8_t	*buf;
+		size_t	buf_bytes;
+		struct	CrateMergeSource *source_array;
+		struct	CrateMergeSource **heap_array;
+	} merge;
+	struct {
+		int	is_async;
+		int	is_running;
+		struct	Mutex mutex;
+		struct	CondVar work;
+		struct	CondVar done;
+		struct	Thread thread;
+		/* Jobs [0,next) are done, emptied every event. */
+		struct	CrateVerifyJobVector job_vec;
+		size_t	next;
+	} verify;
+	struct {
+		int	do_it;
+		/* Read module waiting to be parsed. */
+		struct	Module *module;
+		struct	EventConstBuffer ceb;
+	} pipeline;
+	struct {
+		int	is_running;
+		struct	Thread thread;
+		CrateTriggerCallback	trigger;
+		CrateEventCallback	event;
+		void	*data;
+		/* Own event buffer, no other crate writes here. */
+		uint8_t	*buf;
+		size_t	bytes;
+	} thread;
+	/* Counted in g_map_user_num while initialized. */
+	int	is_map_user;
 	struct	Mutex mutex;
 	unsigned	gsi_mbs_trigger;
 	struct {
@@ -235,32 +456,128 @@ struct Crate {
 	TAILQ_ENTRY(Crate)	next;
 };
 
+static unsigned			acvt_step(struct Crate *, int) FUNC_RETURNS;
+static void			acvt_update(struct Crate *, unsigned);
 static uint32_t			check_empty(struct Crate *) FUNC_RETURNS;
 static void			dt_release(struct Crate *);
+static void			event_max_tune(struct Crate *);
 static struct CrateCounter	*get_counter(struct Crate *, char const *)
 	FUNC_RETURNS;
 static struct Crate		*get_crate(unsigned) FUNC_RETURNS;
 static struct Module		*get_module(struct Crate *, unsigned)
 	FUNC_RETURNS;
-static uint32_t			shadow_merge_module(struct Crate *, struct
-    Module *, struct EventBuffer *) FUNC_RETURNS;
+static int			init_slow_all(struct Crate *) FUNC_RETURNS;
+static void			init_slow_func(void *);
+static enum CrateBus		module_bus_get(struct Module const *)
+	FUNC_RETURNS;
 static void			module_counter_latch(struct Module *);
 static void			module_init_id_clear(struct Crate *);
 static void			module_init_id_mark(struct Crate *, struct
     Module const *);
+static uint32_t			merge_event(struct Crate *, struct
+    EventBuffer const *, struct EventBuffer *) FUNC_RETURNS;
 static void			module_insert(struct Crate *, struct
     TagRefVector *, struct Module *);
-static void			pop_log_level(struct Module const *);
-static void			push_log_level(struct Module const *);
+static uint32_t			module_verify(struct Crate *, struct Module *,
+    struct EventConstBuffer const *) FUNC_RETURNS;
+static void			mutex_lock_all(struct Crate *);
+static void			mutex_unlock_all(struct Crate *);
+static int			parallel_dt_is_ready(struct Crate const *)
+	FUNC_RETURNS;
+static void			parallel_fetch(struct Crate *, struct
+    CrateParallelSlot *);
+static void			parallel_func(void *);
+static void			parallel_layout(struct Crate *, struct
+    EventBuffer const *);
+static void			poll_wait_adaptive(struct Crate *, struct
+    Module *, unsigned, double);
+static void			poll_wait_backoff(struct Crate *, struct
+    Module *, unsigned, double);
+static void			poll_wait_yield(struct Crate *, struct Module
+    *, unsigned, double);
+static uint32_t			parallel_readout(struct Crate *, struct
+    EventBuffer *) FUNC_RETURNS;
+static void			parallel_start(struct Crate *);
+static void			parallel_stop(struct Crate *);
+static uint32_t			pipeline_flush(struct Crate *) FUNC_RETURNS;
+static void			pop_log_level(struct Module *);
+static void			push_log_level(struct Module *);
 static uint32_t			read_module(struct Crate *, struct Module *,
-    struct EventBuffer *) FUNC_RETURNS;
+    struct EventBuffer *, int) FUNC_RETURNS;
+static void			read_module_done(struct Crate *, struct Module
+    *, struct EventConstBuffer const *, enum ModuleEbFinalPlace,
+    uint32_t);
+static int			read_module_is_due(struct Crate const *,
+    struct Module const *) FUNC_RETURNS;
+static uint32_t			read_module_parse(struct Crate *, struct
+    Module *, struct EventConstBuffer *, size_t, size_t, uint32_t)
+	FUNC_RETURNS;
+static void			readout_func(void *);
+static void			recover(struct Crate *, int);
+static int			recover_clear(struct Crate *, int)
+	FUNC_RETURNS;
+static void			shadow_buf_rebuild(struct Crate *);
 static void			shadow_func(void *);
+static void			shadow_start(struct Crate *);
+static void			shadow_stop(struct Crate *);
+static int			shadow_is_empty(struct Crate *) FUNC_RETURNS;
+static uint32_t			shadow_merge_module(struct Crate *, struct
+    Module *, struct EventBuffer *) FUNC_RETURNS;
+static size_t			shadow_ring_bytes(struct ModuleShadowRing
+    const *) FUNC_RETURNS;
+static void			shadow_ring_full_check(struct Crate *, struct
+    Module *);
+static size_t			shadow_ring_next(struct ModuleShadowRing
+    const *, size_t, size_t) FUNC_RETURNS;
+static size_t			shadow_ring_ofs(struct ModuleShadowRing
+    const *, size_t) FUNC_RETURNS;
+static void			shadow_ring_scan(struct Module *);
+static size_t			shadow_ring_used(struct ModuleShadowRing
+    const *, size_t, size_t) FUNC_RETURNS;
+static uint32_t			shadow_sg_module(struct Crate *, struct Module
+    *, void const *) FUNC_RETURNS;
+static uint32_t			shadow_ring_write(struct Crate *, struct
+    Module *) FUNC_RETURNS;
+static void			sg_append(struct Crate *, void const *, size_t);
+static void			sg_flush(struct Crate *, void const *);
+static uint32_t			sg_parse(struct Crate *, struct Module *,
+    size_t, struct EventConstBuffer *) FUNC_RETURNS;
 static int			signature_match(struct Module const *, struct
     Module const *) FUNC_RETURNS;
+static void			step_build(struct Crate *);
+static unsigned			step_dt_release_get(struct Crate
+    const *) FUNC_RETURNS;
+static void			step_free(struct Crate *);
+static void			step_reorder(struct Crate *);
 static struct CrateTag		*tag_get(struct Crate *, char const *)
 	FUNC_RETURNS;
+static void			time_stat_pack(struct PackerList *, struct
+    TimeStat const *);
+static void			verify_drain(struct Crate *);
+static void			verify_func(void *);
+static void			verify_push(struct Crate *, struct Module *,
+    struct EventConstBuffer const *);
+static void			verify_start(struct Crate *);
+static void			verify_stop(struct Crate *);
+static struct Map		*write_cache_get_map(struct Module *)
+	FUNC_RETURNS;
 
 static struct CrateList g_crate_list = TAILQ_HEAD_INITIALIZER(g_crate_list);
+/*
+ * Crate threads share the log level stack and the hardware init paths, so
+ * per-module log levels are ignored and re-inits are serialized while any
+ * crate thread runs. The mutex lives as long as any crate does, the counter
+ * is only written under it.
+ */
+static unsigned g_thread_num;
+static struct Mutex g_thread_mutex;
+/*
+ * Initialized crates, the map backends are global so only the last crate to
+ * deinit may tear them down, or a re-init would close the controller under
+ * the other crate threads. Only touched under g_thread_mutex or before any
+ * crate thread runs.
+ */
+static unsigned g_map_user_num;
 
 unsigned
 crate_acvt_get_ns(struct Crate const *a_crate)
@@ -376,9 +693,24 @@ crate_counter_get_diff(struct CrateCounter const *a_counter)
 
 struct Crate *
 crate_create(void)
+{
+	struct ConfigBlock *crate_block;
+
+	/* Get the crate config. */
+	crate_block = config_get_block(NULL, KW_CRATE);
+	if (NULL == crate_block) {
+		log_die(LOGL, "crate_create: Could not find a configured "
+		    "crate, I bail.");
+	}
+	return crate_create_block(crate_block);
+}
+
+struct Crate *
+crate_create_block(struct ConfigBlock *a_crate_block)
 {
 	struct TagRefVector tag_active_vec;
 	struct Crate *crate;
+	struct Crate *other;
 	struct CrateTag *tag;
 	struct CrateCounter *counter;
 	struct ConfigBlock *crate_block;
@@ -395,14 +727,15 @@ crate_create(void)
 	TAILQ_INIT(&crate->scaler_list);
 	TAILQ_INIT(&crate->module_init_id_list);
 
-	/* Get the crate config. */
-	crate_block = config_get_block(NULL, KW_CRATE);
-	if (NULL == crate_block) {
-		log_die(LOGL, "crate_create: Could not find a configured "
-		    "crate, I bail.");
-	}
+	crate_block = a_crate_block;
 	crate->name = strdup_(config_get_block_param_string(crate_block, 0));
 	LOGF(info)(LOGL, "Crate=\"%s\".", crate->name);
+	TAILQ_FOREACH(other, &g_crate_list, next) {
+		if (0 == strcmp(other->name, crate->name)) {
+			log_die(LOGL, "Crate \"%s\" configured several "
+			    "times!", crate->name);
+		}
+	}
 
 #define FLAG_LOG(flag, msg) do { \
 	if (flag) { \
@@ -413,33 +746,86 @@ crate_create(void)
 } while (0)
 
 	crate->acvt.yes = config_get_boolean(crate_block, KW_ACVT);
-	crate->acvt.pioneer_counter = 0;
 	crate->acvt.ns = 0;
+	crate->acvt.miss_rate = config_get_double(crate_block, KW_ACVT_MISS,
+	    CONFIG_UNIT_NONE, 0.0, 1.0);
+	crate->acvt.window = config_get_int32(crate_block, KW_ACVT_WINDOW,
+	    CONFIG_UNIT_NONE, 1, 1000000);
+	crate->acvt.step_ns = ACVT_STEP_NS;
 	FLAG_LOG(crate->acvt.yes, "Adaptive CVT");
 
 	crate->shadow.buf_bytes = config_get_int32(crate_block,
 	    KW_SHADOW_BYTES, CONFIG_UNIT_B, 0, 1 << 30);
 	if (0 != crate->shadow.buf_bytes) {
+#if ATOMIC_NONE
+		log_die(LOGL, "Shadow readout needs atomics, which this "
+		    "build does not have.");
+#endif
 		LOGF(info)(LOGL, "Shadow readout enabled, buffer "
 		    "size=0x%"PRIzx" B.", crate->shadow.buf_bytes);
 		crate->shadow.dst = map_blt_dst_alloc(crate->shadow.buf_bytes);
 	} else {
 		LOGF(verbose)(LOGL, "Shadow readout disabled.");
 	}
+	{
+		enum Keyword const c_group[] = {KW_SINGLE, KW_BUS};
+
+		crate->shadow.group_by = CONFIG_GET_KEYWORD(crate_block,
+		    KW_SHADOW_GROUP, c_group);
+	}
+	crate->shadow.poll_max_s = 1e-6 * config_get_int32(crate_block,
+	    KW_SHADOW_POLL, CONFIG_UNIT_US, 0, 1000000);
+	{
+		size_t bytes;
+
+		bytes = config_get_int32(crate_block, KW_BLT_POOL_BYTES,
+		    CONFIG_UNIT_B, 0, 1 << 30);
+		if (0 != bytes) {
+			LOGF(info)(LOGL, "BLT pool enabled, "
+			    "size=0x%"PRIzx" B.", bytes);
+			crate->blt_pool = map_blt_pool_create(bytes);
+		}
+	}
+	{
+		enum Keyword const c_group[] = {KW_SINGLE, KW_BUS, KW_MODULE};
+
+		crate->init.group_by = CONFIG_GET_KEYWORD(crate_block,
+		    KW_INIT_GROUP, c_group);
+		LOGF(verbose)(LOGL, "Slow-init grouping=%s.",
+		    keyword_get_string(crate->init.group_by));
+		if (KW_MODULE == crate->init.group_by &&
+		    !MAP_SICY_CONCURRENT) {
+			LOGF(info)(LOGL, "VME controller is not thread-safe, "
+			    "map modules slow-init in one group.");
+		}
+	}
 
 	crate->dt_release.do_it = config_get_boolean(crate_block,
 	    KW_DEADTIME_RELEASE);
-	crate->dt_release.for_it_prev = -1;
 	FLAG_LOG(crate->dt_release.do_it, "Early deadtime release");
+	crate->dt_release.do_reorder = config_get_boolean(crate_block,
+	    KW_DEADTIME_REORDER);
+	FLAG_LOG(crate->dt_release.do_reorder, "Early deadtime reordering");
 
 	crate->event_max_override = config_get_int32(crate_block,
 	    KW_EVENT_MAX_OVERRIDE, CONFIG_UNIT_NONE, 0, 200000);
 	LOGF(verbose)(LOGL, "event_max override=%u.",
 	    crate->event_max_override);
+	crate->event_max_auto.do_it = config_get_boolean(crate_block,
+	    KW_EVENT_MAX_AUTO);
+	crate->event_max_auto.fill = config_get_double(crate_block,
+	    KW_EVENT_MAX_FILL, CONFIG_UNIT_NONE, 0.01, 1.0);
+	crate->event_max_auto.window = config_get_int32(crate_block,
+	    KW_EVENT_MAX_WINDOW, CONFIG_UNIT_NONE, 1, 1000000);
+	FLAG_LOG(crate->event_max_auto.do_it, "Auto-tuned event_max");
 
 	crate->reinit_sleep_s = config_get_int32(crate_block, KW_REINIT_SLEEP,
 	    CONFIG_UNIT_S, 0, 60);
 	LOGF(verbose)(LOGL, "Re-init sleep=%gs.", crate->reinit_sleep_s);
+	crate->recover.do_clear = config_get_boolean(crate_block,
+	    KW_REINIT_CLEAR);
+	LOGF(verbose)(LOGL, "Re-init clear=%s.", crate->recover.do_clear ?
+	    "yes" : "no");
 	crate->postinit_sleep_s = config_get_int32(crate_block,
 	    KW_POSTINIT_SLEEP, CONFIG_UNIT_S, 0, 60);
 	LOGF(verbose)(LOGL, "Post-init sleep=%gs.", crate->postinit_sleep_s);
@@ -447,6 +833,95 @@ crate_create(void)
 	crate->is_free_running = config_get_boolean(crate_block,
 	    KW_FREE_RUNNING);
 	FLAG_LOG(crate->is_free_running, "Free-running");
+	crate->merge.do_it = config_get_boolean(crate_block, KW_TIME_MERGE);
+	FLAG_LOG(crate->merge.do_it, "Time-sorted merging");
+	crate->merge.window = config_get_int32(crate_block,
+	    KW_TIME_MERGE_WINDOW, CONFIG_UNIT_NONE, 0, 0x7fffffff);
+	if (crate->merge.do_it) {
+		if (!crate->is_free_running) {
+			log_die(LOGL, "%s: Time-sorted merging needs "
+			    "free-running mode!", crate->name);
+		}
+		if (NULL != crate->blt_pool) {
+			log_die(LOGL, "%s: Time-sorted merging and the BLT "
+			    "pool are exclusive!", crate->name);
+		}
+		LOGF(verbose)(LOGL, "Coincidence window=%u ticks.",
+		    (unsigned)crate->merge.window);
+	}
+
+	if (config_get_boolean(crate_block, KW_CYCLE_CLOCK)) {
+		if (time_cycles_calibrate()) {
+			LOGF(info)(LOGL, "Cycle counter clock enabled.");
+		} else {
+			log_error(LOGL, "Cycle counter clock not available, "
+			    "using the monotonic clock.");
+		}
+	}
+
+	{
+		enum Keyword const c_poll[] = {KW_ADAPTIVE, KW_BACKOFF,
+			KW_YIELD};
+
+		crate->poll.strategy = CONFIG_GET_KEYWORD(crate_block,
+		    KW_POLL, c_poll);
+		if (KW_YIELD == crate->poll.strategy) {
+			crate->poll.wait = poll_wait_yield;
+		} else if (KW_BACKOFF == crate->poll.strategy) {
+			crate->poll.wait = poll_wait_backoff;
+		} else {
+			crate->poll.wait = poll_wait_adaptive;
+		}
+		crate->poll.spin_s = 1e-6 * config_get_int32(crate_block,
+		    KW_POLL_SPIN, CONFIG_UNIT_US, 0, 1000000);
+		crate->poll.backoff_max_s = 1e-6 *
+		    config_get_int32(crate_block, KW_POLL_BACKOFF_MAX,
+		    CONFIG_UNIT_US, 1, 1000000);
+		LOGF(verbose)(LOGL, "Poll=%s, spin=%gs, backoff<=%gs.",
+		    keyword_get_string(crate->poll.strategy),
+		    crate->poll.spin_s, crate->poll.backoff_max_s);
+	}
+
+	crate->parallel.yes = config_get_boolean(crate_block,
+	    KW_PARALLEL_READOUT);
+	FLAG_LOG(crate->parallel.yes, "Parallel bus readout");
+	if (crate->parallel.yes && crate->merge.do_it) {
+		log_die(LOGL, "%s: Parallel readout and time-sorted merging "
+		    "are exclusive!", crate->name);
+	}
+	if (crate->parallel.yes) {
+		if (!thread_mutex_init(&crate->parallel.mutex) ||
+		    !thread_condvar_init(&crate->parallel.work) ||
+		    !thread_condvar_init(&crate->parallel.done)) {
+			log_die(LOGL, "Could not create parallel readout "
+			    "primitives.");
+		}
+	}
+
+	{
+		enum Keyword const c_verify[] = {KW_ASYNC, KW_SYNC};
+
+		crate->verify.is_async = KW_ASYNC ==
+		    CONFIG_GET_KEYWORD(crate_block, KW_VERIFY, c_verify);
+		FLAG_LOG(crate->verify.is_async, "Async verification");
+		if (crate->verify.is_async) {
+			if (!thread_mutex_init(&crate->verify.mutex) ||
+			    !thread_condvar_init(&crate->verify.work) ||
+			    !thread_condvar_init(&crate->verify.done)) {
+				log_die(LOGL, "Could not create verification "
+				    "primitives.");
+			}
+		}
+	}
+
+	crate->pipeline.do_it = config_get_boolean(crate_block,
+	    KW_PIPELINE_READOUT);
+	FLAG_LOG(crate->pipeline.do_it, "Pipelined readout");
+	if (crate->pipeline.do_it && (crate->parallel.yes ||
+	    crate->verify.is_async)) {
+		log_die(LOGL, "%s: Pipelined readout excludes parallel "
+		    "readout and async verification!", crate->name);
+	}
 
 	gsi_sam_crate_create(&crate->gsi_sam_crate);
 	gsi_siderem_crate_create(&crate->gsi_siderem_crate);
@@ -726,8 +1201,29 @@ crate_create(void)
 	if (!thread_mutex_init(&crate->mutex)) {
 		log_die(LOGL, "Could not create readout mutex.");
 	}
+	if (!thread_mutex_init(&crate->init.mutex)) {
+		log_die(LOGL, "Could not create init mutex.");
+	}
+	{
+		size_t i;
+
+		for (i = 0; i < LENGTH(crate->shadow.group); ++i) {
+			struct CrateShadowGroup *group;
+
+			group = &crate->shadow.group[i];
+			group->crate = crate;
+			if (!thread_mutex_init(&group->mutex)) {
+				log_die(LOGL, "Could not create shadow "
+				    "mutex.");
+			}
+		}
+	}
 
 	config_touched_assert(crate_block, 0);
+	if (TAILQ_EMPTY(&g_crate_list) &&
+	    !thread_mutex_init(&g_thread_mutex)) {
+		log_die(LOGL, "Could not create crate thread mutex.");
+	}
 	TAILQ_INSERT_TAIL(&g_crate_list, crate, next);
 
 	crate->dt_release.is_on = 1;
@@ -757,27 +1253,38 @@ crate_deinit(struct Crate *a_crate)
 		a_crate->deinit_callback(a_crate);
 	}
 
-	if (a_crate->shadow.is_running) {
-		LOGF(info)(LOGL, "Stopping shadow thread.");
-		a_crate->shadow.is_running = 0;
-		thread_clean(&a_crate->shadow.thread);
-	}
+	shadow_stop(a_crate);
+	parallel_stop(a_crate);
+	verify_stop(a_crate);
 
-	THREAD_MUTEX_LOCK(&a_crate->mutex);
+	mutex_lock_all(a_crate);
 	TAILQ_FOREACH(module, &a_crate->module_list, next) {
 		if (NULL != module->props) {
 			push_log_level(module);
 			module->props->deinit(module);
 			pop_log_level(module);
 		}
+		if (0 != module->verify.shallow_num) {
+			LOGF(info)(LOGL, "%s[%u]=%s: Verified full=%u "
+			    "shallow=%u.", a_crate->name, module->id,
+			    keyword_get_string(module->type),
+			    module->verify.full_num,
+			    module->verify.shallow_num);
+		}
 	}
 	gsi_sam_crate_deinit(&a_crate->gsi_sam_crate);
 	if (NULL != a_crate->gsi_pex.pex) {
 		gsi_pex_deinit(a_crate->gsi_pex.pex);
 	}
-	map_deinit();
+	if (a_crate->is_map_user) {
+		a_crate->is_map_user = 0;
+		--g_map_user_num;
+	}
+	if (0 == g_map_user_num) {
+		map_deinit();
+	}
 	a_crate->state = STATE_REINIT;
-	thread_mutex_unlock(&a_crate->mutex);
+	mutex_unlock_all(a_crate);
 
 	LOGF(info)(LOGL, "crate_deinit(%s) }", a_crate->name);
 }
@@ -872,16 +1379,108 @@ crate_dt_release_set_func(struct Crate *a_crate, void (*a_func)(void *), void
 	a_crate->dt_release.data = a_data;
 }
 
+void
+crate_dt_stats_pack(struct PackerList *a_list, int a_crate_i)
+{
+	struct Crate const *crate;
+	struct Module const *module;
+	size_t i;
+	uint8_t num;
+
+	LOGF(debug)(LOGL, "crate_dt_stats_pack(cr=%d) {", a_crate_i);
+	crate = get_crate(a_crate_i);
+	if (NULL == crate) {
+		/* No phases means no crate. */
+		PACKER_LIST_PACK(*a_list, 8, 0);
+		goto crate_dt_stats_pack_done;
+	}
+	PACKER_LIST_PACK(*a_list, 8, LENGTH(crate->dt_stat));
+	for (i = 0; i < LENGTH(crate->dt_stat); ++i) {
+		time_stat_pack(a_list, &crate->dt_stat[i]);
+	}
+	num = 0;
+	TAILQ_FOREACH(module, &crate->module_list, next) {
+		num += NULL != module->props;
+	}
+	PACKER_LIST_PACK(*a_list, 8, num);
+	TAILQ_FOREACH(module, &crate->module_list, next) {
+		if (NULL == module->props) {
+			continue;
+		}
+		PACKER_LIST_PACK(*a_list, 8, module->id);
+		PACKER_LIST_PACK(*a_list, 16, module->type);
+		time_stat_pack(a_list, &module->dt_stat.readout_dt);
+		time_stat_pack(a_list, &module->dt_stat.readout);
+		time_stat_pack(a_list, &module->dt_stat.parse);
+	}
+crate_dt_stats_pack_done:
+	LOGF(debug)(LOGL, "crate_dt_stats_pack }");
+}
+
+void *
+crate_blt_pool_get(struct Crate *a_crate, size_t a_bytes)
+{
+	/* Bumping is not thread-safe and only pays off when not copied. */
+	if (NULL == a_crate->blt_pool || !a_crate->sg.is_on ||
+	    a_crate->parallel.is_running) {
+		return NULL;
+	}
+	return map_blt_pool_get(a_crate->blt_pool, a_bytes);
+}
+
+uint32_t
+crate_event_buffer_place(struct Crate *a_crate, struct EventBuffer
+    *a_event_buffer, void const *a_ptr, size_t a_bytes)
+{
+	uintptr_t ofs;
+
+	if (a_crate->sg.is_on && NULL != a_crate->blt_pool &&
+	    map_blt_pool_has(a_crate->blt_pool, a_ptr)) {
+		/* Pooled chunk, reference it, the event-buffer stays put. */
+		sg_flush(a_crate, a_event_buffer->ptr);
+		if (0 != a_bytes) {
+			sg_append(a_crate, a_ptr, a_bytes);
+		}
+		return 0;
+	}
+	ofs = (uintptr_t)a_ptr - (uintptr_t)a_event_buffer->ptr;
+	if (a_crate->sg.is_on &&
+	    (uintptr_t)a_ptr >= (uintptr_t)a_event_buffer->ptr &&
+	    ofs + a_bytes <= a_event_buffer->bytes) {
+		/* Leave it where it is, skip the gap. */
+		sg_flush(a_crate, a_event_buffer->ptr);
+		if (0 != a_bytes) {
+			sg_append(a_crate, a_ptr, a_bytes);
+		}
+		EVENT_BUFFER_ADVANCE(*a_event_buffer, (uint8_t *)
+		    a_event_buffer->ptr + ofs + a_bytes);
+		a_crate->sg.flush_ptr = a_event_buffer->ptr;
+		return 0;
+	}
+	if (a_bytes > a_event_buffer->bytes) {
+		log_error(LOGL, "%s: Too much data! Dst=0x%08"PRIzx" B < "
+		    "src=0x%08"PRIzx" B.", a_crate->name,
+		    a_event_buffer->bytes, a_bytes);
+		return CRATE_READOUT_FAIL_DATA_TOO_MUCH;
+	}
+	memmove(a_event_buffer->ptr, a_ptr, a_bytes);
+	EVENT_BUFFER_ADVANCE(*a_event_buffer, (uint8_t *)a_event_buffer->ptr +
+	    a_bytes);
+	return 0;
+}
+
 void
 crate_free(struct Crate **a_crate)
 {
 	struct Crate *crate;
+	size_t i;
 
 	crate = *a_crate;
 	if (NULL == crate) {
 		return;
 	}
 	LOGF(info)(LOGL, "crate_free(%s) {", crate->name);
+	crate_thread_stop(crate);
 	if (STATE_REINIT != crate->state) {
 		/* TODO: Is this fine? */
 		crate_deinit(crate);
@@ -903,9 +1502,34 @@ crate_free(struct Crate **a_crate)
 	gsi_siderem_crate_destroy(&crate->gsi_siderem_crate);
 	gsi_tacquila_crate_destroy(&crate->gsi_tacquila_crate);
 	pnpi_cros3_crate_destroy(&crate->pnpi_cros3_crate);
+	if (crate->parallel.yes) {
+		VECTOR_FREE(&crate->parallel.slot_vec);
+		thread_condvar_clean(&crate->parallel.done);
+		thread_condvar_clean(&crate->parallel.work);
+		thread_mutex_clean(&crate->parallel.mutex);
+	}
+	step_free(crate);
+	FREE(crate->merge.buf);
+	if (crate->verify.is_async) {
+		VECTOR_FREE(&crate->verify.job_vec);
+		thread_condvar_clean(&crate->verify.done);
+		thread_condvar_clean(&crate->verify.work);
+		thread_mutex_clean(&crate->verify.mutex);
+	}
+	for (i = 0; i < LENGTH(crate->shadow.group); ++i) {
+		thread_mutex_clean(&crate->shadow.group[i].mutex);
+		VECTOR_FREE(&crate->shadow.group[i].module_ref_vec);
+	}
+	thread_mutex_clean(&crate->init.mutex);
 	thread_mutex_clean(&crate->mutex);
+	FREE(crate->sg.array);
+	FREE(crate->sg.scratch);
 	map_blt_dst_free(&crate->shadow.dst);
+	map_blt_pool_free(&crate->blt_pool);
 	TAILQ_REMOVE(&g_crate_list, crate, next);
+	if (TAILQ_EMPTY(&g_crate_list)) {
+		thread_mutex_clean(&g_thread_mutex);
+	}
 	FREE(crate->name);
 	FREE(*a_crate);
 	LOGF(info)(LOGL, "crate_free }");
@@ -933,6 +1557,15 @@ crate_get_name(struct Crate const *a_crate)
 	return a_crate->name;
 }
 
+struct Crate *
+crate_get_next(struct Crate const *a_crate)
+{
+	struct Crate *next;
+
+	next = TAILQ_NEXT(a_crate, next);
+	return TAILQ_END(&g_crate_list) == next ? NULL : next;
+}
+
 void
 crate_gsi_pex_goc_read(uint8_t a_crate_i, uint8_t a_sfp, uint16_t a_card,
     uint32_t a_offset, uint16_t a_num, uint32_t *a_value)
@@ -954,7 +1587,7 @@ crate_gsi_pex_goc_read(uint8_t a_crate_i, uint8_t a_sfp, uint16_t a_card,
 	if (NULL == pex) {
 		goto crate_gsi_pex_goc_read_done;
 	}
-	THREAD_MUTEX_LOCK(&crate->mutex);
+	mutex_lock_all(crate);
 	for (i = 0; i < a_num; ++i) {
 		uint32_t u32;
 
@@ -963,7 +1596,7 @@ crate_gsi_pex_goc_read(uint8_t a_crate_i, uint8_t a_sfp, uint16_t a_card,
 			a_value[i] = u32;
 		}
 	}
-	thread_mutex_unlock(&crate->mutex);
+	mutex_unlock_all(crate);
 crate_gsi_pex_goc_read_done:
 	LOGF(spam)(LOGL, "crate_gsi_pex_goc_read }");
 #else
@@ -997,7 +1630,7 @@ crate_gsi_pex_goc_write(uint8_t a_crate_i, uint8_t a_sfp, uint16_t a_card,
 	if (NULL == pex) {
 		goto crate_gsi_pex_goc_write_done;
 	}
-	THREAD_MUTEX_LOCK(&crate->mutex);
+	mutex_lock_all(crate);
 	ofs = a_offset;
 	for (i = 0; i < a_num; ++i) {
 		int ret;
@@ -1006,7 +1639,7 @@ crate_gsi_pex_goc_write(uint8_t a_crate_i, uint8_t a_sfp, uint16_t a_card,
 		ofs += sizeof a_value;
 		(void)ret;
 	}
-	thread_mutex_unlock(&crate->mutex);
+	mutex_unlock_all(crate);
 crate_gsi_pex_goc_write_done:
 	LOGF(spam)(LOGL, "crate_gsi_pex_goc_write }");
 #else
@@ -1045,6 +1678,9 @@ void
 crate_info_pack(struct Packer *a_packer, int a_crate_i)
 {
 	struct Crate const *crate;
+	struct Module const *module;
+	unsigned num;
+	size_t i;
 
 	LOGF(debug)(LOGL, "crate_info_pack(cr=%d) {", a_crate_i);
 	crate = get_crate(a_crate_i);
@@ -1054,9 +1690,50 @@ crate_info_pack(struct Packer *a_packer, int a_crate_i)
 	} else {
 		PACK(*a_packer, 16, crate->event_max_override, fail);
 		PACK(*a_packer,  8, crate->dt_release.do_it, fail);
+		PACK(*a_packer,  8, MIN(crate->dt_release.step_i, 0xff), fail);
+		PACK(*a_packer,  8, MIN(crate->step.readout_vec.size, 0xff),
+		    fail);
 		PACK(*a_packer, 16, crate->acvt.ns, fail);
+		PACK(*a_packer, 16, crate->acvt.step_ns, fail);
+		for (i = 0; i < LENGTH(crate->acvt.poll_hist); ++i) {
+			PACK(*a_packer, 32, crate->acvt.poll_hist[i], fail);
+		}
+		PACK(*a_packer,  8, crate->acvt.history_num, fail);
+		for (i = 0; i < crate->acvt.history_num; ++i) {
+			PACK(*a_packer, 16, MIN(crate->acvt.history[i].ns,
+			    0xffff), fail);
+			PACK(*a_packer, 16, MIN(crate->acvt.history[i].
+			    event_num, 0xffff), fail);
+			PACK(*a_packer, 16, MIN(crate->acvt.history[i].
+			    miss_num, 0xffff), fail);
+		}
 		PACK(*a_packer, 32, crate->shadow.buf_bytes, fail);
 		PACK(*a_packer, 32, crate->shadow.max_bytes, fail);
+		PACK(*a_packer, 32, crate->poll.event_num, fail);
+		PACK(*a_packer, 32, crate->poll.sum, fail);
+		PACK(*a_packer, 32, crate->poll.max, fail);
+		num = 0;
+		TAILQ_FOREACH(module, &crate->module_list, next) {
+			num += NULL != module->props &&
+			    NULL != module->props->readout_shadow;
+		}
+		num = MIN(num, CTRL_SHADOW_MODULE_MAX);
+		PACK(*a_packer,  8, num, fail);
+		TAILQ_FOREACH(module, &crate->module_list, next) {
+			if (0 == num) {
+				break;
+			}
+			if (NULL == module->props ||
+			    NULL == module->props->readout_shadow) {
+				continue;
+			}
+			PACK(*a_packer,  8, module->id, fail);
+			PACK(*a_packer, 32, module->shadow.ring.store.bytes,
+			    fail);
+			PACK(*a_packer, 32, module->shadow.max_bytes, fail);
+			PACK(*a_packer, 32, module->shadow.fill_max, fail);
+			--num;
+		}
 	}
 fail:
 	LOGF(debug)(LOGL, "crate_info_pack }");
@@ -1071,7 +1748,11 @@ crate_init(struct Crate *a_crate)
 
 	LOGF(info)(LOGL, "crate_init(%s) {", a_crate->name);
 
-	THREAD_MUTEX_LOCK(&a_crate->mutex);
+	mutex_lock_all(a_crate);
+	if (!a_crate->is_map_user) {
+		a_crate->is_map_user = 1;
+		++g_map_user_num;
+	}
 crate_init_there_is_no_try:
 	if (NULL != a_crate->gsi_pex.config) {
 		if (NULL == a_crate->gsi_pex.pex) {
@@ -1080,7 +1761,6 @@ crate_init_there_is_no_try:
 		}
 		gsi_pex_init(a_crate->gsi_pex.pex, a_crate->gsi_pex.config);
 	}
-	a_crate->shadow.module_readable_num = 0;
 #define INIT_BATCH_WITH_CRATE(name, member) do {\
 		if (!name##_init_slow(a_crate,&a_crate->member)) {\
 			goto crate_init_done;\
@@ -1093,21 +1773,8 @@ crate_init_there_is_no_try:
 	} while (0)
 #define INIT_CRATE(name) INIT_BATCH(name, name)
 	INIT_CRATE(gsi_sam_crate);
-	/* Init_slow. */
-	TAILQ_FOREACH(module, &a_crate->module_list, next) {
-		if (NULL == module->props) {
-			continue;
-		}
-		LOGF(info)(LOGL, "Slow-init module[%u]=%s.", module->id,
-		    keyword_get_string(module->type));
-		push_log_level(module);
-		a_crate->module_init_id = module->id;
-		if (!module->props->init_slow(a_crate, module)) {
-			pop_log_level(module);
-			goto crate_init_done;
-		}
-		module_init_id_mark(a_crate, module);
-		pop_log_level(module);
+	if (!init_slow_all(a_crate)) {
+		goto crate_init_done;
 	}
 	module_init_id_clear(a_crate);
 	/*
@@ -1140,6 +1807,26 @@ crate_init_there_is_no_try:
 		}
 		LOGF(verbose)(LOGL, "%s: max events/trig=%u.", tag->name,
 		    tag->event_max);
+		tag->event_max_cap = tag->event_max;
+	}
+	if (a_crate->event_max_auto.do_it) {
+		struct Module *rover;
+
+		/*
+		 * Shadow data and free-running readouts don't follow the
+		 * crate counters, so there is no bytes/event to learn.
+		 */
+		if (crate_get_do_shadow(a_crate) ||
+		    a_crate->is_free_running) {
+			log_error(LOGL, "%s: event_max_auto needs triggered "
+			    "non-shadow readout, disabling.", a_crate->name);
+			a_crate->event_max_auto.do_it = 0;
+		}
+		a_crate->event_max_auto.readout_num = 0;
+		a_crate->event_max_auto.buf_bytes = (size_t)-1;
+		TAILQ_FOREACH(rover, &a_crate->module_list, next) {
+			rover->event_bytes_max = 0;
+		}
 	}
 	if (NULL != a_crate->trloii_multi_event.module) {
 		trloii_multi_event_set_limit(
@@ -1209,6 +1896,7 @@ crate_init_there_is_no_try:
 		}
 		counter->prev = counter->cur.value;
 	}
+	step_build(a_crate);
 	/* If triggered, check that modules are empty. */
 	if (!a_crate->is_free_running &&
 	    0 != check_empty(a_crate)) {
@@ -1224,18 +1912,18 @@ crate_init_there_is_no_try:
 			module->crate_counter_prev =
 			    module->crate_counter->value;
 		}
-		if (0 != module->event_max) {
-			++a_crate->shadow.module_readable_num;
-		}
 	}
 
 	if (crate_get_do_shadow(a_crate)) {
-		LOGF(info)(LOGL, "Starting shadow thread.");
-		a_crate->shadow.is_running = 1;
-		if (!thread_start(&a_crate->shadow.thread, shadow_func,
-		    a_crate)) {
-			log_die(LOGL, "Could not start shadow thread.");
-		}
+		shadow_start(a_crate);
+	}
+
+	if (a_crate->parallel.yes) {
+		parallel_start(a_crate);
+	}
+
+	if (a_crate->verify.is_async) {
+		verify_start(a_crate);
 	}
 
 	/* This is used to e.g. start the MVLC sequencer - should be late. */
@@ -1244,21 +1932,26 @@ crate_init_there_is_no_try:
 	}
 
 	a_crate->state = STATE_PREPARED;
-	a_crate->shadow.do_buf_rebuild = 1;
 crate_init_done:
 	module_init_id_clear(a_crate);
 	if (STATE_REINIT == a_crate->state) {
 		/* TODO: Do we really want to open the mutex? */
-		thread_mutex_unlock(&a_crate->mutex);
+		mutex_unlock_all(a_crate);
 		crate_deinit(a_crate);
-		THREAD_MUTEX_LOCK(&a_crate->mutex);
+		mutex_lock_all(a_crate);
 		time_sleep(a_crate->reinit_sleep_s);
 		goto crate_init_there_is_no_try;
 	}
-	thread_mutex_unlock(&a_crate->mutex);
+	mutex_unlock_all(a_crate);
 	LOGF(info)(LOGL, "crate_init(%s) }", a_crate->name);
 }
 
+size_t
+crate_init_get_thread_num(struct Crate const *a_crate)
+{
+	return a_crate->init.thread_num;
+}
+
 void
 crate_memtest(struct Crate const *a_crate, int a_chunks)
 {
@@ -1302,9 +1995,9 @@ crate_module_access_pack(uint8_t a_crate_i, uint8_t a_module_j, int
 		PACKER_LIST_PACK_STR(*a_list, "Module not found");
 		goto done;
 	}
-	THREAD_MUTEX_LOCK(&crate->mutex);
+	mutex_lock_all(crate);
 	module_access_pack(a_list, a_packer, module, a_submodule_k);
-	thread_mutex_unlock(&crate->mutex);
+	mutex_unlock_all(crate);
 done:
 	LOGF(debug)(LOGL, "crate_module_access_pack }");
 }
@@ -1337,6 +2030,22 @@ crate_module_get_num(struct Crate const *a_crate)
 void
 crate_module_remap_id(struct Crate *a_crate, unsigned a_from, unsigned a_to)
 {
+	size_t i;
+
+	THREAD_MUTEX_LOCK(&a_crate->init.mutex);
+	/* Slow-init groups may run in parallel, find the caller's group. */
+	for (i = 0; i < a_crate->init.group_num; ++i) {
+		struct CrateInitGroup *group;
+
+		group = &a_crate->init.group_array[i];
+		if (0 != group->module_ref_vec.size &&
+		    a_from == group->init_id) {
+			group->init_id = a_to;
+			thread_mutex_unlock(&a_crate->init.mutex);
+			return;
+		}
+	}
+	thread_mutex_unlock(&a_crate->init.mutex);
 	if (a_crate->module_init_id != a_from) {
 		log_die(LOGL, "Module id=%u, but tried to remap id=%u!",
 		    a_crate->module_init_id, a_from);
@@ -1391,18 +2100,22 @@ uint32_t
 crate_readout_dt(struct Crate *a_crate)
 {
 	struct CrateCounter *counter;
-	struct Module *module;
-	double t0;
-	uint32_t result;
-	unsigned for_it;
+	struct CrateStep *step;
+	uint64_t t0, t_phase;
+	uint32_t result, poll_num;
 
 	LOGF(spam)(LOGL, "crate_readout_dt(%s) {", a_crate->name);
 	result = 0;
+	poll_num = 0;
+
+	/* Segments of the previous event must be let go by now. */
+	crate_readout_sg_release(a_crate);
 
 	/* Reset eb_final pointers so they don't point to old data. */
-	TAILQ_FOREACH(module, &a_crate->module_list, next) {
-		module->eb_final.ptr = NULL;
-		module->eb_final.bytes = 0;
+	VECTOR_FOREACH(step, &a_crate->step.readout_vec) {
+		step->module->eb_final.ptr = NULL;
+		step->module->eb_final.bytes = 0;
+		step->module->eb_final_place = EB_FINAL_EVENT_BUFFER;
 	}
 
 	if (STATE_REINIT == a_crate->state) {
@@ -1413,18 +2126,25 @@ crate_readout_dt(struct Crate *a_crate)
 		 * a strange state, so we have to clear and wait until the
 		 * next event.
 		 */
-		crate_deinit(a_crate);
-		time_sleep(a_crate->reinit_sleep_s);
-		crate_init(a_crate);
+		recover(a_crate, 1);
 		goto crate_readout_dt_done;
 	}
 
 	/*
 	 * In-dt readout.
 	 */
-	THREAD_MUTEX_LOCK(&a_crate->mutex);
+	mutex_lock_all(a_crate);
+
+	/*
+	 * Rings can only move when they are drained, the producer is held
+	 * off by the mutex.
+	 */
+	if (a_crate->shadow.do_buf_rebuild && shadow_is_empty(a_crate)) {
+		shadow_buf_rebuild(a_crate);
+	}
 
 	/* Counters. */
+	t_phase = time_getns();
 	TAILQ_FOREACH(counter, &a_crate->counter_list, next) {
 		if (NULL != counter->scaler) {
 			counter->scaler->get_counter(counter->scaler->module,
@@ -1437,38 +2157,37 @@ crate_readout_dt(struct Crate *a_crate)
 		    COUNTER_DIFF_RAW(counter->cur, counter->prev));
 	}
 
-	t0 = time_getd();
+	t0 = time_getns();
+	time_stat_add(&a_crate->dt_stat[CTRL_DT_COUNTER], t0 - t_phase);
 
 	/* All module event counters. */
-	a_crate->dt_release.for_it = 0;
-	for_it = 0;
-	TAILQ_FOREACH(module, &a_crate->module_list, next) {
+	VECTOR_FOREACH(step, &a_crate->step.dt_vec) {
+		struct Module *module;
 		uint32_t diff_module, diff_shadow;
+		uint64_t t1;
 		int ok;
 
-		if (module->skip_dt) {
-			LOGF(spam)(LOGL, "module[%d]->skip_dt.", module->id);
-			continue;
-		}
-		if (0 == module->event_max) {
-			LOGF(spam)(LOGL, "module[%d]->event_max == 0. "
-			    "Skipping readout_dt.", module->id);
-			continue;
-		}
+		module = step->module;
 		push_log_level(module);
 		ok = 0;
 		diff_shadow = 0xdeadbeef;
 		diff_module = 0xdeadbeef;
+		module->poll.num = 0;
+		a_crate->poll.backoff_s = MAX(a_crate->poll.spin_s, 1e-6);
+		t1 = t0;
 		/*
-		 * Busy wait until we have event counter, and shadow data
-		 * counters if applicable.
+		 * Poll until we have event counter, and shadow data counters
+		 * if applicable.
 		 */
 		for (;;) {
 			struct Counter shadow_counter;
-			double t;
+			uint64_t t;
 			uint32_t ret;
 
-			ret = module->props->readout_dt(a_crate, module);
+			if (0 == module->poll.num++) {
+				t1 = time_getns();
+			}
+			ret = step->readout_dt(a_crate, module);
 			module->result |= ret;
 			if (0 != ret) {
 				log_error(LOGL, "%s[%u]=%s: readout_dt failed"
@@ -1486,22 +2205,20 @@ crate_readout_dt(struct Crate *a_crate)
 			}
 			diff_module = COUNTER_DIFF(*module->crate_counter,
 			    module->event_counter, module->this_minus_crate);
-			/* TODO: Clean this. */
-			shadow_counter.value =
-			    module->shadow.data_counter_value;
+			shadow_ring_scan(module);
+			shadow_counter.value = module->shadow.ring.scan_counter;
 			shadow_counter.mask = module->event_counter.mask;
 			diff_shadow = COUNTER_DIFF(*module->crate_counter,
 			    shadow_counter, module->this_minus_crate);
 			if (0 == diff_module &&
-			    (!crate_get_do_shadow(a_crate) ||
-			     NULL == module->props->readout_shadow ||
+			    (0 == (STEP_SHADOW & step->flags) ||
 			     0 == diff_shadow)) {
 				ok = 1;
 				break;
 			}
 			crate_acvt_grow(a_crate);
-			t = time_getd();
-			if (t > t0 + DT_TIMEOUT) {
+			t = time_getns();
+			if (1e9 * DT_TIMEOUT < t - t0) {
 				log_error(LOGL, "%s[%u]=%s: readout_dt "
 				    "timeout, trigger/master-start missing?",
 				    a_crate->name, module->id,
@@ -1515,9 +2232,10 @@ crate_readout_dt(struct Crate *a_crate)
 				 */
 				break;
 			}
-			thread_mutex_unlock(&a_crate->mutex);
-			sched_yield();
-			THREAD_MUTEX_LOCK(&a_crate->mutex);
+			mutex_unlock_all(a_crate);
+			a_crate->poll.wait(a_crate, module, module->poll.num,
+			    1e-9 * (t - t1));
+			mutex_lock_all(a_crate);
 			/*
 			 * TODO: This will suppress the successful
 			 * readout_dt :( Keep a short list of suppressed logs?
@@ -1526,17 +2244,19 @@ crate_readout_dt(struct Crate *a_crate)
 		}
 		log_suppress_all_levels(0);
 		pop_log_level(module);
+		time_stat_add(&module->dt_stat.readout_dt, time_getns() - t1);
+		if (ok && !a_crate->is_free_running) {
+			double latency;
+
+			/* Slowly learn how long this module usually takes. */
+			latency = 1 == module->poll.num ? 0.0 :
+			    1e-9 * (time_getns() - t1);
+			module->poll.latency += (latency -
+			    module->poll.latency) / 8;
+		}
+		poll_num += module->poll.num;
 		result |= module->result;
-		if (ok) {
-			if (0 == (MODULE_FLAG_EARLY_DT &
-			    module->props->flags)) {
-				/*
-				 * Cannot release DT until after this module
-				 * in "crate_readout".
-				 */
-				a_crate->dt_release.for_it = for_it + 1;
-			}
-		} else {
+		if (!ok) {
 			log_error(LOGL, "%s[%u]=%s: Event counter: "
 			    "crate=0x%08x/%u, this-crate=0x%08x, "
 			    "module=0x%08x/%u diff=0x%08x, "
@@ -1549,69 +2269,44 @@ crate_readout_dt(struct Crate *a_crate)
 			    module->event_counter.value,
 			    bits_get_count(module->event_counter.mask),
 			    diff_module,
-			    module->shadow.data_counter_value,
+			    module->shadow.ring.scan_counter,
 			    bits_get_count(module->event_counter.mask),
 			    diff_shadow);
 		}
-		if (crate_get_do_shadow(a_crate) &&
-		    NULL != module->props->readout_shadow) {
-			struct ModuleShadowBuffer *next;
-
+		if (STEP_SHADOW & step->flags) {
 			/*
-			 * Switch buffers so the shadow thread can continue.
+			 * Everything scanned so far belongs to this event,
+			 * the shadow thread keeps filling in after the cut.
 			 */
-			THREAD_MUTEX_LOCK(&module->shadow.buf_mutex);
-			module->shadow.buf_idx ^= 1;
-			next = &module->shadow.buf[module->shadow.buf_idx];
-			COPY(next->eb, next->store);
-			thread_mutex_unlock(&module->shadow.buf_mutex);
+			module->shadow.ring.cut = module->shadow.ring.scan;
+			shadow_ring_full_check(a_crate, module);
 		}
-		++for_it;
 	}
 
-	if (a_crate->dt_release.do_it &&
-	    a_crate->dt_release.for_it_prev != a_crate->dt_release.for_it) {
-		LOGF(info)(LOGL,
-		    "DT release possible on module # %u/%u.",
-		    a_crate->dt_release.for_it, for_it);
-	    a_crate->dt_release.for_it_prev = a_crate->dt_release.for_it;
+	time_stat_add(&a_crate->dt_stat[CTRL_DT_READOUT_DT], time_getns() -
+	    t0);
+
+	if (0 != poll_num) {
+		++a_crate->poll.event_num;
+		a_crate->poll.sum += poll_num;
+		a_crate->poll.max = MAX(a_crate->poll.max, poll_num);
 	}
 
 	if (a_crate->acvt.yes) {
-		int ns;
-
 		/*
 		 * ACVT is done every N:th readout (single-event, multi-event
 		 * etc) which should be somewhat correlated to the # of events
 		 * that poll for data.
 		 */
-		assert(NULL != a_crate->acvt.module &&
-		    NULL != a_crate->acvt.set_cvt);
-		ns = -1;
-		if (a_crate->acvt.do_grow) {
-			a_crate->acvt.pioneer_counter = 0;
-			ns = a_crate->acvt.ns + 100;
-			a_crate->acvt.do_grow = 0;
-		} else {
-			++a_crate->acvt.pioneer_counter;
-			if (1000 < a_crate->acvt.pioneer_counter) {
-				a_crate->acvt.pioneer_counter = 0;
-				ns = a_crate->acvt.ns < 100 ? 0 :
-				    a_crate->acvt.ns - 100;
-			}
-		}
-		if (-1 != ns && (unsigned)ns != a_crate->acvt.ns) {
-			LOGF(debug)(LOGL, "ACVT = %u ns.", ns);
-			a_crate->acvt.ns = ns;
-			a_crate->acvt.set_cvt(a_crate->acvt.module, ns);
-		}
+		acvt_update(a_crate, poll_num < a_crate->step.dt_vec.size ?
+		    0 : poll_num - a_crate->step.dt_vec.size);
 	}
 
 	if (0 != a_crate->module_configed_vec.size) {
 		crate_dt_release_inhibit_once(a_crate);
 	}
 
-	thread_mutex_unlock(&a_crate->mutex);
+	mutex_unlock_all(a_crate);
 
 crate_readout_dt_done:
 	if (0 == result) {
@@ -1630,9 +2325,10 @@ uint32_t
 crate_readout(struct Crate *a_crate, struct EventBuffer *a_event_buffer)
 {
 	struct EventBuffer eb_orig;
-	struct Module *module;
+	struct CrateStep *step;
+	uint64_t t_phase;
 	uint32_t result;
-	unsigned is_mutex, for_it;
+	unsigned is_mutex;
 
 	LOGF(spam)(LOGL, "crate_readout(%s) {", a_crate->name);
 	COPY(eb_orig, *a_event_buffer);
@@ -1640,53 +2336,73 @@ crate_readout(struct Crate *a_crate, struct EventBuffer *a_event_buffer)
 	if (STATE_READY != a_crate->state) {
 		goto crate_readout_done;
 	}
-	/* Read/merge all modules, release dt when it's safe. */
+	/* Held segments may still point into the pool. */
+	if (NULL != a_crate->blt_pool && !a_crate->sg.is_held) {
+		map_blt_pool_reset(a_crate->blt_pool);
+	}
 	is_mutex = 0;
-	for_it = 0;
-	TAILQ_FOREACH(module, &a_crate->module_list, next) {
-		if (a_crate->dt_release.for_it == for_it) {
+	t_phase = time_getns();
+	if (a_crate->event_max_auto.do_it) {
+		a_crate->event_max_auto.buf_bytes = MIN(
+		    a_crate->event_max_auto.buf_bytes, eb_orig.bytes);
+	}
+	if (a_crate->parallel.is_running) {
+		result = parallel_readout(a_crate, a_event_buffer);
+		goto crate_readout_check;
+	}
+	/* Read/merge all modules, release dt when it's safe. */
+	VECTOR_FOREACH(step, &a_crate->step.readout_vec) {
+		if (a_crate->dt_release.step_i == (unsigned)(step -
+		    a_crate->step.readout_vec.array)) {
 			dt_release(a_crate);
 		}
-		if (KW_BARRIER == module->type) {
+		if (STEP_BARRIER & step->flags) {
 			uint32_t *p32;
 
 			p32 = a_event_buffer->ptr;
 			*p32++ = BARRIER_WORD;
 			EVENT_BUFFER_ADVANCE(*a_event_buffer, p32);
-		} else if (0 == module->event_max) {
-		} else if (!crate_get_do_shadow(a_crate) ||
-		    NULL == module->props->readout_shadow) {
+		} else if (0 == (STEP_SHADOW & step->flags)) {
 			if (!is_mutex) {
-				THREAD_MUTEX_LOCK(&a_crate->mutex);
+				mutex_lock_all(a_crate);
 				is_mutex = 1;
 			}
-			result |= read_module(a_crate, module,
-			    a_event_buffer);
+			result |= read_module(a_crate, step->module,
+			    a_event_buffer, 1);
 		} else {
 			if (is_mutex) {
-				thread_mutex_unlock(&a_crate->mutex);
+				mutex_unlock_all(a_crate);
 				is_mutex = 0;
 			}
-			result |= shadow_merge_module(a_crate, module,
+			result |= shadow_merge_module(a_crate, step->module,
 			    a_event_buffer);
 		}
-		++for_it;
 	}
+	result |= pipeline_flush(a_crate);
+	if (a_crate->merge.do_it && 0 == result) {
+		result |= merge_event(a_crate, &eb_orig, a_event_buffer);
+	}
+crate_readout_check:
+	time_stat_add(&a_crate->dt_stat[CTRL_DT_READOUT], time_getns() -
+	    t_phase);
 	if (0 == result) {
 		if (!a_crate->is_free_running &&
 		    crate_dt_is_on(a_crate)) {
 			if (!is_mutex) {
-				THREAD_MUTEX_LOCK(&a_crate->mutex);
+				mutex_lock_all(a_crate);
 				is_mutex = 1;
 			}
+			t_phase = time_getns();
 			result |= check_empty(a_crate);
+			time_stat_add(&a_crate->dt_stat[CTRL_DT_CHECK_EMPTY],
+			    time_getns() - t_phase);
 		}
 	} else {
 		a_crate->state = STATE_REINIT;
 		log_error(LOGL, "%s: readout failed!", a_crate->name);
 	}
 	if (is_mutex) {
-		thread_mutex_unlock(&a_crate->mutex);
+		mutex_unlock_all(a_crate);
 	}
 crate_readout_done:
 	EVENT_BUFFER_INVARIANT(eb_orig, *a_event_buffer);
@@ -1694,12 +2410,69 @@ crate_readout_done:
 	return result;
 }
 
+uint32_t
+crate_readout_sg(struct Crate *a_crate, struct EventBuffer *a_event_buffer,
+    struct EventConstBuffer const **a_seg_array, size_t *a_seg_num)
+{
+	uint32_t result;
+
+	LOGF(spam)(LOGL, "crate_readout_sg(%s) {", a_crate->name);
+	if (a_crate->merge.do_it) {
+		/* Merging rewrites the event-buffer, segments point outside. */
+		log_die(LOGL, "%s: Time-sorted merging and segmented readout "
+		    "are exclusive!", a_crate->name);
+	}
+	crate_readout_sg_release(a_crate);
+	a_crate->sg.is_on = 1;
+	a_crate->sg.flush_ptr = a_event_buffer->ptr;
+	a_crate->sg.num = 0;
+	result = crate_readout(a_crate, a_event_buffer);
+	sg_flush(a_crate, a_event_buffer->ptr);
+	a_crate->sg.is_on = 0;
+	*a_seg_array = a_crate->sg.array;
+	*a_seg_num = a_crate->sg.num;
+	LOGF(spam)(LOGL, "crate_readout_sg(%s,segments=%"PRIz",0x%08x) }",
+	    a_crate->name, a_crate->sg.num, result);
+	return result;
+}
+
+void
+crate_readout_sg_release(struct Crate *a_crate)
+{
+	struct Module *module;
+
+	if (!a_crate->sg.is_held) {
+		return;
+	}
+	/* The verify thread may still read held memory. */
+	verify_drain(a_crate);
+	TAILQ_FOREACH(module, &a_crate->module_list, next) {
+		struct ModuleShadowRing *ring;
+
+		ring = &module->shadow.ring;
+		if (ring->tail != ring->cut) {
+			ATOMIC_STORE(&ring->tail, ring->cut);
+		}
+	}
+	a_crate->sg.is_held = 0;
+	if (a_crate->recover.is_deferred) {
+		a_crate->recover.is_deferred = 0;
+		recover(a_crate, a_crate->recover.is_final);
+		if (!a_crate->recover.is_final) {
+			/* Same as crate_readout_finalize, again in dt. */
+			a_crate->state = STATE_REINIT;
+		}
+	}
+}
+
 void
 crate_readout_finalize(struct Crate *a_crate)
 {
 	struct CrateCounter *counter;
 
 	LOGF(spam)(LOGL, "crate_readout_finalize(%s) {", a_crate->name);
+	/* The event buffer is still ours, collect deferred parse errors. */
+	verify_drain(a_crate);
 #if 0
 	if (a_crate->do_pedestals) {
 		struct Module **module_ref;
@@ -1721,21 +2494,26 @@ crate_readout_finalize(struct Crate *a_crate)
 	TAILQ_FOREACH(counter, &a_crate->counter_list, next) {
 		counter->prev = counter->cur.value;
 	}
+	if (a_crate->event_max_auto.do_it &&
+	    STATE_READY == a_crate->state &&
+	    ++a_crate->event_max_auto.readout_num >=
+	    a_crate->event_max_auto.window) {
+		event_max_tune(a_crate);
+	}
+	if (STATE_REINIT != a_crate->state) {
+		/* Clean event, the next failure may be cleared again. */
+		a_crate->recover.was_cleared = 0;
+	}
 	if (STATE_REINIT == a_crate->state) {
 		/*
 		 * If the readout failed, we must re-init to clear all modules
 		 * to make sure upcoming triggers are not blocked by module
 		 * dt.
 		 */
-		log_error(LOGL, "%s: had problems, re-initializing.",
-		    a_crate->name);
-		crate_deinit(a_crate);
-		time_sleep(a_crate->reinit_sleep_s);
-		crate_init(a_crate);
+		recover(a_crate, crate_dt_is_on(a_crate));
 		/*
 		 * If dt is already released, we might have accepted garbage
-		 * data so we must re-init also in 'prepare' to be sure.
-		 * TODO: 'clear' method for modules to avoid double-init?
+		 * data so we must recover also in 'prepare' to be sure.
 		 */
 		if (!crate_dt_is_on(a_crate)) {
 			a_crate->state =  STATE_REINIT;
@@ -1762,7 +2540,7 @@ crate_readout_finalize(struct Crate *a_crate)
 			    KW_GSI_FEBEX == module->type ||
 			    KW_GSI_TAMEX == module->type;
 		}
-		THREAD_MUTEX_LOCK(&a_crate->mutex);
+		mutex_lock_all(a_crate);
 #if 0
 		/* TODO: Why was this here? */
 		if (do_pex) {
@@ -1775,15 +2553,33 @@ crate_readout_finalize(struct Crate *a_crate)
 #endif
 		VECTOR_FOREACH(module_ref, &a_crate->module_configed_vec) {
 			struct Module *module;
+			struct Map *map;
+			uint32_t issued0, skipped0;
 
 			module = *module_ref;
 			LOGF(info)(LOGL, "%s[%u]=%s re-config.",
 			    a_crate->name, module->id,
 			    keyword_get_string(module->type));
 			a_crate->module_init_id = module->id;
+			map = write_cache_get_map(module);
+			if (NULL != map) {
+				map_sicy_shadow_get_stats(map, &issued0,
+				    &skipped0);
+				map_sicy_shadow_skip(map, 1);
+			}
 			if (!module->props->init_fast(a_crate, module)) {
 				a_crate->state = STATE_REINIT;
 			}
+			if (NULL != map) {
+				uint32_t issued, skipped;
+
+				map_sicy_shadow_skip(map, 0);
+				map_sicy_shadow_get_stats(map, &issued,
+				    &skipped);
+				LOGF(verbose)(LOGL, "Register writes "
+				    "issued=%u skipped=%u.", issued - issued0,
+				    skipped - skipped0);
+			}
 			module_init_id_mark(a_crate, module);
 			/* TODO: Should we post-init? */
 			if (!module->props->post_init(a_crate, module)) {
@@ -1799,7 +2595,7 @@ crate_readout_finalize(struct Crate *a_crate)
 				a_crate->state = STATE_REINIT;
 			}
 		}
-		thread_mutex_unlock(&a_crate->mutex);
+		mutex_unlock_all(a_crate);
 	}
 	LOGF(spam)(LOGL, "crate_readout_finalize(%s) }", a_crate->name);
 }
@@ -1827,9 +2623,9 @@ crate_register_array_pack(struct PackerList *a_list, int a_crate_i, int
 		PACKER_LIST_PACK_STR(*a_list, "Module not found");
 		goto crate_register_array_pack_done;
 	}
-	THREAD_MUTEX_LOCK(&crate->mutex);
+	mutex_lock_all(crate);
 	module_register_list_pack(a_list, module, a_submodule_k);
-	thread_mutex_unlock(&crate->mutex);
+	mutex_unlock_all(crate);
 crate_register_array_pack_done:
 	LOGF(debug)(LOGL, "crate_register_array_pack }");
 }
@@ -1858,10 +2654,80 @@ crate_setup(void)
 	config_auto_register(KW_TAGS, "tags.cfg");
 }
 
+/* Returns the next step size, 'a_dir' is 1 to grow and -1 to shrink. */
+unsigned
+acvt_step(struct Crate *a_crate, int a_dir)
+{
+	if (a_dir == a_crate->acvt.dir) {
+		a_crate->acvt.step_ns = MIN(a_crate->acvt.step_ns * 2,
+		    ACVT_STEP_MAX_NS);
+	} else if (0 != a_crate->acvt.dir) {
+		a_crate->acvt.step_ns = MAX(a_crate->acvt.step_ns / 2,
+		    ACVT_STEP_MIN_NS);
+	}
+	a_crate->acvt.dir = a_dir;
+	return a_crate->acvt.step_ns;
+}
+
+/*
+ * Closed-loop conversion time, grows as soon as the window has more waiting
+ * events than allowed, and shrinks when a full window stayed within the
+ * allowance. The step halves on every turn, so the conversion time settles
+ * around the smallest value that meets the miss rate.
+ */
+void
+acvt_update(struct Crate *a_crate, unsigned a_poll_extra)
+{
+	unsigned bucket, ns, i;
+
+	assert(NULL != a_crate->acvt.module &&
+	    NULL != a_crate->acvt.set_cvt);
+	for (bucket = 0; 0 != a_poll_extra; a_poll_extra >>= 1) {
+		++bucket;
+	}
+	++a_crate->acvt.poll_hist[MIN(bucket,
+	    LENGTH(a_crate->acvt.poll_hist) - 1)];
+	++a_crate->acvt.event_num;
+	if (a_crate->acvt.do_grow) {
+		++a_crate->acvt.miss_num;
+		a_crate->acvt.do_grow = 0;
+	}
+	if (a_crate->acvt.miss_num > a_crate->acvt.miss_rate *
+	    a_crate->acvt.window) {
+		ns = a_crate->acvt.ns + acvt_step(a_crate, 1);
+	} else if (a_crate->acvt.event_num >= a_crate->acvt.window) {
+		unsigned step;
+
+		step = acvt_step(a_crate, -1);
+		ns = a_crate->acvt.ns < step ? 0 : a_crate->acvt.ns - step;
+	} else {
+		return;
+	}
+	if (LENGTH(a_crate->acvt.history) == a_crate->acvt.history_num) {
+		for (i = 1; i < LENGTH(a_crate->acvt.history); ++i) {
+			COPY(a_crate->acvt.history[i - 1],
+			    a_crate->acvt.history[i]);
+		}
+		--a_crate->acvt.history_num;
+	}
+	i = a_crate->acvt.history_num++;
+	a_crate->acvt.history[i].ns = a_crate->acvt.ns;
+	a_crate->acvt.history[i].event_num = a_crate->acvt.event_num;
+	a_crate->acvt.history[i].miss_num = a_crate->acvt.miss_num;
+	a_crate->acvt.event_num = 0;
+	a_crate->acvt.miss_num = 0;
+	if (ns != a_crate->acvt.ns) {
+		LOGF(debug)(LOGL, "ACVT = %u ns (step=%u ns).", ns,
+		    a_crate->acvt.step_ns);
+		a_crate->acvt.ns = ns;
+		a_crate->acvt.set_cvt(a_crate->acvt.module, ns);
+	}
+}
+
 uint32_t
 check_empty(struct Crate *a_crate)
 {
-	struct Module *module;
+	struct CrateStep *step;
 	uint32_t result;
 
 	LOGF(spam)(LOGL, "check_empty(%s) {", a_crate->name);
@@ -1874,14 +2740,13 @@ check_empty(struct Crate *a_crate)
 	}
 */
 
-	TAILQ_FOREACH(module, &a_crate->module_list, next) {
+	VECTOR_FOREACH(step, &a_crate->step.empty_vec) {
+		struct Module *module;
 		uint32_t ret;
 
-		if (NULL == module->props) {
-			continue;
-		}
+		module = step->module;
 		push_log_level(module);
-		ret = module->props->check_empty(module);
+		ret = step->check_empty(module);
 		if (0 != ret) {
 			log_error(LOGL, "%s:%u=%s: not empty.",
 			    a_crate->name, module->id,
@@ -2023,6 +2888,48 @@ crate_tag_pedestal_update(struct CrateTag *a_tag)
 }
 #endif
 
+void
+crate_thread_start(struct Crate *a_crate, size_t a_bytes,
+    CrateTriggerCallback a_trigger, CrateEventCallback a_event, void
+    *a_data)
+{
+	LOGF(info)(LOGL, "crate_thread_start(%s) {", a_crate->name);
+	if (a_crate->thread.is_running) {
+		log_die(LOGL, "%s: Crate thread already running!",
+		    a_crate->name);
+	}
+	THREAD_MUTEX_LOCK(&g_thread_mutex);
+	ATOMIC_STORE(&g_thread_num, g_thread_num + 1);
+	thread_mutex_unlock(&g_thread_mutex);
+	a_crate->thread.trigger = a_trigger;
+	a_crate->thread.event = a_event;
+	a_crate->thread.data = a_data;
+	a_crate->thread.bytes = a_bytes;
+	MALLOC(a_crate->thread.buf, a_bytes);
+	a_crate->thread.is_running = 1;
+	if (!thread_start(&a_crate->thread.thread, readout_func, a_crate)) {
+		log_die(LOGL, "%s: Could not start crate thread.",
+		    a_crate->name);
+	}
+	LOGF(info)(LOGL, "crate_thread_start(%s) }", a_crate->name);
+}
+
+void
+crate_thread_stop(struct Crate *a_crate)
+{
+	if (!a_crate->thread.is_running) {
+		return;
+	}
+	LOGF(info)(LOGL, "crate_thread_stop(%s) {", a_crate->name);
+	ATOMIC_STORE(&a_crate->thread.is_running, 0);
+	thread_clean(&a_crate->thread.thread);
+	FREE(a_crate->thread.buf);
+	THREAD_MUTEX_LOCK(&g_thread_mutex);
+	ATOMIC_STORE(&g_thread_num, g_thread_num - 1);
+	thread_mutex_unlock(&g_thread_mutex);
+	LOGF(info)(LOGL, "crate_thread_stop(%s) }", a_crate->name);
+}
+
 void
 dt_release(struct Crate *a_crate)
 {
@@ -2030,8 +2937,13 @@ dt_release(struct Crate *a_crate)
 	if (a_crate->dt_release.do_it &&
 	    !a_crate->dt_release.do_inhibit &&
 	    NULL != a_crate->dt_release.func) {
+		uint64_t t_0;
+
 		LOGF(spam)(LOGL, "dt_release.func {");
+		t_0 = time_getns();
 		a_crate->dt_release.func(a_crate->dt_release.data);
+		time_stat_add(&a_crate->dt_stat[CTRL_DT_RELEASE],
+		    time_getns() - t_0);
 		a_crate->dt_release.is_on = 0;
 		LOGF(spam)(LOGL, "dt_release.func }");
 	} else {
@@ -2042,6 +2954,55 @@ dt_release(struct Crate *a_crate)
 	    a_crate->dt_release.is_on ? "on" : "off");
 }
 
+/*
+ * Sets every tag limit so that a full multi-event readout of the worst
+ * bytes/event seen in the window fits in the smallest event buffer.
+ */
+void
+event_max_tune(struct Crate *a_crate)
+{
+	struct CrateTag *tag;
+	struct Module *module;
+	size_t bytes;
+
+	LOGF(spam)(LOGL, "event_max_tune(%s) {", a_crate->name);
+	bytes = 0;
+	TAILQ_FOREACH(module, &a_crate->module_list, next) {
+		bytes += module->event_bytes_max;
+		module->event_bytes_max = 0;
+	}
+	if (0 != bytes && (size_t)-1 != a_crate->event_max_auto.buf_bytes) {
+		double limit;
+
+		limit = a_crate->event_max_auto.fill *
+		    a_crate->event_max_auto.buf_bytes / bytes;
+		TAILQ_FOREACH(tag, &a_crate->tag_list, next) {
+			unsigned event_max;
+
+			event_max = MAX(1, MIN(limit, tag->event_max_cap));
+			if (event_max == tag->event_max) {
+				continue;
+			}
+			LOGF(verbose)(LOGL, "%s:%s: max events/trig=%u->%u "
+			    "(%"PRIz" B/event, buffer=0x%"PRIzx" B).",
+			    a_crate->name, tag->name, tag->event_max,
+			    event_max, bytes,
+			    a_crate->event_max_auto.buf_bytes);
+			tag->event_max = event_max;
+			if (tag == a_crate->trloii_multi_event.tag) {
+				mutex_lock_all(a_crate);
+				trloii_multi_event_set_limit(
+				    a_crate->trloii_multi_event.module,
+				    event_max);
+				mutex_unlock_all(a_crate);
+			}
+		}
+	}
+	a_crate->event_max_auto.readout_num = 0;
+	a_crate->event_max_auto.buf_bytes = (size_t)-1;
+	LOGF(spam)(LOGL, "event_max_tune(%s) }", a_crate->name);
+}
+
 struct CrateCounter *
 get_counter(struct Crate *a_crate, char const *a_name)
 {
@@ -2090,12 +3051,167 @@ get_module(struct Crate *a_crate, unsigned a_module_j)
 	return module;
 }
 
+/*
+ * Runs 'init_slow' on all modules. Modules are grouped by the configured
+ * policy and groups run in parallel threads, but modules behind the same
+ * controller or SFP chain always share a group and are inited in order.
+ */
+int
+init_slow_all(struct Crate *a_crate)
+{
+	struct Module *module;
+	uint64_t t0;
+	size_t i, group_i, thread_num;
+	int ok;
+
+	t0 = time_getns();
+	a_crate->init.group_num = BUS_NUM + a_crate->module_num;
+	CALLOC(a_crate->init.group_array, a_crate->init.group_num);
+	group_i = BUS_NUM;
+	TAILQ_FOREACH(module, &a_crate->module_list, next) {
+		struct CrateInitGroup *group;
+		size_t j;
+
+		if (NULL == module->props) {
+			continue;
+		}
+		j = 0;
+		if (KW_SINGLE != a_crate->init.group_by) {
+			j = module_bus_get(module);
+		}
+		/*
+		 * Only map modules have their own controller paths, and only
+		 * if the backend can be used from several threads at once.
+		 */
+		if (KW_MODULE == a_crate->init.group_by && BUS_MAP == j &&
+		    MAP_SICY_CONCURRENT) {
+			j = group_i++;
+		}
+		group = &a_crate->init.group_array[j];
+		VECTOR_APPEND(&group->module_ref_vec, module);
+	}
+	thread_num = 0;
+	for (i = 0; i < a_crate->init.group_num; ++i) {
+		struct CrateInitGroup *group;
+
+		group = &a_crate->init.group_array[i];
+		group->crate = a_crate;
+		group->is_ok = 1;
+		thread_num += 0 != group->module_ref_vec.size;
+	}
+	a_crate->init.thread_num = thread_num;
+	for (i = 0; i < a_crate->init.group_num; ++i) {
+		/* The log level stack is global, only touch it alone. */
+		a_crate->init.group_array[i].do_log_level = 1 >= thread_num;
+	}
+	if (1 >= thread_num) {
+		for (i = 0; i < a_crate->init.group_num; ++i) {
+			init_slow_func(&a_crate->init.group_array[i]);
+		}
+	} else {
+		LOGF(info)(LOGL, "Slow-init in %"PRIz" threads.", thread_num);
+		for (i = 0; i < a_crate->init.group_num; ++i) {
+			struct CrateInitGroup *group;
+
+			group = &a_crate->init.group_array[i];
+			if (0 != group->module_ref_vec.size &&
+			    !thread_start(&group->thread, init_slow_func,
+			    group)) {
+				log_die(LOGL, "Could not start init thread.");
+			}
+		}
+		for (i = 0; i < a_crate->init.group_num; ++i) {
+			if (0 != a_crate->init.group_array[i].module_ref_vec.
+			    size) {
+				thread_clean(&a_crate->init.group_array[i].
+				    thread);
+			}
+		}
+	}
+	ok = 1;
+	for (i = 0; i < a_crate->init.group_num; ++i) {
+		ok &= a_crate->init.group_array[i].is_ok;
+		VECTOR_FREE(&a_crate->init.group_array[i].module_ref_vec);
+	}
+	THREAD_MUTEX_LOCK(&a_crate->init.mutex);
+	FREE(a_crate->init.group_array);
+	a_crate->init.group_num = 0;
+	thread_mutex_unlock(&a_crate->init.mutex);
+	LOGF(info)(LOGL, "Slow-init took %gs.", 1e-9 * (time_getns() - t0));
+	return ok;
+}
+
+void
+init_slow_func(void *a_data)
+{
+	struct CrateInitGroup *group;
+	struct Module **module_ref;
+
+	group = a_data;
+	VECTOR_FOREACH(module_ref, &group->module_ref_vec) {
+		struct Module *module;
+		struct Map *map;
+		uint64_t t0;
+		int ok;
+
+		module = *module_ref;
+		LOGF(info)(LOGL, "Slow-init module[%u]=%s.", module->id,
+		    keyword_get_string(module->type));
+		if (group->do_log_level) {
+			push_log_level(module);
+		}
+		THREAD_MUTEX_LOCK(&group->crate->init.mutex);
+		group->init_id = module->id;
+		thread_mutex_unlock(&group->crate->init.mutex);
+		t0 = time_getns();
+		ok = module->props->init_slow(group->crate, module);
+		if (group->do_log_level) {
+			pop_log_level(module);
+		}
+		LOGF(info)(LOGL, "Slow-init module[%u]=%s took %gs.",
+		    module->id, keyword_get_string(module->type),
+		    1e-9 * (time_getns() - t0));
+		if (!ok) {
+			group->is_ok = 0;
+			return;
+		}
+		/* Fresh shadow, the module may have been reset. */
+		map = write_cache_get_map(module);
+		if (NULL != map) {
+			map_sicy_shadow_enable(map);
+		}
+		THREAD_MUTEX_LOCK(&group->crate->init.mutex);
+		group->crate->module_init_id = group->init_id;
+		module_init_id_mark(group->crate, module);
+		thread_mutex_unlock(&group->crate->init.mutex);
+	}
+}
+
+/* Which independent hardware access path does this module live on? */
+enum CrateBus
+module_bus_get(struct Module const *a_module)
+{
+	if (KW_GSI_CTDC == a_module->type ||
+	    KW_GSI_FEBEX == a_module->type ||
+	    KW_GSI_KILOM == a_module->type ||
+	    KW_GSI_MPPC_ROB == a_module->type ||
+	    KW_GSI_TAMEX == a_module->type) {
+		return BUS_GSI_PEX;
+	}
+	if (KW_GSI_PEXARIA == a_module->type) {
+		return BUS_GSI_ETHERBONE;
+	}
+	/* VME/MVLC/user maps, incl. a Vetar which is a VME card. */
+	return BUS_MAP;
+}
+
 void
 module_counter_latch(struct Module *a_module)
 {
 	a_module->this_minus_crate = a_module->event_counter.value -
 	    a_module->crate_counter->value;
 	a_module->shadow.data_counter_value = a_module->event_counter.value;
+	a_module->shadow.ring.scan_counter = a_module->event_counter.value;
 	LOGF(verbose)(LOGL, "[%u]=%s this(0x%08x)-crate(0x%08x)=0x%08x.",
 	    a_module->id, keyword_get_string(a_module->type),
 	    a_module->event_counter.value, a_module->crate_counter->value,
@@ -2136,6 +3252,69 @@ module_init_id_mark(struct Crate *a_crate, struct Module const *a_module)
 	LOGF(debug)(LOGL, "module_init_id_mark }");
 }
 
+/*
+ * Rewrites the event time-sorted, modules without hit splitting keep their
+ * data first in readout order and barriers are dropped since every merged
+ * hit is tagged with its module.
+ */
+uint32_t
+merge_event(struct Crate *a_crate, struct EventBuffer const *a_eb_orig,
+    struct EventBuffer *a_event_buffer)
+{
+	struct CrateStep const *step;
+	size_t bytes, source_num;
+
+	/* Sources are found by their offset into the event-buffer. */
+	VECTOR_FOREACH(step, &a_crate->step.readout_vec) {
+		struct Module const *module;
+
+		module = step->module;
+		if (0 == (STEP_BARRIER & step->flags) &&
+		    EB_FINAL_EVENT_BUFFER != module->eb_final_place) {
+			log_error(LOGL, "%s[%u]=%s: Data not in the "
+			    "event-buffer, cannot merge.", a_crate->name,
+			    module->id, keyword_get_string(module->type));
+			return CRATE_READOUT_FAIL_GENERAL;
+		}
+	}
+	bytes = (uint8_t *)a_event_buffer->ptr - (uint8_t *)a_eb_orig->ptr;
+	if (a_crate->merge.buf_bytes < bytes) {
+		FREE(a_crate->merge.buf);
+		a_crate->merge.buf_bytes = bytes;
+		MALLOC(a_crate->merge.buf, a_crate->merge.buf_bytes);
+	}
+	memcpy_(a_crate->merge.buf, a_eb_orig->ptr, bytes);
+	COPY(*a_event_buffer, *a_eb_orig);
+	source_num = 0;
+	VECTOR_FOREACH(step, &a_crate->step.readout_vec) {
+		struct Module *module;
+		uint8_t const *src;
+
+		if (STEP_BARRIER & step->flags) {
+			continue;
+		}
+		module = step->module;
+		src = a_crate->merge.buf + ((uint8_t const *)
+		    module->eb_final.ptr - (uint8_t const *)a_eb_orig->ptr);
+		if (NULL == module->props->hit_next) {
+			memcpy_(a_event_buffer->ptr, src,
+			    module->eb_final.bytes);
+			EVENT_BUFFER_ADVANCE(*a_event_buffer, (uint8_t *)
+			    a_event_buffer->ptr + module->eb_final.bytes);
+		} else {
+			struct CrateMergeSource *source;
+
+			source = &a_crate->merge.source_array[source_num++];
+			source->module = module;
+			source->ceb.ptr = src;
+			source->ceb.bytes = module->eb_final.bytes;
+		}
+	}
+	return crate_merge(a_crate->merge.source_array,
+	    a_crate->merge.heap_array, source_num, a_crate->merge.window,
+	    a_event_buffer);
+}
+
 void
 module_insert(struct Crate *a_crate, struct TagRefVector *a_active_vec, struct
     Module *a_module)
@@ -2156,242 +3335,1444 @@ module_insert(struct Crate *a_crate, struct TagRefVector *a_active_vec, struct
 	LOGF(debug)(LOGL, "module_insert }");
 }
 
-void
-pop_log_level(struct Module const *a_module)
+/*
+ * Parses according to the module verification policy, events which are not
+ * fully parsed still get a header/footer check.
+ */
+uint32_t
+module_verify(struct Crate *a_crate, struct Module *a_module, struct
+    EventConstBuffer const *a_ceb)
 {
-	if (NULL != a_module->log_level) {
-		log_level_pop();
+	uint64_t t_0, dt;
+	uint32_t result;
+
+	switch (a_module->verify.has_shallow ? a_module->verify.level :
+	    KW_FULL) {
+	case KW_BUDGET:
+		a_module->verify.is_shallow = a_module->verify.spent_s >
+		    a_module->verify.budget_s * (a_module->verify.full_num +
+		    a_module->verify.shallow_num);
+		break;
+	case KW_HEADER:
+		a_module->verify.is_shallow = 1;
+		break;
+	case KW_NTH:
+		a_module->verify.is_shallow = 0 !=
+		    (a_module->verify.full_num + a_module->verify.shallow_num)
+		    % a_module->verify.nth;
+		break;
+	default:
+		a_module->verify.is_shallow = 0;
+		break;
 	}
+	t_0 = time_getns();
+	result = a_module->props->parse_data(a_crate, a_module, a_ceb, 0);
+	dt = time_getns() - t_0;
+	time_stat_add(&a_module->dt_stat.parse, dt);
+	if (a_module->verify.is_shallow) {
+		++a_module->verify.shallow_num;
+	} else {
+		++a_module->verify.full_num;
+		a_module->verify.spent_s += 1e-9 * dt;
+	}
+	return result;
 }
 
+/*
+ * The readout mutex plus every shadow group mutex, shadow threads only take
+ * their own so they can run concurrently.
+ */
 void
-push_log_level(struct Module const *a_module)
+mutex_lock_all(struct Crate *a_crate)
 {
-	if (NULL != a_module->log_level) {
-		struct LogLevel const *level;
+	size_t i;
 
-		level = log_level_is_visible(a_module->log_level) ?
-		    log_level_get() : a_module->log_level;
-		log_level_push(level);
+	THREAD_MUTEX_LOCK(&a_crate->mutex);
+	for (i = 0; i < LENGTH(a_crate->shadow.group); ++i) {
+		THREAD_MUTEX_LOCK(&a_crate->shadow.group[i].mutex);
 	}
 }
 
-uint32_t
-read_module(struct Crate *a_crate, struct Module *a_module, struct EventBuffer
-    *a_event_buffer)
+void
+mutex_unlock_all(struct Crate *a_crate)
 {
-	struct EventBuffer eb_orig;
-	struct EventConstBuffer ceb;
-	uint32_t result;
+	size_t i;
 
-	LOGF(spam)(LOGL, "%s[%u]=%s: Crate = 0x%08x->0x%08x/%u",
-	    a_crate->name, a_module->id, keyword_get_string(a_module->type),
-	    a_module->crate_counter_prev, a_module->crate_counter->value,
-	    bits_get_count(a_module->crate_counter->mask));
-	if (!a_crate->is_free_running &&
-	    0 == COUNTER_DIFF_RAW(*a_module->crate_counter,
-	    a_module->crate_counter_prev)) {
-		/*
-		 * This module shouldn't have seen anything.
-		 * We use the crate counter rather than the module counter,
-		 * because some modules don't have a proper event counter, so
-		 * we'll have to rely on the user code correctly increasing
-		 * counters (via scalers or explicitly).
-		 */
-		return 0;
+	for (i = LENGTH(a_crate->shadow.group); 0 != i--;) {
+		thread_mutex_unlock(&a_crate->shadow.group[i].mutex);
 	}
+	thread_mutex_unlock(&a_crate->mutex);
+}
 
-	push_log_level(a_module);
-	COPY(eb_orig, *a_event_buffer);
-	result = a_module->props->readout(a_crate, a_module, a_event_buffer);
-	EVENT_BUFFER_INVARIANT(*a_event_buffer, eb_orig);
-	ceb.ptr = eb_orig.ptr;
-	ceb.bytes = eb_orig.bytes - a_event_buffer->bytes;
-	if (0 != result) {
-		log_error(LOGL, "%s[%u]=%s readout error=0x%08x, dumping "
-		    "data:", a_crate->name, a_module->id,
-		    keyword_get_string(a_module->type), result);
-	} else {
-		result = a_module->props->parse_data(a_crate, a_module, &ceb,
-		    0);
-		if (0 != result) {
-			log_error(LOGL, "%s[%u]=%s parse error=0x%08x,"
-			    " dumping data:", a_crate->name, a_module->id,
-			    keyword_get_string(a_module->type), result);
+/* Checks if all modules before the DT release step have been read. */
+int
+parallel_dt_is_ready(struct Crate const *a_crate)
+{
+	size_t i;
+
+	for (i = 0; i < a_crate->dt_release.step_i; ++i) {
+		struct CrateParallelSlot const *slot;
+
+		slot = &a_crate->parallel.slot_vec.array[i];
+		if (0 == ((STEP_BARRIER | STEP_SHADOW) & slot->flags) &&
+		    !slot->is_done) {
+			return 0;
 		}
 	}
-	pop_log_level(a_module);
-	a_module->result |= result;
-	COPY(a_module->eb_final, ceb);
-	if (0 != result) {
-		log_dump(LOGL, ceb.ptr, ceb.bytes);
-		a_crate->state = STATE_REINIT;
-	}
+	return 1;
+}
 
-	a_module->crate_counter_prev = a_module->crate_counter->value;
+/*
+ * Reads a module into the slice of its slot, only the slot and the module
+ * are touched so this is safe in a bus worker.
+ */
+void
+parallel_fetch(struct Crate *a_crate, struct CrateParallelSlot *a_slot)
+{
+	struct EventBuffer eb;
+	uint64_t t_0;
 
-	return result;
+	a_slot->bytes = 0;
+	a_slot->result = 0;
+	a_slot->is_read = read_module_is_due(a_crate, a_slot->module);
+	if (!a_slot->is_read) {
+		return;
+	}
+	COPY(eb, a_slot->slice);
+	t_0 = time_getns();
+	a_slot->result = a_slot->module->props->readout(a_crate,
+	    a_slot->module, &eb);
+	time_stat_add(&a_slot->module->dt_stat.readout, time_getns() - t_0);
+	EVENT_BUFFER_INVARIANT(eb, a_slot->slice);
+	a_slot->bytes = a_slot->slice.bytes - eb.bytes;
 }
 
 void
-shadow_func(void *a_data)
+parallel_func(void *a_data)
 {
+	struct CrateBusWorker *worker;
 	struct Crate *crate;
-	struct Module *module;
 
 	/*
-	 * NOTE: Be careful with log blocks in here and in all
-	 * module->readout_shadow implementations, other threads may change
-	 * the global log level, so log indentation is NOT guaranteed.
+	 * Workers only fetch data into their slots, parsing and crate state
+	 * belong to the main thread. Modules with a log level are read by the
+	 * main thread too, since the level stack is global.
 	 */
 
-	crate = a_data;
+	worker = a_data;
+	crate = worker->crate;
 
-	/* Prepare modules. */
-	TAILQ_FOREACH(module, &crate->module_list, next) {
-		if (NULL == module->props ||
-		    NULL == module->props->readout_shadow) {
-			continue;
-		}
-		if (!thread_mutex_init(&module->shadow.buf_mutex)) {
-			log_die(LOGL, "Could not initialize module mutex.");
-		}
-		module->shadow.buf_idx = 0;
-		ZERO(module->shadow.buf);
-	}
+	THREAD_MUTEX_LOCK(&crate->parallel.mutex);
+	for (;;) {
+		struct CrateParallelSlot *slot;
 
-	/* Emptying is the sole purpose of my existence. */
-	while (crate->shadow.is_running) {
-		if (STATE_REINIT == crate->state) {
-			goto next;
+		while (crate->parallel.is_running && !worker->do_read) {
+			thread_condvar_wait(&crate->parallel.work,
+			    &crate->parallel.mutex);
 		}
-
-		THREAD_MUTEX_LOCK(&crate->mutex);
-		if (crate->shadow.do_buf_rebuild) {
-			size_t ofs, step;
-
-			ofs = 0;
-			step = (crate->shadow.buf_bytes / (2 *
-			    crate->shadow.module_readable_num) /
-			    sizeof(uint32_t)) * sizeof(uint32_t);
-			/* Prepare modules. */
-			TAILQ_FOREACH(module, &crate->module_list, next) {
-				size_t i;
-
-				if (NULL == module->props ||
-				    NULL == module->props->readout_shadow) {
-					continue;
-				}
-				for (i = 0; i < LENGTH(module->shadow.buf);
-				    ++i) {
-					struct ModuleShadowBuffer *buf;
-
-					buf = &module->shadow.buf[i];
-					buf->store.ptr =
-					    (uint8_t *)map_blt_dst_get(
-						crate->shadow.dst) + ofs;
-					buf->store.bytes = step;
-					COPY(buf->eb, buf->store);
-					ofs += step;
-				}
-			}
-			crate->shadow.do_buf_rebuild = 0;
+		if (!crate->parallel.is_running) {
+			break;
 		}
-		TAILQ_FOREACH(module, &crate->module_list, next) {
-			struct ModuleShadowBuffer *buf;
-			uint32_t ret;
+		thread_mutex_unlock(&crate->parallel.mutex);
 
-			if (0 == module->event_max ||
-			    NULL == module->props->readout_shadow ||
-			    0 == module->shadow.buf[0].eb.bytes) {
+		VECTOR_FOREACH(slot, &crate->parallel.slot_vec) {
+			if (worker->bus != slot->bus) {
 				continue;
 			}
-			THREAD_MUTEX_LOCK(&module->shadow.buf_mutex);
-			buf = &module->shadow.buf[module->shadow.buf_idx];
-			ret = module->props->readout_shadow(crate, module,
-			    &buf->eb);
+			parallel_fetch(crate, slot);
+			THREAD_MUTEX_LOCK(&crate->parallel.mutex);
+			slot->is_done = 1;
+			thread_condvar_signal(&crate->parallel.done);
+			thread_mutex_unlock(&crate->parallel.mutex);
+		}
+
+		THREAD_MUTEX_LOCK(&crate->parallel.mutex);
+		worker->do_read = 0;
+		--crate->parallel.pending;
+		thread_condvar_signal(&crate->parallel.done);
+	}
+	thread_mutex_unlock(&crate->parallel.mutex);
+}
+
+/*
+ * Carves the event buffer into slot slices in readout order. Barriers and
+ * shadow data get what they need, read slots share the rest, half evenly and
+ * half by the largest amount each has read so far.
+ */
+void
+parallel_layout(struct Crate *a_crate, struct EventBuffer const
+    *a_event_buffer)
+{
+	struct CrateParallelSlot *slot;
+	uint8_t *p8;
+	size_t base, left, read_num, reserve, rest, weight;
+
+	reserve = 0;
+	read_num = 0;
+	weight = 0;
+	VECTOR_FOREACH(slot, &a_crate->parallel.slot_vec) {
+		if (STEP_BARRIER & slot->flags) {
+			slot->slice.bytes = sizeof(uint32_t);
+		} else if (STEP_SHADOW & slot->flags) {
+			slot->slice.bytes = (shadow_ring_bytes(
+			    &slot->module->shadow.ring) + sizeof(uint32_t) -
+			    1) & ~(sizeof(uint32_t) - 1);
+		} else {
+			weight += slot->bytes_max;
+			++read_num;
+			continue;
+		}
+		reserve += slot->slice.bytes;
+	}
+	rest = reserve < a_event_buffer->bytes ? a_event_buffer->bytes -
+	    reserve : 0;
+	base = 0 == weight ? rest / read_num : rest / 2 / read_num;
+	rest -= base * read_num;
+	p8 = a_event_buffer->ptr;
+	left = a_event_buffer->bytes;
+	VECTOR_FOREACH(slot, &a_crate->parallel.slot_vec) {
+		if (0 == ((STEP_BARRIER | STEP_SHADOW) & slot->flags)) {
+			size_t bytes;
+
+			bytes = base;
+			if (0 != weight) {
+				bytes += (size_t)((double)rest *
+				    slot->bytes_max / weight);
+			}
+			slot->slice.bytes = bytes & ~(sizeof(uint32_t) - 1);
+		}
+		slot->slice.bytes = MIN(slot->slice.bytes, left);
+		slot->slice.ptr = p8;
+		p8 += slot->slice.bytes;
+		left -= slot->slice.bytes;
+	}
+}
+
+/*
+ * Bus workers read their modules into slices of the event buffer, then the
+ * event is compacted and parsed in readout order. The deadtime is released
+ * as soon as every module before the release step is read, so waiting for a
+ * slow bus is overlapped with the next conversion.
+ */
+uint32_t
+parallel_readout(struct Crate *a_crate, struct EventBuffer *a_event_buffer)
+{
+	struct CrateParallelSlot *slot;
+	size_t i;
+	uint32_t result;
+	int do_dt, is_sg;
+
+	LOGF(spam)(LOGL, "parallel_readout(%s) {", a_crate->name);
+	result = 0;
+
+	parallel_layout(a_crate, a_event_buffer);
+	do_dt = a_crate->dt_release.step_i < a_crate->step.readout_vec.size;
+
+	/* Slices are moved during assembly, so nothing may be referenced. */
+	is_sg = a_crate->sg.is_on;
+	a_crate->sg.is_on = 0;
+	mutex_lock_all(a_crate);
+	THREAD_MUTEX_LOCK(&a_crate->parallel.mutex);
+	VECTOR_FOREACH(slot, &a_crate->parallel.slot_vec) {
+		slot->is_done = 0;
+	}
+	for (i = 0; i < LENGTH(a_crate->parallel.worker); ++i) {
+		struct CrateBusWorker *worker;
+
+		worker = &a_crate->parallel.worker[i];
+		if (0 != worker->slot_num) {
+			worker->do_read = 1;
+			++a_crate->parallel.pending;
+		}
+	}
+	thread_condvar_broadcast(&a_crate->parallel.work);
+	for (;;) {
+		if (do_dt && parallel_dt_is_ready(a_crate)) {
+			thread_mutex_unlock(&a_crate->parallel.mutex);
+			dt_release(a_crate);
+			THREAD_MUTEX_LOCK(&a_crate->parallel.mutex);
+			do_dt = 0;
+		}
+		if (0 == a_crate->parallel.pending) {
+			break;
+		}
+		thread_condvar_wait(&a_crate->parallel.done,
+		    &a_crate->parallel.mutex);
+	}
+	thread_mutex_unlock(&a_crate->parallel.mutex);
+	VECTOR_FOREACH(slot, &a_crate->parallel.slot_vec) {
+		if (BUS_NUM != slot->bus ||
+		    0 != ((STEP_BARRIER | STEP_SHADOW) & slot->flags)) {
+			continue;
+		}
+		push_log_level(slot->module);
+		parallel_fetch(a_crate, slot);
+		pop_log_level(slot->module);
+		slot->is_done = 1;
+		if (do_dt && parallel_dt_is_ready(a_crate)) {
+			dt_release(a_crate);
+			do_dt = 0;
+		}
+	}
+	mutex_unlock_all(a_crate);
+	a_crate->sg.is_on = is_sg;
+
+	/* Slices start after all earlier data, so moves never clobber. */
+	VECTOR_FOREACH(slot, &a_crate->parallel.slot_vec) {
+		struct EventConstBuffer ceb;
+		uint32_t ret;
+
+		if (STEP_BARRIER & slot->flags) {
+			uint32_t *p32;
+
+			p32 = a_event_buffer->ptr;
+			*p32++ = BARRIER_WORD;
+			EVENT_BUFFER_ADVANCE(*a_event_buffer, p32);
+			continue;
+		}
+		if (STEP_SHADOW & slot->flags) {
+			result |= shadow_merge_module(a_crate, slot->module,
+			    a_event_buffer);
+			continue;
+		}
+		if (!slot->is_read) {
+			continue;
+		}
+		slot->bytes_max = MAX(slot->bytes_max,
+		    CRATE_READOUT_FAIL_DATA_TOO_MUCH & slot->result ?
+		    2 * slot->slice.bytes : slot->bytes);
+		memmove(a_event_buffer->ptr, slot->slice.ptr, slot->bytes);
+		ceb.ptr = a_event_buffer->ptr;
+		ceb.bytes = slot->bytes;
+		EVENT_BUFFER_ADVANCE(*a_event_buffer,
+		    (uint8_t *)a_event_buffer->ptr + slot->bytes);
+		push_log_level(slot->module);
+		ret = read_module_parse(a_crate, slot->module, &ceb, 0, 0,
+		    slot->result);
+		pop_log_level(slot->module);
+		read_module_done(a_crate, slot->module, &ceb,
+		    EB_FINAL_EVENT_BUFFER, ret);
+		result |= ret;
+	}
+
+	LOGF(spam)(LOGL, "parallel_readout(%s,0x%08x) }", a_crate->name,
+	    result);
+	return result;
+}
+
+void
+parallel_start(struct Crate *a_crate)
+{
+	char const *c_bus_name[BUS_NUM] = {"map", "GSI PEX", "GSI etherbone"};
+	struct CrateStep const *step;
+	size_t i;
+
+	for (i = 0; i < LENGTH(a_crate->parallel.worker); ++i) {
+		struct CrateBusWorker *worker;
+
+		worker = &a_crate->parallel.worker[i];
+		worker->crate = a_crate;
+		worker->bus = i;
+		worker->slot_num = 0;
+		worker->do_read = 0;
+	}
+	/* Slots on BUS_NUM are handled by the main thread. */
+	VECTOR_FREE(&a_crate->parallel.slot_vec);
+	VECTOR_FOREACH(step, &a_crate->step.readout_vec) {
+		struct CrateParallelSlot slot;
+
+		ZERO(slot);
+		slot.module = step->module;
+		slot.flags = step->flags;
+		slot.bus = BUS_NUM;
+		if (0 == ((STEP_BARRIER | STEP_SHADOW) & step->flags) &&
+		    NULL == step->module->log_level) {
+			slot.bus = module_bus_get(step->module);
+			++a_crate->parallel.worker[slot.bus].slot_num;
+		}
+		VECTOR_APPEND(&a_crate->parallel.slot_vec, slot);
+	}
+	a_crate->parallel.pending = 0;
+	a_crate->parallel.is_running = 0;
+	for (i = 0; i < LENGTH(a_crate->parallel.worker); ++i) {
+		a_crate->parallel.is_running |=
+		    0 != a_crate->parallel.worker[i].slot_num;
+	}
+	if (!a_crate->parallel.is_running) {
+		LOGF(info)(LOGL, "No modules for parallel readout.");
+		return;
+	}
+	for (i = 0; i < LENGTH(a_crate->parallel.worker); ++i) {
+		struct CrateBusWorker *worker;
+
+		worker = &a_crate->parallel.worker[i];
+		if (0 == worker->slot_num) {
+			continue;
+		}
+		LOGF(info)(LOGL, "Starting %s readout thread (%"PRIz" "
+		    "modules).", c_bus_name[worker->bus], worker->slot_num);
+		if (!thread_start(&worker->thread, parallel_func, worker)) {
+			log_die(LOGL, "Could not start parallel readout "
+			    "thread.");
+		}
+	}
+}
+
+void
+parallel_stop(struct Crate *a_crate)
+{
+	size_t i;
+
+	if (!a_crate->parallel.is_running) {
+		return;
+	}
+	LOGF(info)(LOGL, "Stopping parallel readout threads.");
+	THREAD_MUTEX_LOCK(&a_crate->parallel.mutex);
+	a_crate->parallel.is_running = 0;
+	thread_condvar_broadcast(&a_crate->parallel.work);
+	thread_mutex_unlock(&a_crate->parallel.mutex);
+	for (i = 0; i < LENGTH(a_crate->parallel.worker); ++i) {
+		if (0 != a_crate->parallel.worker[i].slot_num) {
+			thread_clean(&a_crate->parallel.worker[i].thread);
+		}
+	}
+}
+
+/* Parses the module left over by the previous read_module, if any. */
+uint32_t
+pipeline_flush(struct Crate *a_crate)
+{
+	struct Module *module;
+	uint32_t result;
+
+	module = a_crate->pipeline.module;
+	if (NULL == module) {
+		return 0;
+	}
+	a_crate->pipeline.module = NULL;
+	push_log_level(module);
+	result = module_verify(a_crate, module, &a_crate->pipeline.ceb);
+	pop_log_level(module);
+	if (0 != result) {
+		log_error(LOGL, "%s[%u]=%s parse error=0x%08x, dumping data:",
+		    a_crate->name, module->id,
+		    keyword_get_string(module->type), result);
+		log_dump(LOGL, a_crate->pipeline.ceb.ptr,
+		    a_crate->pipeline.ceb.bytes);
+		module->result |= result;
+		a_crate->state = STATE_REINIT;
+	}
+	return result;
+}
+
+/*
+ * Sleeps at most until the module is expected to have the event according to
+ * its history, and then falls back to the backoff.
+ */
+void
+poll_wait_adaptive(struct Crate *a_crate, struct Module *a_module, unsigned
+    a_poll_i, double a_elapsed)
+{
+	double remaining;
+
+	remaining = a_module->poll.latency - a_elapsed;
+	if (1 == a_poll_i && remaining > a_crate->poll.spin_s) {
+		time_sleep(MIN(remaining, a_crate->poll.backoff_max_s));
+		return;
+	}
+	poll_wait_backoff(a_crate, a_module, a_poll_i, a_elapsed);
+}
+
+/*
+ * Spins for a short while, then sleeps exponentially longer between polls to
+ * spare the bus from pointless single-cycle reads.
+ */
+void
+poll_wait_backoff(struct Crate *a_crate, struct Module *a_module, unsigned
+    a_poll_i, double a_elapsed)
+{
+	(void)a_module;
+	(void)a_poll_i;
+	if (a_elapsed < a_crate->poll.spin_s) {
+		return;
+	}
+	time_sleep(a_crate->poll.backoff_s);
+	a_crate->poll.backoff_s = MIN(2 * a_crate->poll.backoff_s,
+	    a_crate->poll.backoff_max_s);
+}
+
+/* The original strategy, busy-loop but let others in. */
+void
+poll_wait_yield(struct Crate *a_crate, struct Module *a_module, unsigned
+    a_poll_i, double a_elapsed)
+{
+	(void)a_crate;
+	(void)a_module;
+	(void)a_poll_i;
+	(void)a_elapsed;
+	sched_yield();
+}
+
+void
+pop_log_level(struct Module *a_module)
+{
+	if (a_module->log_level_is_pushed) {
+		a_module->log_level_is_pushed = 0;
+		log_level_pop();
+	}
+}
+
+/*
+ * The decision is kept in the module, a crate thread starting in between
+ * must not leave a pushed level on the stack.
+ */
+void
+push_log_level(struct Module *a_module)
+{
+	if (NULL != a_module->log_level && 0 == ATOMIC_LOAD(&g_thread_num)) {
+		struct LogLevel const *level;
+
+		level = log_level_is_visible(a_module->log_level) ?
+		    log_level_get() : a_module->log_level;
+		log_level_push(level);
+		a_module->log_level_is_pushed = 1;
+	}
+}
+
+uint32_t
+read_module(struct Crate *a_crate, struct Module *a_module, struct EventBuffer
+    *a_event_buffer, int a_do_log_level)
+{
+	struct EventBuffer eb_orig;
+	struct EventConstBuffer ceb;
+	enum ModuleEbFinalPlace place;
+	uint64_t t_0, t_flush;
+	size_t seg_first, seg_num;
+	uint32_t result, result_prev;
+
+	LOGF(spam)(LOGL, "%s[%u]=%s: Crate = 0x%08x->0x%08x/%u",
+	    a_crate->name, a_module->id, keyword_get_string(a_module->type),
+	    a_module->crate_counter_prev, a_module->crate_counter->value,
+	    bits_get_count(a_module->crate_counter->mask));
+	if (!read_module_is_due(a_crate, a_module)) {
+		return 0;
+	}
+
+	if (a_do_log_level) {
+		push_log_level(a_module);
+	}
+	COPY(eb_orig, *a_event_buffer);
+	seg_first = 0;
+	if (a_crate->sg.is_on) {
+		sg_flush(a_crate, a_event_buffer->ptr);
+		seg_first = a_crate->sg.num;
+	}
+	t_0 = time_getns();
+	result = 0;
+	if (a_crate->pipeline.do_it &&
+	    NULL != a_module->props->readout_submit) {
+		result = a_module->props->readout_submit(a_crate, a_module,
+		    a_event_buffer);
+	}
+	/* The previous module is parsed while this one transfers. */
+	t_flush = time_getns();
+	result_prev = pipeline_flush(a_crate);
+	t_0 += time_getns() - t_flush;
+	if (0 == result) {
+		result = a_module->props->readout(a_crate, a_module,
+		    a_event_buffer);
+	}
+	time_stat_add(&a_module->dt_stat.readout, time_getns() - t_0);
+	EVENT_BUFFER_INVARIANT(*a_event_buffer, eb_orig);
+	ceb.ptr = eb_orig.ptr;
+	ceb.bytes = eb_orig.bytes - a_event_buffer->bytes;
+	seg_num = 0;
+	if (a_crate->sg.is_on) {
+		sg_flush(a_crate, a_event_buffer->ptr);
+		seg_num = a_crate->sg.num - seg_first;
+		if (1 == seg_num) {
+			COPY(ceb, a_crate->sg.array[seg_first]);
+		}
+	}
+	place = EB_FINAL_EVENT_BUFFER;
+	if (1 < seg_num) {
+		place = EB_FINAL_SEGMENTS;
+	} else if (1 == seg_num && ((uintptr_t)ceb.ptr < (uintptr_t)
+	    eb_orig.ptr || (uintptr_t)ceb.ptr >= (uintptr_t)eb_orig.ptr +
+	    eb_orig.bytes)) {
+		place = EB_FINAL_OUTSIDE;
+	}
+	result = read_module_parse(a_crate, a_module, &ceb, seg_first,
+	    seg_num, result);
+	if (a_do_log_level) {
+		pop_log_level(a_module);
+	}
+	read_module_done(a_crate, a_module, &ceb, place, result);
+
+	return result | result_prev;
+}
+
+/*
+ * Bookkeeping after a module was read and parsed, main thread only. Data in
+ * several segments was gathered in scratch memory for parsing, which the
+ * next module reuses, so then eb_final only keeps the size.
+ */
+void
+read_module_done(struct Crate *a_crate, struct Module *a_module, struct
+    EventConstBuffer const *a_ceb, enum ModuleEbFinalPlace a_place,
+    uint32_t a_result)
+{
+	a_module->result |= a_result;
+	COPY(a_module->eb_final, *a_ceb);
+	a_module->eb_final_place = a_place;
+	if (EB_FINAL_SEGMENTS == a_place) {
+		a_module->eb_final.ptr = NULL;
+	}
+	if (0 != a_result) {
+		log_dump(LOGL, a_ceb->ptr, a_ceb->bytes);
+		a_crate->state = STATE_REINIT;
+	} else if (a_crate->event_max_auto.do_it) {
+		uint32_t event_num;
+
+		/* Worst bytes/event, the limit must hold for big events. */
+		event_num = COUNTER_DIFF_RAW(*a_module->crate_counter,
+		    a_module->crate_counter_prev);
+		if (0 != event_num) {
+			a_module->event_bytes_max = MAX(
+			    a_module->event_bytes_max, (a_ceb->bytes +
+			    event_num - 1) / event_num);
+		}
+	}
+
+	a_module->crate_counter_prev = a_module->crate_counter->value;
+}
+
+int
+read_module_is_due(struct Crate const *a_crate, struct Module const
+    *a_module)
+{
+	/*
+	 * Otherwise this module shouldn't have seen anything.
+	 * We use the crate counter rather than the module counter, because
+	 * some modules don't have a proper event counter, so we'll have to
+	 * rely on the user code correctly increasing counters (via scalers or
+	 * explicitly).
+	 */
+	return a_crate->is_free_running ||
+	    0 != COUNTER_DIFF_RAW(*a_module->crate_counter,
+	    a_module->crate_counter_prev);
+}
+
+/*
+ * Hands the data of a module to the parser, the verify thread or the
+ * pipeline, 'a_result' is the readout result.
+ */
+uint32_t
+read_module_parse(struct Crate *a_crate, struct Module *a_module, struct
+    EventConstBuffer *a_ceb, size_t a_seg_first, size_t a_seg_num, uint32_t
+    a_result)
+{
+	uint32_t result;
+
+	if (0 != a_result) {
+		log_error(LOGL, "%s[%u]=%s readout error=0x%08x, dumping "
+		    "data:", a_crate->name, a_module->id,
+		    keyword_get_string(a_module->type), a_result);
+		return a_result;
+	}
+	if (1 < a_seg_num) {
+		/* Placed pieces are gathered and parsed right away. */
+		return sg_parse(a_crate, a_module, a_seg_first, a_ceb);
+	}
+	if (a_crate->verify.is_running) {
+		verify_push(a_crate, a_module, a_ceb);
+		return 0;
+	}
+	if (a_crate->pipeline.do_it) {
+		a_crate->pipeline.module = a_module;
+		COPY(a_crate->pipeline.ceb, *a_ceb);
+		return 0;
+	}
+	result = module_verify(a_crate, a_module, a_ceb);
+	if (0 != result) {
+		log_error(LOGL, "%s[%u]=%s parse error=0x%08x, dumping data:",
+		    a_crate->name, a_module->id,
+		    keyword_get_string(a_module->type), result);
+	}
+	return result;
+}
+
+/*
+ * Crate thread, one full readout per trigger into the own buffer, failed
+ * events recover in finalize like in the single-crate flow.
+ */
+void
+readout_func(void *a_data)
+{
+	struct Crate *crate;
+	double idle_s;
+
+	crate = a_data;
+	idle_s = 1e-6;
+	while (ATOMIC_LOAD(&crate->thread.is_running)) {
+		struct EventBuffer eb;
+		struct EventConstBuffer ceb;
+		uint32_t result;
+
+		if (!crate->thread.trigger(crate, crate->thread.data)) {
+			/* Sleep between idle polls like the poll backoff. */
+			time_sleep(idle_s);
+			idle_s = MIN(2 * idle_s, THREAD_IDLE_MAX_S);
+			continue;
+		}
+		idle_s = 1e-6;
+		eb.ptr = crate->thread.buf;
+		eb.bytes = crate->thread.bytes;
+		result = crate_readout_dt(crate);
+		if (0 == result) {
+			result = crate_readout(crate, &eb);
+		}
+		crate_readout_finalize(crate);
+		ceb.ptr = crate->thread.buf;
+		ceb.bytes = crate->thread.bytes - eb.bytes;
+		crate->thread.event(crate, &ceb, result, crate->thread.data);
+	}
+}
+
+/*
+ * Recovers from a failed readout, by clearing the failed modules if possible
+ * or else with a full re-init. 'a_is_final' is 0 when another recovery will
+ * follow in the next dt, e.g. after an early dt release.
+ */
+void
+recover(struct Crate *a_crate, int a_is_final)
+{
+	struct Module *module;
+
+	if (a_crate->sg.is_held) {
+		/*
+		 * Clearing resets the shadow rings and re-init rebuilds them,
+		 * wait until the user lets go of the segments.
+		 */
+		a_crate->recover.is_deferred = 1;
+		a_crate->recover.is_final = a_is_final;
+		return;
+	}
+	if (recover_clear(a_crate, a_is_final)) {
+		return;
+	}
+	log_error(LOGL, "%s: had problems, re-initializing.", a_crate->name);
+	THREAD_MUTEX_LOCK(&g_thread_mutex);
+	crate_deinit(a_crate);
+	time_sleep(a_crate->reinit_sleep_s);
+	crate_init(a_crate);
+	thread_mutex_unlock(&g_thread_mutex);
+	TAILQ_FOREACH(module, &a_crate->module_list, next) {
+		module->do_clear = 0;
+	}
+	a_crate->recover.was_cleared = 0;
+}
+
+/*
+ * Clears only the failed modules and relatches their counters. Fails if some
+ * failed module cannot clear, or if the previous event was also recovered
+ * this way, so the caller escalates to a full re-init.
+ */
+int
+recover_clear(struct Crate *a_crate, int a_is_final)
+{
+	struct Module *module;
+	uint64_t t0;
+	unsigned num;
+	int ok;
+
+	if (!a_crate->recover.do_clear || a_crate->recover.was_cleared) {
+		return 0;
+	}
+	num = 0;
+	TAILQ_FOREACH(module, &a_crate->module_list, next) {
+		if (NULL == module->props) {
+			continue;
+		}
+		if (0 != module->result) {
+			module->do_clear = 1;
+		}
+		if (module->do_clear) {
+			if (NULL == module->props->clear) {
+				return 0;
+			}
+			++num;
+		}
+	}
+	if (0 == num) {
+		return 0;
+	}
+
+	log_error(LOGL, "%s: had problems, clearing %u module(s).",
+	    a_crate->name, num);
+	ok = 0;
+	t0 = time_getns();
+	mutex_lock_all(a_crate);
+	TAILQ_FOREACH(module, &a_crate->module_list, next) {
+		struct ModuleShadowRing *ring;
+
+		if (NULL == module->props || !module->do_clear) {
+			continue;
+		}
+		LOGF(info)(LOGL, "%s[%u]=%s clear.", a_crate->name,
+		    module->id, keyword_get_string(module->type));
+		push_log_level(module);
+		if (!module->props->clear(a_crate, module)) {
+			pop_log_level(module);
+			goto recover_clear_done;
+		}
+		if (!a_crate->is_free_running &&
+		    0 != module->props->check_empty(module)) {
+			log_error(LOGL, "%s[%u]=%s: not empty after clear.",
+			    a_crate->name, module->id,
+			    keyword_get_string(module->type));
+			pop_log_level(module);
+			goto recover_clear_done;
+		}
+		pop_log_level(module);
+		/* Stale shadow data belongs to the old counter. */
+		ring = &module->shadow.ring;
+		ring->head = 0;
+		ring->tail = 0;
+		ring->scan = 0;
+		ring->cut = 0;
+		module_counter_latch(module);
+		module->crate_counter_prev = module->crate_counter->value;
+		module->result = 0;
+		if (a_is_final) {
+			module->do_clear = 0;
+		}
+	}
+	ok = 1;
+	a_crate->recover.was_cleared = a_is_final;
+	a_crate->state = STATE_PREPARED;
+	LOGF(verbose)(LOGL, "%s: clear took %gs.", a_crate->name,
+	    1e-9 * (time_getns() - t0));
+recover_clear_done:
+	mutex_unlock_all(a_crate);
+	return ok;
+}
+
+/*
+ * Partitions the shadow buffer into module rings. Half is split evenly, the
+ * other half by the largest event seen per module, so heavy modules get
+ * more room once they have shown up.
+ */
+void
+shadow_buf_rebuild(struct Crate *a_crate)
+{
+	struct Module **module_ref;
+	size_t floor_bytes, i, ofs, rest, total, weight_sum;
+	unsigned num;
+
+	num = 0;
+	weight_sum = 0;
+	for (i = 0; i < LENGTH(a_crate->shadow.group); ++i) {
+		VECTOR_FOREACH(module_ref,
+		    &a_crate->shadow.group[i].module_ref_vec) {
+			++num;
+			weight_sum += (*module_ref)->shadow.max_bytes;
+		}
+	}
+	a_crate->shadow.do_buf_rebuild = 0;
+	if (0 == num) {
+		return;
+	}
+	total = a_crate->shadow.buf_bytes / SHADOW_ALIGN * SHADOW_ALIGN;
+	floor_bytes = total / (2 * num) / SHADOW_ALIGN * SHADOW_ALIGN;
+	rest = total - num * floor_bytes;
+	ofs = 0;
+	LOGF(verbose)(LOGL, "Shadow rebuild(modules=%u,weight=0x%"PRIzx") {",
+	    num, weight_sum);
+	/* Rings of one group are kept together in one slice. */
+	for (i = 0; i < LENGTH(a_crate->shadow.group); ++i) {
+		VECTOR_FOREACH(module_ref,
+		    &a_crate->shadow.group[i].module_ref_vec) {
+			struct Module *module;
+			struct ModuleShadowRing *ring;
+			size_t bytes;
+
+			module = *module_ref;
+			if (0 == weight_sum) {
+				bytes = rest / num;
+			} else {
+				bytes = (size_t)((double)rest *
+				    module->shadow.max_bytes / weight_sum);
+			}
+			bytes = (floor_bytes + bytes) / SHADOW_ALIGN *
+			    SHADOW_ALIGN;
+			LOGF(verbose)(LOGL, "%s[%u]=%s: group=%"PRIz" "
+			    "ring=0x%"PRIzx" B event-max=0x%"PRIzx" B.",
+			    a_crate->name, module->id,
+			    keyword_get_string(module->type), i, bytes,
+			    module->shadow.max_bytes);
+			ring = &module->shadow.ring;
+			ring->store.ptr = (uint8_t *)map_blt_dst_get(
+			    a_crate->shadow.dst) + ofs;
+			ring->store.bytes = bytes;
+			ring->head = 0;
+			ring->tail = 0;
+			ring->scan = 0;
+			ring->cut = 0;
+			ring->rec_max = 0;
+			ring->is_full = 0;
+			ring->full_streak = 0;
+			ofs += bytes;
+		}
+	}
+	LOGF(verbose)(LOGL, "Shadow rebuild }");
+}
+
+void
+shadow_func(void *a_data)
+{
+	struct CrateShadowGroup *group;
+	struct Crate *crate;
+	double idle_s;
+
+	/*
+	 * NOTE: Be careful with log blocks in here and in all
+	 * module->readout_shadow implementations, other threads may change
+	 * the global log level, so log indentation is NOT guaranteed.
+	 */
+
+	group = a_data;
+	crate = group->crate;
+	idle_s = 0.0;
+
+	/* Emptying is the sole purpose of my existence. */
+	while (group->is_running) {
+		struct Module **module_ref;
+		int has_data;
+
+		has_data = 0;
+		if (STATE_REINIT == crate->state) {
+			goto next;
+		}
+		VECTOR_FOREACH(module_ref, &group->module_ref_vec) {
+			struct Module *module;
+			size_t head;
+			uint32_t ret;
+
+			module = *module_ref;
+			if (0 == module->event_max ||
+			    0 == module->shadow.ring.store.bytes) {
+				continue;
+			}
+			/*
+			 * The group mutex only serializes hardware access,
+			 * the ring itself needs no locking.
+			 */
+			THREAD_MUTEX_LOCK(&group->mutex);
+			head = module->shadow.ring.head;
+			ret = shadow_ring_write(crate, module);
+			has_data |= head != module->shadow.ring.head;
 			module->result |= ret;
-			thread_mutex_unlock(&module->shadow.buf_mutex);
 			if (0 != ret) {
 				/*
-				 * TODO: Since we reinit we must clear
-				 * the shadow buffer due to reset
-				 * counters which will kill parse_data
-				 * (if they're properly written...),
-				 * but we lose data :/
-				 * Hmm...
+				 * TODO: Reinit rebuilds the rings since
+				 * reset counters kill parse_data (if they're
+				 * properly written...), but we lose data :/
 				 */
-				COPY(buf->eb, buf->store);
 				crate->state = STATE_REINIT;
 			}
-			EVENT_BUFFER_INVARIANT(buf->store, buf->eb);
+			thread_mutex_unlock(&group->mutex);
+		}
+next:
+		/* Each group backs off on its own when idle. */
+		if (has_data || 0.0 == crate->shadow.poll_max_s) {
+			idle_s = 0.0;
+			sched_yield();
+		} else {
+			idle_s = MIN(MAX(2 * idle_s, 1e-6),
+			    crate->shadow.poll_max_s);
+			time_sleep(idle_s);
+		}
+	}
+}
+
+uint32_t
+shadow_merge_module(struct Crate *a_crate, struct Module *a_module, struct
+    EventBuffer *a_event_buffer)
+{
+	struct ModuleShadowRing *ring;
+	uint64_t t_0;
+	uint8_t *dst;
+	size_t pos;
+	uint32_t result, ret;
+	unsigned bytes;
+
+	LOGF(spam)(LOGL, "shadow_merge_module(%s[%u]=%s) {", a_crate->name,
+	    a_module->id, keyword_get_string(a_module->type));
+	result = 0;
+	t_0 = time_getns();
+
+	if (a_crate->sg.is_on) {
+		result = shadow_sg_module(a_crate, a_module,
+		    a_event_buffer->ptr);
+		goto shadow_merge_module_done;
+	}
+
+	ring = &a_module->shadow.ring;
+	dst = a_event_buffer->ptr;
+	LOGF(spam)(LOGL, "Shadow-ring: ptr=%p tail=0x%"PRIzx" "
+	    "cut=0x%"PRIzx, ring->store.ptr, ring->tail, ring->cut);
+
+	/* Copy records into dst event buffer, they never wrap. */
+	for (pos = ring->tail; ring->cut != pos;) {
+		struct ShadowRecord const *rec;
+		size_t ofs;
+
+		ofs = shadow_ring_ofs(ring, pos);
+		rec = (void const *)((uint8_t const *)ring->store.ptr + ofs);
+		if (SHADOW_RECORD_PAD == rec->bytes) {
+			pos = shadow_ring_next(ring, pos, ring->store.bytes -
+			    ofs);
+			continue;
+		}
+		if (a_event_buffer->bytes < rec->bytes) {
+			log_error(LOGL, "%s[%u]=%s: Too much data! "
+			    "Dst=0x%08"PRIzx" B < src=0x%08x B.",
+			    a_crate->name, a_module->id,
+			    keyword_get_string(a_module->type),
+			    a_event_buffer->bytes, rec->bytes);
+			result |= CRATE_READOUT_FAIL_DATA_TOO_MUCH;
+			ATOMIC_STORE(&ring->tail, ring->cut);
+			goto shadow_merge_module_done;
+		}
+		memcpy_(a_event_buffer->ptr, rec + 1, rec->bytes);
+		EVENT_BUFFER_ADVANCE(*a_event_buffer, (uint8_t *)
+		    a_event_buffer->ptr + rec->bytes);
+		pos = shadow_ring_next(ring, pos, sizeof *rec +
+		    (rec->bytes + SHADOW_ALIGN - 1) / SHADOW_ALIGN *
+		    SHADOW_ALIGN);
+	}
+	/* Hand the space back to the shadow thread. */
+	ATOMIC_STORE(&ring->tail, ring->cut);
+	bytes = (uint8_t *)a_event_buffer->ptr - dst;
+	a_module->eb_final.ptr = dst;
+	a_module->eb_final.bytes = bytes;
+	a_module->eb_final_place = EB_FINAL_EVENT_BUFFER;
+	time_stat_add(&a_module->dt_stat.readout, time_getns() - t_0);
+
+	/* Check the data. */
+	ret = module_verify(a_crate, a_module, &a_module->eb_final);
+	result |= ret;
+	if (0 != ret) {
+		log_error(LOGL, "%s:%u=%s parse error=0x%08x, dumping data:",
+		    a_crate->name, a_module->id,
+		    keyword_get_string(a_module->type), ret);
+		log_dump(LOGL, a_module->eb_final.ptr,
+		    a_module->eb_final.bytes);
+	}
+
+	a_crate->shadow.max_bytes = MAX(a_crate->shadow.max_bytes, bytes);
+	a_module->shadow.max_bytes = MAX(a_module->shadow.max_bytes, bytes);
+
+shadow_merge_module_done:
+	LOGF(spam)(LOGL, "shadow_merge_module(%s[%u]=%s:%08x) }",
+	    a_crate->name, a_module->id, keyword_get_string(a_module->type),
+	    result);
+	return result;
+}
+
+/* Only safe with the crate mutex, which keeps the producer out. */
+int
+shadow_is_empty(struct Crate *a_crate)
+{
+	struct Module *module;
+
+	TAILQ_FOREACH(module, &a_crate->module_list, next) {
+		struct ModuleShadowRing *ring;
+
+		ring = &module->shadow.ring;
+		if (ATOMIC_LOAD(&ring->head) != ring->tail) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/* Consumer side, follows published records up to the producer head. */
+void
+shadow_ring_scan(struct Module *a_module)
+{
+	struct ModuleShadowRing *ring;
+	size_t head;
+
+	ring = &a_module->shadow.ring;
+	head = ATOMIC_LOAD(&ring->head);
+	a_module->shadow.fill_max = MAX(a_module->shadow.fill_max,
+	    shadow_ring_used(ring, head, ring->tail));
+	while (head != ring->scan) {
+		struct ShadowRecord const *rec;
+		size_t ofs;
+
+		ofs = shadow_ring_ofs(ring, ring->scan);
+		rec = (void const *)((uint8_t const *)ring->store.ptr + ofs);
+		if (SHADOW_RECORD_PAD == rec->bytes) {
+			ring->scan = shadow_ring_next(ring, ring->scan,
+			    ring->store.bytes - ofs);
+			continue;
 		}
-		thread_mutex_unlock(&crate->mutex);
+		ring->scan_counter = rec->counter;
+		ring->scan = shadow_ring_next(ring, ring->scan, sizeof *rec +
+		    (rec->bytes + SHADOW_ALIGN - 1) / SHADOW_ALIGN *
+		    SHADOW_ALIGN);
+	}
+}
 
-next:
-		sched_yield();
+/* Payload bytes of the records between tail and cut. */
+size_t
+shadow_ring_bytes(struct ModuleShadowRing const *a_ring)
+{
+	size_t bytes, pos;
+
+	bytes = 0;
+	for (pos = a_ring->tail; a_ring->cut != pos;) {
+		struct ShadowRecord const *rec;
+		size_t ofs;
+
+		ofs = shadow_ring_ofs(a_ring, pos);
+		rec = (void const *)((uint8_t const *)a_ring->store.ptr +
+		    ofs);
+		if (SHADOW_RECORD_PAD == rec->bytes) {
+			pos = shadow_ring_next(a_ring, pos,
+			    a_ring->store.bytes - ofs);
+			continue;
+		}
+		bytes += rec->bytes;
+		pos = shadow_ring_next(a_ring, pos, sizeof *rec +
+		    (rec->bytes + SHADOW_ALIGN - 1) / SHADOW_ALIGN *
+		    SHADOW_ALIGN);
 	}
-	TAILQ_FOREACH(module, &crate->module_list, next) {
+	return bytes;
+}
+
+/*
+ * Asks for a better ring split only if the ring filled up before several
+ * events in a row, a single burst is not worth a rebuild.
+ */
+void
+shadow_ring_full_check(struct Crate *a_crate, struct Module *a_module)
+{
+	struct ModuleShadowRing *ring;
+
+	ring = &a_module->shadow.ring;
+	if (!ATOMIC_LOAD(&ring->is_full)) {
+		ring->full_streak = 0;
+		return;
+	}
+	ATOMIC_STORE(&ring->is_full, 0);
+	if (SHADOW_FULL_STREAK == ++ring->full_streak) {
+		LOGF(verbose)(LOGL, "%s[%u]=%s: Shadow ring full %u times, "
+		    "asking for a rebuild.", a_crate->name, a_module->id,
+		    keyword_get_string(a_module->type), SHADOW_FULL_STREAK);
+		a_crate->shadow.do_buf_rebuild = 1;
+	}
+}
+
+/* Advances a ring position, positions wrap at twice the store size. */
+size_t
+shadow_ring_next(struct ModuleShadowRing const *a_ring, size_t a_pos, size_t
+    a_bytes)
+{
+	a_pos += a_bytes;
+	if (a_pos >= 2 * a_ring->store.bytes) {
+		a_pos -= 2 * a_ring->store.bytes;
+	}
+	return a_pos;
+}
+
+size_t
+shadow_ring_ofs(struct ModuleShadowRing const *a_ring, size_t a_pos)
+{
+	return a_pos < a_ring->store.bytes ? a_pos : a_pos -
+	    a_ring->store.bytes;
+}
+
+/* Bytes between tail and head, a full ring is told apart from an empty. */
+size_t
+shadow_ring_used(struct ModuleShadowRing const *a_ring, size_t a_head,
+    size_t a_tail)
+{
+	return a_head >= a_tail ? a_head - a_tail : a_head + 2 *
+	    a_ring->store.bytes - a_tail;
+}
+
+/* Producer side, reads the module into the largest contiguous free span. */
+uint32_t
+shadow_ring_write(struct Crate *a_crate, struct Module *a_module)
+{
+	struct EventBuffer eb;
+	struct ModuleShadowRing *ring;
+	struct ShadowRecord *rec;
+	size_t cap, head, free_bytes, need, ofs, span;
+	uint32_t ret;
+
+	ring = &a_module->shadow.ring;
+	cap = ring->store.bytes;
+	head = ring->head;
+	free_bytes = cap - shadow_ring_used(ring, head,
+	    ATOMIC_LOAD(&ring->tail));
+	ofs = shadow_ring_ofs(ring, head);
+	span = MIN(free_bytes, cap - ofs);
+	if (span < free_bytes - span) {
+		/* More room at the start, pad out the end. */
+		rec = (void *)((uint8_t *)ring->store.ptr + ofs);
+		rec->bytes = SHADOW_RECORD_PAD;
+		head = shadow_ring_next(ring, head, span);
+		ATOMIC_STORE(&ring->head, head);
+		free_bytes -= span;
+		ofs = 0;
+		span = free_bytes;
+	}
+	/*
+	 * Room for twice the largest record so far, which is what the module
+	 * may dump on us, until one has been seen a quarter of the ring.
+	 */
+	need = 0 == ring->rec_max ? cap / 4 : MIN(2 * ring->rec_max, cap / 2);
+	if (span < sizeof *rec + need) {
+		/* Let the readout catch up, it decides about a new split. */
+		ATOMIC_STORE(&ring->is_full, 1);
+		return 0;
+	}
+
+	rec = (void *)((uint8_t *)ring->store.ptr + ofs);
+	rec->counter = a_module->shadow.data_counter_value;
+	eb.ptr = rec + 1;
+	eb.bytes = span - sizeof *rec;
+	ret = a_module->props->readout_shadow(a_crate, a_module, &eb);
+	if (0 != ret) {
+		return ret;
+	}
+	rec->bytes = span - sizeof *rec - eb.bytes;
+	if (0 == rec->bytes &&
+	    rec->counter == a_module->shadow.data_counter_value) {
+		return 0;
+	}
+	rec->counter = a_module->shadow.data_counter_value;
+	ring->rec_max = MAX(ring->rec_max, rec->bytes);
+	head = shadow_ring_next(ring, head, sizeof *rec + (rec->bytes +
+	    SHADOW_ALIGN - 1) / SHADOW_ALIGN * SHADOW_ALIGN);
+	ATOMIC_STORE(&ring->head, head);
+	return 0;
+}
+
+void
+shadow_start(struct Crate *a_crate)
+{
+	struct Module *module;
+	size_t i;
+
+	for (i = 0; i < LENGTH(a_crate->shadow.group); ++i) {
+		VECTOR_FREE(&a_crate->shadow.group[i].module_ref_vec);
+	}
+	TAILQ_FOREACH(module, &a_crate->module_list, next) {
 		if (NULL == module->props ||
 		    NULL == module->props->readout_shadow) {
-			thread_mutex_clean(&module->shadow.buf_mutex);
+			continue;
+		}
+		i = KW_BUS == a_crate->shadow.group_by ?
+		    module_bus_get(module) : 0;
+		VECTOR_APPEND(&a_crate->shadow.group[i].module_ref_vec,
+		    module);
+	}
+	shadow_buf_rebuild(a_crate);
+	for (i = 0; i < LENGTH(a_crate->shadow.group); ++i) {
+		struct CrateShadowGroup *group;
+
+		group = &a_crate->shadow.group[i];
+		if (0 == group->module_ref_vec.size) {
+			continue;
+		}
+		LOGF(info)(LOGL, "Starting shadow thread %"PRIz" "
+		    "(modules=%"PRIz").", i, group->module_ref_vec.size);
+		group->is_running = 1;
+		if (!thread_start(&group->thread, shadow_func, group)) {
+			log_die(LOGL, "Could not start shadow thread.");
+		}
+	}
+	a_crate->shadow.is_running = 1;
+}
+
+void
+shadow_stop(struct Crate *a_crate)
+{
+	size_t i;
+
+	if (!a_crate->shadow.is_running) {
+		return;
+	}
+	for (i = 0; i < LENGTH(a_crate->shadow.group); ++i) {
+		struct CrateShadowGroup *group;
+
+		group = &a_crate->shadow.group[i];
+		if (group->is_running) {
+			LOGF(info)(LOGL, "Stopping shadow thread %"PRIz".",
+			    i);
+			group->is_running = 0;
+			thread_clean(&group->thread);
 		}
 	}
+	a_crate->shadow.is_running = 0;
 }
 
+/*
+ * Like shadow_merge_module, but hands out every ring record as its own
+ * segment without copying and keeps the ring until
+ * crate_readout_sg_release. Records hold whole events, so each one is
+ * verified in place.
+ */
 uint32_t
-shadow_merge_module(struct Crate *a_crate, struct Module *a_module, struct
-    EventBuffer *a_event_buffer)
+shadow_sg_module(struct Crate *a_crate, struct Module *a_module, void const
+    *a_ptr)
 {
-	struct ModuleShadowBuffer *old;
-	size_t old_idx;
-	uint32_t result, ret;
-	unsigned bytes;
+	struct ModuleShadowRing *ring;
+	size_t bytes, first, pos;
+	uint32_t result;
 
-	LOGF(spam)(LOGL, "shadow_merge_module(%s[%u]=%s) {", a_crate->name,
-	    a_module->id, keyword_get_string(a_module->type));
+	sg_flush(a_crate, a_ptr);
+	first = a_crate->sg.num;
+	ring = &a_module->shadow.ring;
+	bytes = 0;
 	result = 0;
+	for (pos = ring->tail; ring->cut != pos;) {
+		struct EventConstBuffer ceb;
+		struct ShadowRecord const *rec;
+		size_t ofs;
+		uint32_t ret;
 
-	old_idx = 1 ^ a_module->shadow.buf_idx;
-	old = &a_module->shadow.buf[old_idx];
-	bytes = old->store.bytes - old->eb.bytes;
-	LOGF(spam)(LOGL, "Shadow-buf: idx=%"PRIz" ptr=%p bytes=0x%08x",
-	    old_idx, old->store.ptr, bytes);
-
-	/* Copy into dst event buffer. */
-	if (a_event_buffer->bytes < bytes) {
-		log_error(LOGL, "%s[%u]=%s: Too much data! "
-		    "Dst=0x%08"PRIzx" B < src=0x%08x B.",
-		    a_crate->name, a_module->id,
-		    keyword_get_string(a_module->type), a_event_buffer->bytes,
-		    bytes);
-		result |= CRATE_READOUT_FAIL_DATA_TOO_MUCH;
-		goto shadow_merge_module_done;
+		ofs = shadow_ring_ofs(ring, pos);
+		rec = (void const *)((uint8_t const *)ring->store.ptr + ofs);
+		if (SHADOW_RECORD_PAD == rec->bytes) {
+			pos = shadow_ring_next(ring, pos, ring->store.bytes -
+			    ofs);
+			continue;
+		}
+		pos = shadow_ring_next(ring, pos, sizeof *rec +
+		    (rec->bytes + SHADOW_ALIGN - 1) / SHADOW_ALIGN *
+		    SHADOW_ALIGN);
+		if (0 == rec->bytes) {
+			continue;
+		}
+		ceb.ptr = rec + 1;
+		ceb.bytes = rec->bytes;
+		sg_append(a_crate, ceb.ptr, ceb.bytes);
+		bytes += ceb.bytes;
+		ret = module_verify(a_crate, a_module, &ceb);
+		if (0 != ret) {
+			log_error(LOGL, "%s:%u=%s parse error=0x%08x, "
+			    "dumping data:", a_crate->name, a_module->id,
+			    keyword_get_string(a_module->type), ret);
+			log_dump(LOGL, ceb.ptr, ceb.bytes);
+			result |= ret;
+		}
 	}
-	memcpy_(a_event_buffer->ptr, old->store.ptr, bytes);
-	a_module->eb_final.ptr = a_event_buffer->ptr;
-	a_module->eb_final.bytes = bytes;
-	EVENT_BUFFER_ADVANCE(*a_event_buffer, (uint8_t *)a_event_buffer->ptr +
-	    bytes);
+	a_crate->sg.is_held = 1;
 
-	/* Check the data. */
-	ret = a_module->props->parse_data(a_crate, a_module,
-	    &a_module->eb_final, 0);
-	result |= ret;
-	if (0 != ret) {
-		log_error(LOGL, "%s:%u=%s parse error=0x%08x, dumping data:",
-		    a_crate->name, a_module->id,
-		    keyword_get_string(a_module->type), ret);
-		log_dump(LOGL, a_module->eb_final.ptr,
-		    a_module->eb_final.bytes);
+	a_module->eb_final.bytes = bytes;
+	if (first == a_crate->sg.num) {
+		a_module->eb_final.ptr = a_ptr;
+		a_module->eb_final_place = EB_FINAL_EVENT_BUFFER;
+	} else if (1 == a_crate->sg.num - first) {
+		a_module->eb_final.ptr = a_crate->sg.array[first].ptr;
+		a_module->eb_final_place = EB_FINAL_OUTSIDE;
+	} else {
+		a_module->eb_final.ptr = NULL;
+		a_module->eb_final_place = EB_FINAL_SEGMENTS;
 	}
 
 	a_crate->shadow.max_bytes = MAX(a_crate->shadow.max_bytes, bytes);
+	a_module->shadow.max_bytes = MAX(a_module->shadow.max_bytes, bytes);
+	return result;
+}
 
-shadow_merge_module_done:
-	LOGF(spam)(LOGL, "shadow_merge_module(%s[%u]=%s:%08x) }",
-	    a_crate->name, a_module->id, keyword_get_string(a_module->type),
-	    result);
+void
+sg_append(struct Crate *a_crate, void const *a_ptr, size_t a_bytes)
+{
+	struct EventConstBuffer *seg;
+
+	if (a_crate->sg.num == a_crate->sg.capacity) {
+		void *p;
+
+		a_crate->sg.capacity = MAX(16,
+		    2 * a_crate->sg.capacity);
+		p = realloc(a_crate->sg.array,
+		    a_crate->sg.capacity *
+		    sizeof *a_crate->sg.array);
+		if (NULL == p) {
+			log_die(LOGL, "Could not grow segment array.");
+		}
+		a_crate->sg.array = p;
+	}
+	seg = &a_crate->sg.array[a_crate->sg.num++];
+	seg->ptr = a_ptr;
+	seg->bytes = a_bytes;
+}
+
+/* Emits what was written to the event buffer since the last segment. */
+void
+sg_flush(struct Crate *a_crate, void const *a_ptr)
+{
+	uint8_t const *p;
+
+	p = a_ptr;
+	if (p != a_crate->sg.flush_ptr) {
+		sg_append(a_crate, a_crate->sg.flush_ptr,
+		    (size_t)(p - a_crate->sg.flush_ptr));
+		a_crate->sg.flush_ptr = p;
+	}
+}
+
+/*
+ * Verifies the segments of a module from index a_first as one buffer, they
+ * are gathered in scratch memory if there are several. The caller dumps.
+ */
+uint32_t
+sg_parse(struct Crate *a_crate, struct Module *a_module, size_t a_first,
+    struct EventConstBuffer *a_ceb)
+{
+	size_t bytes, i;
+	uint32_t result;
+
+	if (a_first == a_crate->sg.num) {
+		a_ceb->ptr = a_crate->sg.flush_ptr;
+		a_ceb->bytes = 0;
+	} else if (1 == a_crate->sg.num - a_first) {
+		COPY(*a_ceb, a_crate->sg.array[a_first]);
+	} else {
+		uint8_t *p;
+
+		bytes = 0;
+		for (i = a_first; i < a_crate->sg.num; ++i) {
+			bytes += a_crate->sg.array[i].bytes;
+		}
+		if (bytes > a_crate->sg.scratch_bytes) {
+			FREE(a_crate->sg.scratch);
+			MALLOC(a_crate->sg.scratch, bytes);
+			a_crate->sg.scratch_bytes = bytes;
+		}
+		p = a_crate->sg.scratch;
+		for (i = a_first; i < a_crate->sg.num; ++i) {
+			memcpy_(p, a_crate->sg.array[i].ptr,
+			    a_crate->sg.array[i].bytes);
+			p += a_crate->sg.array[i].bytes;
+		}
+		a_ceb->ptr = a_crate->sg.scratch;
+		a_ceb->bytes = bytes;
+	}
+	result = module_verify(a_crate, a_module, a_ceb);
+	if (0 != result) {
+		log_error(LOGL, "%s:%u=%s parse error=0x%08x, dumping data:",
+		    a_crate->name, a_module->id,
+		    keyword_get_string(a_module->type), result);
+	}
 	return result;
 }
 
@@ -2432,6 +4813,142 @@ signature_match(struct Module const *a_left, struct Module const *a_right)
 	return do_match;
 }
 
+void
+step_build(struct Crate *a_crate)
+{
+	struct Module *module;
+	unsigned for_it, step_i_cfg;
+
+	step_free(a_crate);
+	for_it = 0;
+	TAILQ_FOREACH(module, &a_crate->module_list, next) {
+		struct CrateStep step;
+
+		step.module = module;
+		step.readout_dt = NULL;
+		step.check_empty = NULL;
+		step.for_it = for_it++;
+		step.flags = 0;
+		if (KW_BARRIER == module->type) {
+			step.flags |= STEP_BARRIER;
+			VECTOR_APPEND(&a_crate->step.readout_vec, step);
+		}
+		if (NULL == module->props) {
+			continue;
+		}
+		step.readout_dt = module->props->readout_dt;
+		step.check_empty = module->props->check_empty;
+		if (crate_get_do_shadow(a_crate) &&
+		    NULL != module->props->readout_shadow) {
+			step.flags |= STEP_SHADOW;
+		}
+		if (MODULE_FLAG_EARLY_DT & module->props->flags) {
+			step.flags |= STEP_EARLY_DT;
+		}
+		VECTOR_APPEND(&a_crate->step.empty_vec, step);
+		if (0 == module->event_max) {
+			continue;
+		}
+		if (!module->skip_dt) {
+			VECTOR_APPEND(&a_crate->step.dt_vec, step);
+		}
+		if (0 == (STEP_BARRIER & step.flags)) {
+			VECTOR_APPEND(&a_crate->step.readout_vec, step);
+		}
+	}
+	step_i_cfg = step_dt_release_get(a_crate);
+	if (a_crate->dt_release.do_reorder) {
+		step_reorder(a_crate);
+	}
+	a_crate->dt_release.step_i = step_dt_release_get(a_crate);
+	if (a_crate->dt_release.do_it) {
+		LOGF(info)(LOGL, "DT release possible on module # %u/%"PRIz
+		    " (configured order # %u).", a_crate->dt_release.step_i,
+		    a_crate->step.readout_vec.size, step_i_cfg);
+	}
+	if (a_crate->merge.do_it && 0 != a_crate->step.readout_vec.size) {
+		CALLOC(a_crate->merge.source_array,
+		    a_crate->step.readout_vec.size);
+		CALLOC(a_crate->merge.heap_array,
+		    a_crate->step.readout_vec.size);
+	}
+	LOGF(verbose)(LOGL, "%s: Steps dt=%"PRIz" readout=%"PRIz" "
+	    "empty=%"PRIz".", a_crate->name, a_crate->step.dt_vec.size,
+	    a_crate->step.readout_vec.size, a_crate->step.empty_vec.size);
+}
+
+/*
+ * DT can be released after the last module that cannot buffer the next
+ * event, returns the readout step before which that happens.
+ */
+unsigned
+step_dt_release_get(struct Crate const *a_crate)
+{
+	struct CrateStep const *step;
+	unsigned step_i, ret;
+
+	step_i = 0;
+	ret = 0;
+	VECTOR_FOREACH(step, &a_crate->step.readout_vec) {
+		++step_i;
+		if (0 == ((STEP_BARRIER | STEP_EARLY_DT) & step->flags)) {
+			ret = step_i;
+		}
+	}
+	return ret;
+}
+
+void
+step_free(struct Crate *a_crate)
+{
+	VECTOR_FREE(&a_crate->step.dt_vec);
+	VECTOR_FREE(&a_crate->step.readout_vec);
+	VECTOR_FREE(&a_crate->step.empty_vec);
+	FREE(a_crate->merge.source_array);
+	FREE(a_crate->merge.heap_array);
+}
+
+/*
+ * Moves modules that must be read before DT release ahead of early-DT
+ * modules, without crossing barriers or swapping modules whose data could
+ * be mistaken for each other.
+ */
+void
+step_reorder(struct Crate *a_crate)
+{
+	struct CrateStep *arr;
+	size_t i, j;
+
+	arr = a_crate->step.readout_vec.array;
+	for (i = 0; i < a_crate->step.readout_vec.size; ++i) {
+		struct CrateStep step;
+
+		if (0 != ((STEP_BARRIER | STEP_EARLY_DT) & arr[i].flags)) {
+			continue;
+		}
+		for (j = i; 0 < j; --j) {
+			if (STEP_EARLY_DT != ((STEP_BARRIER | STEP_EARLY_DT) &
+			    arr[j - 1].flags)) {
+				break;
+			}
+			if (signature_match(arr[j - 1].module,
+			    arr[i].module)) {
+				break;
+			}
+		}
+		if (j == i) {
+			continue;
+		}
+		LOGF(verbose)(LOGL, "%s[%u]=%s: Moved readout %"PRIz"->%"PRIz
+		    " for early DT release.", a_crate->name,
+		    arr[i].module->id,
+		    keyword_get_string(arr[i].module->type), i, j);
+		COPY(step, arr[i]);
+		memmove(&arr[j + 1], &arr[j], (i - j) * sizeof *arr);
+		COPY(arr[j], step);
+	}
+}
+
 struct CrateTag *
 tag_get(struct Crate *a_crate, char const *a_name)
 {
@@ -2449,6 +4966,147 @@ tag_get(struct Crate *a_crate, char const *a_name)
 	return tag;
 }
 
+void
+time_stat_pack(struct PackerList *a_list, struct TimeStat const *a_stat)
+{
+	size_t i;
+
+	PACKER_LIST_PACK(*a_list, 32, a_stat->num);
+	PACKER_LIST_PACK(*a_list, 32, a_stat->max_ns);
+	PACKER_LIST_PACK(*a_list, 64, a_stat->sum_ns);
+	for (i = 0; i < LENGTH(a_stat->hist); ++i) {
+		PACKER_LIST_PACK(*a_list, 32, a_stat->hist[i]);
+	}
+}
+
+/*
+ * Waits until the verification thread has parsed everything of this event
+ * and turns failures into a re-init, which must happen before the event
+ * buffer is handed on.
+ */
+void
+verify_drain(struct Crate *a_crate)
+{
+	struct CrateVerifyJob *job;
+
+	if (!a_crate->verify.is_running) {
+		return;
+	}
+	THREAD_MUTEX_LOCK(&a_crate->verify.mutex);
+	while (a_crate->verify.job_vec.size != a_crate->verify.next) {
+		thread_condvar_wait(&a_crate->verify.done,
+		    &a_crate->verify.mutex);
+	}
+	VECTOR_FOREACH(job, &a_crate->verify.job_vec) {
+		if (0 != job->result) {
+			job->module->result |= job->result;
+			a_crate->state = STATE_REINIT;
+		}
+	}
+	a_crate->verify.job_vec.size = 0;
+	a_crate->verify.next = 0;
+	thread_mutex_unlock(&a_crate->verify.mutex);
+}
+
+void
+verify_func(void *a_data)
+{
+	struct Crate *crate;
+
+	/* Same as for the shadow thread, log levels are not touched. */
+
+	crate = a_data;
+
+	THREAD_MUTEX_LOCK(&crate->verify.mutex);
+	for (;;) {
+		struct CrateVerifyJob job;
+		uint32_t result;
+
+		while (crate->verify.is_running &&
+		    crate->verify.job_vec.size == crate->verify.next) {
+			thread_condvar_wait(&crate->verify.work,
+			    &crate->verify.mutex);
+		}
+		if (!crate->verify.is_running) {
+			break;
+		}
+		/* The vector may be reallocated by the readout, copy. */
+		COPY(job, crate->verify.job_vec.array[crate->verify.next]);
+		thread_mutex_unlock(&crate->verify.mutex);
+
+		result = module_verify(crate, job.module, &job.ceb);
+		if (0 != result) {
+			log_error(LOGL, "%s[%u]=%s parse error=0x%08x in "
+			    "event with crate counter=0x%08x, dumping data:",
+			    crate->name, job.module->id,
+			    keyword_get_string(job.module->type), result,
+			    job.counter);
+			log_dump(LOGL, job.ceb.ptr, job.ceb.bytes);
+		}
+
+		THREAD_MUTEX_LOCK(&crate->verify.mutex);
+		crate->verify.job_vec.array[crate->verify.next].result =
+		    result;
+		if (crate->verify.job_vec.size == ++crate->verify.next) {
+			thread_condvar_signal(&crate->verify.done);
+		}
+	}
+	thread_mutex_unlock(&crate->verify.mutex);
+}
+
+void
+verify_push(struct Crate *a_crate, struct Module *a_module, struct
+    EventConstBuffer const *a_ceb)
+{
+	struct CrateVerifyJob job;
+
+	job.module = a_module;
+	COPY(job.ceb, *a_ceb);
+	job.counter = a_module->crate_counter->value;
+	job.result = 0;
+	THREAD_MUTEX_LOCK(&a_crate->verify.mutex);
+	VECTOR_APPEND(&a_crate->verify.job_vec, job);
+	thread_condvar_signal(&a_crate->verify.work);
+	thread_mutex_unlock(&a_crate->verify.mutex);
+}
+
+void
+verify_start(struct Crate *a_crate)
+{
+	LOGF(info)(LOGL, "Starting verification thread.");
+	a_crate->verify.job_vec.size = 0;
+	a_crate->verify.next = 0;
+	a_crate->verify.is_running = 1;
+	if (!thread_start(&a_crate->verify.thread, verify_func, a_crate)) {
+		log_die(LOGL, "Could not start verification thread.");
+	}
+}
+
+void
+verify_stop(struct Crate *a_crate)
+{
+	if (!a_crate->verify.is_running) {
+		return;
+	}
+	LOGF(info)(LOGL, "Stopping verification thread.");
+	THREAD_MUTEX_LOCK(&a_crate->verify.mutex);
+	a_crate->verify.is_running = 0;
+	thread_condvar_signal(&a_crate->verify.work);
+	thread_mutex_unlock(&a_crate->verify.mutex);
+	thread_clean(&a_crate->verify.thread);
+	a_crate->verify.job_vec.size = 0;
+	a_crate->verify.next = 0;
+}
+
+struct Map *
+write_cache_get_map(struct Module *a_module)
+{
+	if (!a_module->do_write_cache) {
+		return NULL;
+	}
+	return a_module->props->get_map(a_module);
+}
+
 #if NCONF_mMAP_bCMVLC
 void
 crate_cmvlc_init(struct Crate *a_crate, struct cmvlc_stackcmdbuf *a_stack,
@@ -2625,6 +5283,7 @@ crate_cmvlc_fetch(struct Crate *a_crate, struct EventBuffer *a_event_buffer,
 		ceb.ptr = eb_orig.ptr;
 		ceb.bytes = eb_orig.bytes - a_event_buffer->bytes;
 		COPY(module->eb_final, ceb);
+		module->eb_final_place = EB_FINAL_EVENT_BUFFER;
 		pop_log_level(module);
 
 		/* An error means that the packaging is out of sync.
@@ -2640,8 +5299,7 @@ crate_cmvlc_fetch(struct Crate *a_crate, struct EventBuffer *a_event_buffer,
 			goto done;
 		}
 
-		result = module->props->parse_data(a_crate, module, &ceb,
-		    0);
+		result = module_verify(a_crate, module, &ceb);
 		if (0 != result) {
 			log_error(LOGL, "%s[%u]=%s parse error=0x%08x,"
 			    " dumping data:", a_crate->name, module->id,
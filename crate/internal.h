@@ -24,19 +24,38 @@
 #ifndef CRATE_INTERNAL_H
 #define CRATE_INTERNAL_H
 
+#include <nurdlib/base.h>
 #include <util/funcattr.h>
+#include <util/stdint.h>
 
 struct ConfigBlock;
 struct CrateTag;
+struct EventBuffer;
+struct Module;
 struct Packer;
 struct PackerList;
 
+/* Module data to be time-sorted, with the cursor at the next hit. */
+struct CrateMergeSource {
+	struct	Module *module;
+	struct	EventConstBuffer ceb;
+	uint64_t	ts;
+	size_t	bytes;
+};
+
 int	crate_config_write(int, int, int, struct Packer *) FUNC_RETURNS;
 void	crate_gsi_pex_goc_read(uint8_t, uint8_t, uint16_t, uint32_t, uint16_t,
     uint32_t *);
 void	crate_gsi_pex_goc_write(uint8_t, uint8_t, uint16_t, uint32_t,
     uint16_t, uint32_t);
+void	crate_dt_stats_pack(struct PackerList *, int);
 void	crate_info_pack(struct Packer *, int);
+/*
+ * K-way merges the hits of all sources into the event buffer, the heap
+ * needs room for one pointer per source.
+ */
+uint32_t	crate_merge(struct CrateMergeSource *, struct CrateMergeSource
+    **, size_t, uint64_t, struct EventBuffer *) FUNC_RETURNS;
 void	crate_module_access_pack(uint8_t, uint8_t, int, struct Packer *,
     struct PackerList *);
 void	crate_pack(struct PackerList *);
@@ -0,0 +1,180 @@
+/*
+ * nurdlib, NUstar ReaDout LIBrary
+ *
+ * Copyright (C) 2026
+ * nurdlib contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#include <nurdlib/crate.h>
+#include <crate/internal.h>
+#include <string.h>
+#include <module/module.h>
+#include <nurdlib/log.h>
+#include <util/memcpy.h>
+
+static void	heap_down(struct CrateMergeSource **, size_t, size_t);
+static int	source_next(struct CrateMergeSource *) FUNC_RETURNS;
+
+/* Sifts entry 'a_i' down the min-heap on the next hit timestamp. */
+void
+heap_down(struct CrateMergeSource **a_heap, size_t a_num, size_t a_i)
+{
+	for (;;) {
+		struct CrateMergeSource *tmp;
+		size_t l, r, min;
+
+		l = 2 * a_i + 1;
+		r = l + 1;
+		min = a_i;
+		if (l < a_num && a_heap[l]->ts < a_heap[min]->ts) {
+			min = l;
+		}
+		if (r < a_num && a_heap[r]->ts < a_heap[min]->ts) {
+			min = r;
+		}
+		if (min == a_i) {
+			return;
+		}
+		tmp = a_heap[a_i];
+		a_heap[a_i] = a_heap[min];
+		a_heap[min] = tmp;
+		a_i = min;
+	}
+}
+
+/*
+ * Steps to the next hit of a source.
+ *  return 1 = hit, 0 = exhausted, -1 = corrupt.
+ */
+int
+source_next(struct CrateMergeSource *a_source)
+{
+	struct EventConstBuffer *ceb;
+
+	ceb = &a_source->ceb;
+	ceb->ptr = (uint8_t const *)ceb->ptr + a_source->bytes;
+	ceb->bytes -= a_source->bytes;
+	a_source->bytes = 0;
+	while (0 != ceb->bytes) {
+		size_t bytes;
+
+		bytes = a_source->module->props->hit_next(a_source->module,
+		    ceb, &a_source->ts);
+		if (0 == bytes || 0 != bytes % sizeof(uint32_t) ||
+		    ceb->bytes < bytes) {
+			log_error(LOGL, "Module[%u]: Could not split hits, "
+			    "0x%08"PRIzx" B left.", a_source->module->id,
+			    ceb->bytes);
+			log_dump(LOGL, ceb->ptr, ceb->bytes);
+			return -1;
+		}
+		if (MODULE_HIT_SKIP != a_source->ts) {
+			a_source->bytes = bytes;
+			return 1;
+		}
+		ceb->ptr = (uint8_t const *)ceb->ptr + bytes;
+		ceb->bytes -= bytes;
+	}
+	return 0;
+}
+
+uint32_t
+crate_merge(struct CrateMergeSource *a_source, struct CrateMergeSource
+    **a_heap, size_t a_num, uint64_t a_window, struct EventBuffer
+    *a_event_buffer)
+{
+	uint32_t *group;
+	uint64_t group_ts;
+	size_t heap_num, i;
+	uint32_t result;
+
+	LOGF(spam)(LOGL, "crate_merge(sources=%"PRIz") {", a_num);
+	result = 0;
+
+	/* Build the heap from the first hit of every source. */
+	heap_num = 0;
+	for (i = 0; i < a_num; ++i) {
+		int ret;
+
+		a_source[i].bytes = 0;
+		ret = source_next(&a_source[i]);
+		if (-1 == ret) {
+			result |= CRATE_READOUT_FAIL_DATA_CORRUPT;
+		} else if (1 == ret) {
+			a_heap[heap_num++] = &a_source[i];
+		}
+	}
+	for (i = heap_num / 2; 0 < i--;) {
+		heap_down(a_heap, heap_num, i);
+	}
+
+	/* Always emit the earliest hit, group hits within the window. */
+	group = NULL;
+	group_ts = 0;
+	while (0 != heap_num) {
+		struct CrateMergeSource *source;
+		uint32_t *p32;
+		size_t words;
+		int ret;
+
+		source = a_heap[0];
+		words = source->bytes / sizeof(uint32_t);
+		if (NULL == group || source->ts - group_ts > a_window) {
+			if (a_event_buffer->bytes < 3 * sizeof *p32) {
+				result |= CRATE_READOUT_FAIL_DATA_TOO_MUCH;
+				break;
+			}
+			p32 = a_event_buffer->ptr;
+			group = p32;
+			group_ts = source->ts;
+			*p32++ = CRATE_MERGE_GROUP;
+			*p32++ = (uint32_t)group_ts;
+			*p32++ = (uint32_t)(group_ts >> 32);
+			EVENT_BUFFER_ADVANCE(*a_event_buffer, p32);
+		}
+		if (0xffff < words) {
+			log_error(LOGL, "Module[%u]: Hit of 0x%"PRIzx" words "
+			    "does not fit the merge hit header.",
+			    source->module->id, words);
+			result |= CRATE_READOUT_FAIL_DATA_TOO_MUCH;
+			break;
+		}
+		if (a_event_buffer->bytes < (1 + words) * sizeof *p32) {
+			result |= CRATE_READOUT_FAIL_DATA_TOO_MUCH;
+			break;
+		}
+		p32 = a_event_buffer->ptr;
+		*p32++ = CRATE_MERGE_HIT | (0xff & source->module->id) << 16 |
+		    (uint32_t)words;
+		memcpy_(p32, source->ceb.ptr, source->bytes);
+		p32 += words;
+		EVENT_BUFFER_ADVANCE(*a_event_buffer, p32);
+		++*group;
+
+		ret = source_next(source);
+		if (1 != ret) {
+			if (-1 == ret) {
+				result |= CRATE_READOUT_FAIL_DATA_CORRUPT;
+			}
+			a_heap[0] = a_heap[--heap_num];
+		}
+		heap_down(a_heap, heap_num, 0);
+	}
+	LOGF(spam)(LOGL, "crate_merge(0x%08x) }", result);
+	return result;
+}
@@ -71,6 +71,8 @@ static void	send_crate_array(struct UDPServer *, struct UDPAddress const
     *);
 static void	send_crate_info(struct UDPServer *, struct UDPAddress const *,
     int);
+static void	send_dt_stats(struct UDPServer *, struct UDPAddress const *,
+    int);
 static void	send_goc_read(struct UDPServer *, struct UDPAddress const *,
     uint8_t, uint8_t, uint16_t, uint32_t, uint16_t, uint32_t);
 static void	send_module_access(struct UDPServer *, struct UDPAddress const
@@ -83,6 +85,7 @@ static void	send_packer_list(struct UDPServer *, struct UDPAddress const
 static void	send_register_array(struct UDPServer *, struct UDPAddress
     const *, int, int, int);
 static void	server_run(void *);
+static void	time_stat_print(char const *, struct TimeStat const *);
 static int	unpack_config_list(struct DatagramArray *, size_t *, struct
     Packer *, struct CtrlConfigList *) FUNC_RETURNS;
 static void	unpack_empty(struct Packer *);
@@ -92,6 +95,8 @@ static int	unpack_scalar(struct DatagramArray *, size_t *, struct Packer
     *, struct CtrlConfigScalar *) FUNC_RETURNS;
 static int	unpack_scalar_list(struct DatagramArray *, size_t *, struct
     Packer *, struct CtrlConfigScalarList *) FUNC_RETURNS;
+static int	unpack_time_stat(struct DatagramArray *, size_t *, struct
+    Packer *, struct TimeStat *) FUNC_RETURNS;
 
 /* Looks at MD5 sum. */
 int
@@ -462,6 +467,7 @@ ctrl_client_crate_info_get(struct CtrlClient *a_client, struct CtrlCrateInfo
 {
 	struct UDPDatagram dgram;
 	struct Packer packer;
+	unsigned i;
 	uint16_t u16;
 
 	PACKER_CREATE_STATIC(packer, dgram.buf);
@@ -481,14 +487,167 @@ fail:
 		unpack_empty(&packer);
 		return 0;
 	}
+	a_crate_info->event_max_override = u16;
 	if (!unpack8(&packer, &a_crate_info->dt_release) ||
+	    !unpack8(&packer, &a_crate_info->dt_release_stats.step_i) ||
+	    !unpack8(&packer, &a_crate_info->dt_release_stats.step_num) ||
 	    !unpack16(&packer, &a_crate_info->acvt) ||
-	    !unpack32(&packer, &a_crate_info->shadow.buf_bytes) ||
-	    !unpack32(&packer, &a_crate_info->shadow.max_bytes)) {
+	    !unpack16(&packer, &a_crate_info->acvt_stats.step_ns)) {
+		log_error(LOGL, "Crate info corrupt.");
+		return 0;
+	}
+	for (i = 0; i < CTRL_ACVT_POLL_BUCKETS; ++i) {
+		if (!unpack32(&packer,
+		    &a_crate_info->acvt_stats.poll_hist[i])) {
+			log_error(LOGL, "Crate info corrupt.");
+			return 0;
+		}
+	}
+	if (!unpack8(&packer, &a_crate_info->acvt_stats.history_num) ||
+	    a_crate_info->acvt_stats.history_num > CTRL_ACVT_HISTORY_MAX) {
+		log_error(LOGL, "Crate info corrupt.");
+		return 0;
+	}
+	for (i = 0; i < a_crate_info->acvt_stats.history_num; ++i) {
+		if (!unpack16(&packer,
+		    &a_crate_info->acvt_stats.history[i].ns) ||
+		    !unpack16(&packer,
+		    &a_crate_info->acvt_stats.history[i].event_num) ||
+		    !unpack16(&packer,
+		    &a_crate_info->acvt_stats.history[i].miss_num)) {
+			log_error(LOGL, "Crate info corrupt.");
+			return 0;
+		}
+	}
+	if (!unpack32(&packer, &a_crate_info->shadow.buf_bytes) ||
+	    !unpack32(&packer, &a_crate_info->shadow.max_bytes) ||
+	    !unpack32(&packer, &a_crate_info->poll.event_num) ||
+	    !unpack32(&packer, &a_crate_info->poll.sum) ||
+	    !unpack32(&packer, &a_crate_info->poll.max) ||
+	    !unpack8(&packer, &a_crate_info->shadow.module_num) ||
+	    a_crate_info->shadow.module_num > CTRL_SHADOW_MODULE_MAX) {
 		log_error(LOGL, "Crate info corrupt.");
 		return 0;
 	}
+	for (i = 0; i < a_crate_info->shadow.module_num; ++i) {
+		if (!unpack8(&packer, &a_crate_info->shadow.module[i].id) ||
+		    !unpack32(&packer,
+		    &a_crate_info->shadow.module[i].ring_bytes) ||
+		    !unpack32(&packer,
+		    &a_crate_info->shadow.module[i].max_bytes) ||
+		    !unpack32(&packer,
+		    &a_crate_info->shadow.module[i].fill_max)) {
+			log_error(LOGL, "Crate info corrupt.");
+			return 0;
+		}
+	}
+	return 1;
+}
+
+void
+ctrl_client_dt_stats_free(struct CtrlDtStats *a_stats)
+{
+	FREE(a_stats->module_array);
+	a_stats->module_num = 0;
+}
+
+int
+ctrl_client_dt_stats_get(struct CtrlClient *a_client, struct CtrlDtStats
+    *a_stats, int a_crate_i)
+{
+	struct DatagramArray dgram_array;
+	struct UDPDatagram dgram;
+	struct Packer packer;
+	size_t dgram_array_i, i;
+	uint8_t num;
+
+	ZERO(*a_stats);
+
+	PACKER_CREATE_STATIC(packer, dgram.buf);
+	PACK(packer, 32, NURDLIB_MD5, pack_fail);
+	PACK(packer,  8, VL_CTRL_DT_STATS, pack_fail);
+	PACK(packer,  8, a_crate_i, pack_fail);
+	if (!client_send_recv_seq(a_client, &dgram, &packer, &dgram_array)) {
+pack_fail:
+		log_error(LOGL, "Could not fetch dead-time stats.");
+		return 0;
+	}
+	dgram_array_i = -1;
+	if (!packer_lookup(&dgram_array, &dgram_array_i, &packer) ||
+	    !unpack8(&packer, &num)) {
+		goto unpack_fail;
+	}
+	if (0 == num) {
+		FREE(dgram_array.array);
+		log_error(LOGL, "Crate=%d not found.", a_crate_i);
+		return 0;
+	}
+	if (CTRL_DT_PHASE_NUM != num) {
+		goto unpack_fail;
+	}
+	for (i = 0; i < num; ++i) {
+		if (!unpack_time_stat(&dgram_array, &dgram_array_i, &packer,
+		    &a_stats->phase[i])) {
+			goto unpack_fail;
+		}
+	}
+	if (!packer_lookup(&dgram_array, &dgram_array_i, &packer) ||
+	    !unpack8(&packer, &num)) {
+		goto unpack_fail;
+	}
+	a_stats->module_num = num;
+	CALLOC(a_stats->module_array, num);
+	for (i = 0; i < num; ++i) {
+		struct CtrlDtModule *module;
+		uint16_t type;
+
+		module = &a_stats->module_array[i];
+		if (!packer_lookup(&dgram_array, &dgram_array_i, &packer) ||
+		    !unpack8(&packer, &module->id) ||
+		    !packer_lookup(&dgram_array, &dgram_array_i, &packer) ||
+		    !unpack16(&packer, &type)) {
+			goto unpack_fail;
+		}
+		module->type = type;
+		if (!unpack_time_stat(&dgram_array, &dgram_array_i, &packer,
+		    &module->readout_dt) ||
+		    !unpack_time_stat(&dgram_array, &dgram_array_i, &packer,
+		    &module->readout) ||
+		    !unpack_time_stat(&dgram_array, &dgram_array_i, &packer,
+		    &module->parse)) {
+			goto unpack_fail;
+		}
+	}
+	FREE(dgram_array.array);
 	return 1;
+unpack_fail:
+	FREE(dgram_array.array);
+	ctrl_client_dt_stats_free(a_stats);
+	log_error(LOGL, "Dead-time stats corrupt.");
+	return 0;
+}
+
+void
+ctrl_client_dt_stats_print(struct CtrlDtStats const *a_stats)
+{
+	char const *c_phase_name[CTRL_DT_PHASE_NUM] = {"counter",
+		"readout_dt", "readout", "check_empty", "dt_release"};
+	size_t i;
+
+	printf("Phase histograms, buckets <1us, <2us, <4us ... >=16ms.\n");
+	for (i = 0; i < CTRL_DT_PHASE_NUM; ++i) {
+		time_stat_print(c_phase_name[i], &a_stats->phase[i]);
+	}
+	for (i = 0; i < a_stats->module_num; ++i) {
+		struct CtrlDtModule const *module;
+
+		module = &a_stats->module_array[i];
+		printf("Module[%u]=%s:\n", module->id,
+		    keyword_get_string(module->type));
+		time_stat_print("readout_dt", &module->readout_dt);
+		time_stat_print("readout", &module->readout);
+		time_stat_print("parse_data", &module->parse);
+	}
 }
 
 int
@@ -1068,6 +1227,7 @@ send_crate_info(struct UDPServer *a_server, struct UDPAddress const
 	struct UDPDatagram dgram;
 	struct Packer packer;
 
+	STATIC_ASSERT(CTRL_CRATE_INFO_BYTES_MAX <= sizeof dgram.buf);
 	LOGF(verbose)(LOGL, "Sending crate info for crate=%d.", a_crate_i);
 	PACKER_CREATE_STATIC(packer, dgram.buf);
 	PACK(packer, 32, NURDLIB_MD5, fail);
@@ -1077,6 +1237,20 @@ fail:
 	;
 }
 
+void
+send_dt_stats(struct UDPServer *a_server, struct UDPAddress const
+    *a_address, int a_crate_i)
+{
+	struct PackerList packer_list;
+
+	LOGF(verbose)(LOGL, "Sending dead-time stats for crate=%d.",
+	    a_crate_i);
+	TAILQ_INIT(&packer_list);
+	crate_dt_stats_pack(&packer_list, a_crate_i);
+	send_packer_list(a_server, a_address, &packer_list);
+	packer_list_free(&packer_list);
+}
+
 void
 send_goc_read(struct UDPServer *a_server, struct UDPAddress const *a_address,
     uint8_t a_crate_i, uint8_t a_sfp, uint16_t a_card, uint32_t a_offset,
@@ -1289,11 +1463,32 @@ pack_fail:
 				    crate_i, module_j, submodule_int,
 				    &packer);
 			}
+			break;
+		case VL_CTRL_DT_STATS:
+			if (unpack8(&packer, &crate_i)) {
+				send_dt_stats(server->server, address,
+				    crate_i);
+			}
+			break;
 		}
 	}
 	LOGF(info)(LOGL, "Control server offline.");
 }
 
+void
+time_stat_print(char const *a_name, struct TimeStat const *a_stat)
+{
+	unsigned i;
+
+	printf(" %-12s n=%-10u avg=%10.3fus max=%10.3fus |", a_name,
+	    a_stat->num, 0 == a_stat->num ? 0.0 :
+	    1e-3 * a_stat->sum_ns / a_stat->num, 1e-3 * a_stat->max_ns);
+	for (i = 0; i < TIME_STAT_BUCKETS; ++i) {
+		printf(" %u", a_stat->hist[i]);
+	}
+	printf("\n");
+}
+
 int
 unpack_config_list(struct DatagramArray *a_dgram_array, size_t
     *a_dgram_array_i, struct Packer *a_packer, struct CtrlConfigList *a_list)
@@ -1679,3 +1874,27 @@ unpack_scalar_list(struct DatagramArray *a_dgram_array, size_t
 	}
 	return 1;
 }
+
+int
+unpack_time_stat(struct DatagramArray *a_dgram_array, size_t
+    *a_dgram_array_i, struct Packer *a_packer, struct TimeStat *a_stat)
+{
+	size_t i;
+
+	if (!packer_lookup(a_dgram_array, a_dgram_array_i, a_packer) ||
+	    !unpack32(a_packer, &a_stat->num) ||
+	    !packer_lookup(a_dgram_array, a_dgram_array_i, a_packer) ||
+	    !unpack32(a_packer, &a_stat->max_ns) ||
+	    !packer_lookup(a_dgram_array, a_dgram_array_i, a_packer) ||
+	    !unpack64(a_packer, &a_stat->sum_ns)) {
+		return 0;
+	}
+	for (i = 0; i < LENGTH(a_stat->hist); ++i) {
+		if (!packer_lookup(a_dgram_array, a_dgram_array_i,
+		    a_packer) ||
+		    !unpack32(a_packer, &a_stat->hist[i])) {
+			return 0;
+		}
+	}
+	return 1;
+}
@@ -29,6 +29,7 @@
 #include <util/funcattr.h>
 #include <util/queue.h>
 #include <util/stdint.h>
+#include <util/time.h>
 
 struct Packer;
 
@@ -41,7 +42,17 @@ enum CtrlCommand {
 	VL_CTRL_CONFIG_DUMP,
 	VL_CTRL_GOC_READ,
 	VL_CTRL_GOC_WRITE,
-	VL_CTRL_MODULE_ACCESS
+	VL_CTRL_MODULE_ACCESS,
+	VL_CTRL_DT_STATS
+};
+/* Dead-time phases timed by the crate for every event. */
+enum CtrlDtPhase {
+	CTRL_DT_COUNTER,
+	CTRL_DT_READOUT_DT,
+	CTRL_DT_READOUT,
+	CTRL_DT_CHECK_EMPTY,
+	CTRL_DT_RELEASE,
+	CTRL_DT_PHASE_NUM
 };
 struct CtrlClient;
 struct CtrlServer;
@@ -85,14 +96,64 @@ struct CtrlCrateArray {
 	size_t	num;
 	struct	CtrlCrate *array;
 };
+/* Sized so that the worst-case crate info fits in one datagram. */
+#define CTRL_SHADOW_MODULE_MAX 24
+/* Extra polls per event in buckets 0, 1, 2-3, 4-7 etc. */
+#define CTRL_ACVT_POLL_BUCKETS 8
+#define CTRL_ACVT_HISTORY_MAX 16
+/* Packed crate info with every list full, including the leading MD5. */
+#define CTRL_CRATE_INFO_BYTES_MAX (4 + 9 + 4 * CTRL_ACVT_POLL_BUCKETS + \
+	1 + 6 * CTRL_ACVT_HISTORY_MAX + 5 * 4 + 1 + \
+	13 * CTRL_SHADOW_MODULE_MAX)
 struct CtrlCrateInfo {
 	uint16_t	event_max_override;
 	uint8_t	dt_release;
+	struct {
+		/* Readout step before which dt is released. */
+		uint8_t	step_i;
+		uint8_t	step_num;
+	} dt_release_stats;
 	uint16_t	acvt;
+	struct {
+		uint16_t	step_ns;
+		uint32_t	poll_hist[CTRL_ACVT_POLL_BUCKETS];
+		/* Finished control windows, oldest first. */
+		uint8_t	history_num;
+		struct {
+			uint16_t	ns;
+			uint16_t	event_num;
+			uint16_t	miss_num;
+		} history[CTRL_ACVT_HISTORY_MAX];
+	} acvt_stats;
 	struct {
 		uint32_t	buf_bytes;
 		uint32_t	max_bytes;
+		/* Per-module ring sizes and high-water marks. */
+		uint8_t	module_num;
+		struct {
+			uint8_t	id;
+			uint32_t	ring_bytes;
+			uint32_t	max_bytes;
+			uint32_t	fill_max;
+		} module[CTRL_SHADOW_MODULE_MAX];
 	} shadow;
+	struct {
+		uint32_t	event_num;
+		uint32_t	sum;
+		uint32_t	max;
+	} poll;
+};
+struct CtrlDtModule {
+	uint8_t	id;
+	enum	Keyword type;
+	struct	TimeStat readout_dt;
+	struct	TimeStat readout;
+	struct	TimeStat parse;
+};
+struct CtrlDtStats {
+	struct	TimeStat phase[CTRL_DT_PHASE_NUM];
+	size_t	module_num;
+	struct	CtrlDtModule *module_array;
 };
 struct CtrlModule {
 	enum	Keyword type;
@@ -145,6 +206,11 @@ int			ctrl_client_crate_array_get(struct CtrlClient *,
     struct CtrlCrateArray *);
 int			ctrl_client_crate_info_get(struct CtrlClient *, struct
     CtrlCrateInfo *, int);
+void			ctrl_client_dt_stats_free(struct CtrlDtStats *);
+int			ctrl_client_dt_stats_get(struct CtrlClient *, struct
+    CtrlDtStats *, int) FUNC_RETURNS;
+void			ctrl_client_dt_stats_print(struct CtrlDtStats const
+    *);
 int			ctrl_client_goc_read(struct CtrlClient *, uint8_t,
     uint8_t, uint16_t, uint32_t, uint16_t, uint32_t *) FUNC_RETURNS;
 void			ctrl_client_goc_write(struct CtrlClient *, uint8_t,
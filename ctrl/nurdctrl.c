@@ -148,6 +148,7 @@ P"                                Examples:"Q
 P"                                -s print"Q
 P"                                -s 0,1"Q
 P"  -C, --crate-info              Show various fun info."Q
+P"  -T, --dt-stats                Show dead-time breakdown of crate."Q
 P"  -c, --config str              Write config to module given with -s."Q
 P"                                '-' to read from stdin."Q
 P"                                Limited to 256 bytes because reasons."Q
@@ -296,6 +297,7 @@ main(int argc, char **argv)
 			}
 		} else if (arg_match(argc, argv, 'C', "crate-info", NULL)) {
 			struct CtrlCrateInfo crate_info;
+			unsigned i;
 
 			LOGF(verbose)(LOGL, "Getting crate info.");
 			if (-1 == crate_i) {
@@ -307,14 +309,65 @@ main(int argc, char **argv)
 			    crate_i)) {
 				printf("Events-override..: %u\n",
 				    crate_info.event_max_override);
-				printf("DT release.......: %s\n",
-				    crate_info.dt_release ? "yes" : "no");
-				printf("ACVT.............: %u\n",
-				    crate_info.acvt);
+				printf("DT release.......: %s (step=%u/%u)\n",
+				    crate_info.dt_release ? "yes" : "no",
+				    crate_info.dt_release_stats.step_i,
+				    crate_info.dt_release_stats.step_num);
+				printf("ACVT.............: %u (step=%u)\n",
+				    crate_info.acvt,
+				    crate_info.acvt_stats.step_ns);
+				printf("ACVT extra polls.:");
+				for (i = 0; i < CTRL_ACVT_POLL_BUCKETS; ++i) {
+					printf(" %u", crate_info.acvt_stats.
+					    poll_hist[i]);
+				}
+				printf("\n");
+				for (i = 0; i < crate_info.acvt_stats.
+				    history_num; ++i) {
+					printf(" ACVT window[%2u]: ns=%u "
+					    "events=%u misses=%u\n", i,
+					    crate_info.acvt_stats.history[i].
+					    ns,
+					    crate_info.acvt_stats.history[i].
+					    event_num,
+					    crate_info.acvt_stats.history[i].
+					    miss_num);
+				}
 				printf("Shadow buf bytes.: %u\n",
 				    crate_info.shadow.buf_bytes);
 				printf("Shadow fill bytes: %u\n",
 				    crate_info.shadow.max_bytes);
+				printf("Polls/event......: %.2f (max=%u)\n",
+				    0 == crate_info.poll.event_num ? 0.0 :
+				    (double)crate_info.poll.sum /
+				    crate_info.poll.event_num,
+				    crate_info.poll.max);
+				for (i = 0; i < crate_info.shadow.module_num;
+				    ++i) {
+					printf(" Shadow module[%u]: ring=%u "
+					    "event-max=%u fill-max=%u\n",
+					    crate_info.shadow.module[i].id,
+					    crate_info.shadow.module[i].
+					    ring_bytes,
+					    crate_info.shadow.module[i].
+					    max_bytes,
+					    crate_info.shadow.module[i].
+					    fill_max);
+				}
+			}
+		} else if (arg_match(argc, argv, 'T', "dt-stats", NULL)) {
+			struct CtrlDtStats dt_stats;
+
+			LOGF(verbose)(LOGL, "Getting dead-time stats.");
+			if (-1 == crate_i) {
+				usage("Please specify the crate to get "
+				    "dead-time stats from!");
+			}
+			conn();
+			if (ctrl_client_dt_stats_get(g_client, &dt_stats,
+			    crate_i)) {
+				ctrl_client_dt_stats_print(&dt_stats);
+				ctrl_client_dt_stats_free(&dt_stats);
 			}
 		} else if (arg_match(argc, argv, 'c', "config", &str)) {
 			char buf[256];
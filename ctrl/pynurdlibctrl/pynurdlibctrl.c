@@ -119,8 +119,18 @@ nurdlibctrl_crate_info(NurdlibCtrl *self, PyObject *args)
 	}
 
 	ctrl_client_crate_info_get(self->client, &info, crate_index);
-	PyObject *list = PyList_New(1);
+	PyObject *list = PyList_New(6);
 	PyList_SetItem(list, 0, Py_BuildValue("(si)", "acvt", info.acvt));
+	PyList_SetItem(list, 1, Py_BuildValue("(si)", "acvt_step",
+	    info.acvt_stats.step_ns));
+	PyList_SetItem(list, 2, Py_BuildValue("(sI)", "poll_events",
+	    info.poll.event_num));
+	PyList_SetItem(list, 3, Py_BuildValue("(sI)", "poll_sum",
+	    info.poll.sum));
+	PyList_SetItem(list, 4, Py_BuildValue("(sI)", "poll_max",
+	    info.poll.max));
+	PyList_SetItem(list, 5, Py_BuildValue("(si)", "dt_release_step",
+	    info.dt_release_stats.step_i));
 
 	return list;
 }
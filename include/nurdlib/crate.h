@@ -39,6 +39,16 @@ enum {
 	CRATE_READOUT_FAIL_UNEXPECTED_TRIGGER = (1 << 6)
 };
 
+/*
+ * Time-merged free-running data, every coincidence group is:
+ *  CRATE_MERGE_GROUP | hit_num, timestamp bits 0..31, bits 32..63,
+ * followed by every hit as:
+ *  CRATE_MERGE_HIT | module_id << 16 | word_num, hit words.
+ */
+#define CRATE_MERGE_GROUP 0x7e000000
+#define CRATE_MERGE_HIT 0x7d000000
+
+struct ConfigBlock;
 struct Crate;
 struct CrateCounter;
 struct CrateTag;
@@ -51,6 +61,14 @@ typedef void		(*CvtSetCallback)(struct Module *, unsigned);
 typedef uint32_t	(*ScalerGetCallback)(struct Module *, void *, struct
     Counter *) FUNC_RETURNS;
 typedef void            (*InitCallback)(struct Crate *);
+/*
+ * Returns non-zero if a trigger is pending, 0 to poll again after a short
+ * sleep. It may also block until the next trigger.
+ */
+typedef int		(*CrateTriggerCallback)(struct Crate *, void *);
+/* Gets the data and result of every event read by a crate thread. */
+typedef void		(*CrateEventCallback)(struct Crate *, struct
+    EventConstBuffer const *, uint32_t, void *);
 
 unsigned		crate_acvt_get_ns(struct Crate const *)
 	FUNC_NONNULL(()) FUNC_RETURNS;
@@ -61,6 +79,9 @@ void			crate_acvt_set(struct Crate *, struct Module *,
     CvtSetCallback) FUNC_NONNULL(());
 
 struct Crate		*crate_create(void) FUNC_RETURNS;
+/* Creates the crate for one of several CRATE blocks. */
+struct Crate		*crate_create_block(struct ConfigBlock *)
+	FUNC_NONNULL(()) FUNC_RETURNS;
 void			crate_set_init_callback(struct Crate *, InitCallback,
     InitCallback);
 void			crate_deinit(struct Crate *) FUNC_NONNULL(());
@@ -77,6 +98,23 @@ void			crate_dt_release_inhibit_once(struct Crate *)
 void			crate_dt_release_set_func(struct Crate *, void
     (*)(void *), void *) FUNC_NONNULL((1,2));
 
+/*
+ * Returns an aligned DMA destination chunk from the crate pool, valid until
+ * the next crate_readout, or NULL if there is no pool, it is exhausted, or
+ * the readout is not segmented. Hand the data to crate_event_buffer_place.
+ */
+void			*crate_blt_pool_get(struct Crate *, size_t)
+	FUNC_NONNULL(()) FUNC_RETURNS;
+
+/*
+ * Puts a module's data at ptr into the event-buffer and advances it. Data
+ * already inside the event-buffer, e.g. a DMA target behind alignment
+ * padding, or in a crate_blt_pool_get chunk, is referenced in place by
+ * crate_readout_sg and moved otherwise.
+ */
+uint32_t		crate_event_buffer_place(struct Crate *, struct
+    EventBuffer *, void const *, size_t) FUNC_NONNULL(()) FUNC_RETURNS;
+
 int			crate_free_running_get(struct Crate *)
 	FUNC_NONNULL(()) FUNC_RETURNS;
 void			crate_free_running_set(struct Crate *, int)
@@ -86,6 +124,9 @@ int			crate_get_do_shadow(struct Crate const *)
 	FUNC_NONNULL(()) FUNC_RETURNS;
 char const		*crate_get_name(struct Crate const *) FUNC_NONNULL(())
 	FUNC_RETURNS;
+/* Iterates created crates, NULL after the last one. */
+struct Crate		*crate_get_next(struct Crate const *) FUNC_NONNULL(())
+	FUNC_RETURNS;
 struct CrateTag		*crate_get_tag_by_name(struct Crate *, char const *)
 	FUNC_NONNULL((1)) FUNC_RETURNS;
 
@@ -115,6 +156,9 @@ struct GsiPex		*crate_gsi_pex_get(struct Crate const *)
 	FUNC_NONNULL(()) FUNC_RETURNS;
 
 void			crate_init(struct Crate *) FUNC_NONNULL(());
+/* Returns the number of threads the last slow-init was spread over. */
+size_t			crate_init_get_thread_num(struct Crate const *)
+	FUNC_NONNULL(()) FUNC_RETURNS;
 void			crate_memtest(struct Crate const *const, const int)
 	FUNC_NONNULL(());
 
@@ -136,6 +180,19 @@ uint32_t		crate_readout_dt(struct Crate *) FUNC_NONNULL(())
 /* Readout that may happen outside dead-time. */
 uint32_t		crate_readout(struct Crate *, struct EventBuffer *)
 	FUNC_NONNULL(()) FUNC_RETURNS;
+/*
+ * Same as crate_readout, but shadow data is not copied. The event is given
+ * as segments, which point into the event-buffer, shadow storage or pooled
+ * DMA chunks. The segments and their storage stay valid until
+ * crate_readout_sg_release or the next crate_readout_dt, a recovery needed
+ * in between is postponed until then. Not available with time_merge.
+ */
+uint32_t		crate_readout_sg(struct Crate *, struct EventBuffer *,
+    struct EventConstBuffer const **, size_t *) FUNC_NONNULL(())
+	FUNC_RETURNS;
+/* Gives the shadow storage of the last segmented event back. */
+void			crate_readout_sg_release(struct Crate *)
+	FUNC_NONNULL(());
 /* Modules read out, do some final touches before the next event. */
 void			crate_readout_finalize(struct Crate *)
 	FUNC_NONNULL(());
@@ -145,6 +202,15 @@ void			crate_scaler_add(struct Crate *, char const *, struct
 
 void			crate_setup(void);
 
+/*
+ * Multi-crate mode, every crate polls the trigger callback and reads events
+ * into its own buffer in its own thread, and recovers on its own.
+ */
+void			crate_thread_start(struct Crate *, size_t,
+    CrateTriggerCallback, CrateEventCallback, void *) FUNC_NONNULL((1, 3,
+    4));
+void			crate_thread_stop(struct Crate *) FUNC_NONNULL(());
+
 /* Sync channels. */
 int			crate_sync_get(struct Crate *, unsigned, int *)
 	FUNC_NONNULL(()) FUNC_RETURNS;
@@ -54,6 +54,14 @@ LOG_LEVEL_DECLARE_(debug);
 /* For when you like to hold on tight, be prepared to abort. */
 LOG_LEVEL_DECLARE_(spam);
 
+/*
+ * Queues formatted messages for a background thread which calls the
+ * callback, so the caller never waits on I/O. Messages are dropped when the
+ * queue is full, fatal paths flush before aborting.
+ */
+unsigned		log_async_get_drop_num(void) FUNC_RETURNS;
+void			log_async_start(void);
+void			log_async_stop(void);
 /* Default callback writes to stdout/stderr, override here! */
 void			log_callback_set(LogCallback);
 /* Print message and immediately calls abort. */
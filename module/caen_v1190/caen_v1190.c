@@ -31,6 +31,7 @@
 
 MODULE_PROTOTYPES(caen_v1190);
 
+static int	caen_v1190_clear(struct Crate *, struct Module *) FUNC_RETURNS;
 static int	caen_v1190_register_list_pack(struct Module *, struct
     PackerList *);
 
@@ -43,6 +44,17 @@ caen_v1190_check_empty(struct Module *a_module)
 	return caen_v1n90_check_empty(&v1190->v1n90);
 }
 
+int
+caen_v1190_clear(struct Crate *a_crate, struct Module *a_module)
+{
+	struct CaenV1190Module *v1190;
+
+	(void)a_crate;
+	MODULE_CAST(KW_CAEN_V1190, v1190, a_module);
+	caen_v1n90_clear(&v1190->v1n90);
+	return 1;
+}
+
 struct Module *
 caen_v1190_create_(struct Crate *a_crate, struct ConfigBlock *a_block)
 {
@@ -162,5 +174,6 @@ void
 caen_v1190_setup_(void)
 {
 	MODULE_SETUP(caen_v1190, 0);
+	MODULE_CALLBACK_BIND(caen_v1190, clear);
 	MODULE_CALLBACK_BIND(caen_v1190, register_list_pack);
 }
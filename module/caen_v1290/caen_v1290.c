@@ -30,6 +30,7 @@
 
 MODULE_PROTOTYPES(caen_v1290);
 
+static int	caen_v1290_clear(struct Crate *, struct Module *) FUNC_RETURNS;
 static int	caen_v1290_register_list_pack(struct Module *, struct
     PackerList *);
 
@@ -42,6 +43,17 @@ caen_v1290_check_empty(struct Module *a_module)
 	return caen_v1n90_check_empty(&v1290->v1n90);
 }
 
+int
+caen_v1290_clear(struct Crate *a_crate, struct Module *a_module)
+{
+	struct CaenV1290Module *v1290;
+
+	(void)a_crate;
+	MODULE_CAST(KW_CAEN_V1290, v1290, a_module);
+	caen_v1n90_clear(&v1290->v1n90);
+	return 1;
+}
+
 struct Module *
 caen_v1290_create_(struct Crate *a_crate, struct ConfigBlock *a_block)
 {
@@ -161,5 +173,6 @@ void
 caen_v1290_setup_(void)
 {
 	MODULE_SETUP(caen_v1290, 0);
+	MODULE_CALLBACK_BIND(caen_v1290, clear);
 	MODULE_CALLBACK_BIND(caen_v1290, register_list_pack);
 }
@@ -187,7 +187,7 @@ caen_v1725_get_signature(struct ModuleSignature const **a_array, size_t
 	size_t i;\
 	PREPARE_TIME_CONFIG(u32, cfg, n, clk_mul, top_bit);\
 	for (i = 0; i < LENGTH(u32); ++i) {\
-		MAP_WRITE(v1725->sicy_map, reg(i), u32[i]);\
+		MAP_BATCH_WRITE(batch, v1725->sicy_map, reg(i), u32[i]);\
 	}\
 } while (0);
 
@@ -212,7 +212,7 @@ caen_v1725_get_signature(struct ModuleSignature const **a_array, size_t
 	size_t i;\
 	PREPARE_MV_CONFIG(u32, cfg, n, top_bit);\
 	for (i = 0; i < LENGTH(u32); ++i) {\
-		MAP_WRITE(v1725->sicy_map, reg(i), u32[i]);\
+		MAP_BATCH_WRITE(batch, v1725->sicy_map, reg(i), u32[i]);\
 	}\
 } while (0);
 
@@ -226,7 +226,7 @@ caen_v1725_get_signature(struct ModuleSignature const **a_array, size_t
 	size_t i;\
 	PREPARE_CONFIG(u32, cfg, top_bit);\
 	for (i = 0; i < LENGTH(u32); ++i) {\
-		MAP_WRITE(v1725->sicy_map, reg(i), u32[i]);\
+		MAP_BATCH_WRITE(batch, v1725->sicy_map, reg(i), u32[i]);\
 	}\
 } while (0);
 
@@ -242,7 +242,7 @@ caen_v1725_get_signature(struct ModuleSignature const **a_array, size_t
 	for (i = 0; i < LENGTH(i32); ++i) {\
 		if (i32[i] < 0)\
 			i32[i] = 0xffff; /* Value when disabled. */\
-		MAP_WRITE(v1725->sicy_map, reg(i), i32[i]);\
+		MAP_BATCH_WRITE(batch, v1725->sicy_map, reg(i), i32[i]);\
 	}\
 } while (0);
 
@@ -262,7 +262,7 @@ caen_v1725_get_signature(struct ModuleSignature const **a_array, size_t
 	size_t i;\
 	PREPARE_FRAC_CONFIG(u32, cfg, n, top_bit);\
 	for (i = 0; i < LENGTH(u32); ++i) {\
-		MAP_WRITE(v1725->sicy_map, reg(i), u32[i]);\
+		MAP_BATCH_WRITE(batch, v1725->sicy_map, reg(i), u32[i]);\
 	}\
 } while (0);
 
@@ -291,11 +291,14 @@ int
 caen_v1725_init_fast(struct Crate *a_crate, struct Module *a_module)
 {
 	struct CaenV1725Module *v1725;
+	struct MapBatch *batch;
 	uint32_t dyn_range_setting[16];
 
 	(void)a_crate;
 	LOGF(info)(LOGL, NAME" init_fast {");
 	MODULE_CAST(KW_CAEN_V1725, v1725, a_module);
+	/* Tens of per-channel registers, one round trip where possible. */
+	batch = map_sicy_batch_create();
 
 	{
 		double range[16];
@@ -311,8 +314,8 @@ caen_v1725_init_fast(struct Crate *a_crate, struct Module *a_module)
 			dyn_range_setting[i] = u32;
 			LOGF(verbose)(LOGL, " [%"PRIz"]=%fV (0x%08x).",
 			    i, u32 ? 0.5 : 2.0, u32);
-			MAP_WRITE(v1725->sicy_map, input_dynamic_range(i),
-			    u32);
+			MAP_BATCH_WRITE(batch, v1725->sicy_map,
+			    input_dynamic_range(i), u32);
 		}
 	}
 	APPLY_TIME_CONFIG(record_length, KW_SAMPLE_LENGTH, 8, 8, 13);
@@ -356,7 +359,8 @@ caen_v1725_init_fast(struct Crate *a_crate, struct Module *a_module)
 			  cfd_delay_u32[i] |
 			  (fraction_25 - 1) << 8 |
 			  (cfd_width[i] - 1) << 10;
-			MAP_WRITE(v1725->sicy_map, cfd_settings(i), u32);
+			MAP_BATCH_WRITE(batch, v1725->sicy_map,
+			    cfd_settings(i), u32);
 		}
 
 
@@ -378,8 +382,8 @@ caen_v1725_init_fast(struct Crate *a_crate, struct Module *a_module)
 			LOGF(verbose)(LOGL, " [%"PRIz"]=%uns (0x%08x).",
 			    i, u32 * v1725->period_ns, u32);
 #if 0 /* No longer in register list. */
-			MAP_WRITE(v1725->sicy_map, channel_n_pulse_width(i),
-			    u32);
+			MAP_BATCH_WRITE(batch, v1725->sicy_map,
+			    channel_n_pulse_width(i), u32);
 #endif
 		}
 #endif
@@ -388,6 +392,7 @@ caen_v1725_init_fast(struct Crate *a_crate, struct Module *a_module)
 		uint32_t thr[16];
 
 		PREPARE_MV_CONFIG(thr, KW_THRESHOLD, 16, 13);
+		map_sicy_batch_submit(batch);
 		SET_THRESHOLDS(v1725, thr);
 	}
 #if 0  /* Changed implementation in cfg/default/caen_v1725.cfg ? */
@@ -404,7 +409,7 @@ caen_v1725_init_fast(struct Crate *a_crate, struct Module *a_module)
 			u32 = logic[i];
 			LOGF(verbose)(LOGL, " [%"PRIz"]=0x%08x.", i, u32);
 #if 0 /* No longer in register list. */
-			MAP_WRITE(v1725->sicy_map,
+			MAP_BATCH_WRITE(batch, v1725->sicy_map,
 			    couple_n_self_trigger_logic(i), u32);
 #endif
 		}
@@ -425,8 +430,10 @@ caen_v1725_init_fast(struct Crate *a_crate, struct Module *a_module)
 
 			u32 = offset[i];
 			LOGF(verbose)(LOGL, " [%"PRIz"]=0x%08x.", i, u32);
-			MAP_WRITE(v1725->sicy_map, dc_offset(i), u32);
+			MAP_BATCH_WRITE(batch, v1725->sicy_map,
+			    dc_offset(i), u32);
 		}
+		map_sicy_batch_submit(batch);
 		time_sleep(init_sleep);
 	}
 	{
@@ -447,7 +454,8 @@ caen_v1725_init_fast(struct Crate *a_crate, struct Module *a_module)
 			acq |= ACQ_EXTERNAL_CLOCK;
 		}
 		LOGF(verbose)(LOGL, "Acquisition control=0x%08x.", acq);
-		MAP_WRITE(v1725->sicy_map, acquisition_control, acq);
+		MAP_BATCH_WRITE(batch, v1725->sicy_map, acquisition_control,
+		    acq);
 	}
 
 	{
@@ -484,7 +492,8 @@ caen_v1725_init_fast(struct Crate *a_crate, struct Module *a_module)
 		    (level - 1) << 24 |
 		    in;
 		LOGF(verbose)(LOGL, "Global trigger mask=0x%08x.", u32);
-		MAP_WRITE(v1725->sicy_map, global_trigger_mask, u32);
+		MAP_BATCH_WRITE(batch, v1725->sicy_map, global_trigger_mask,
+		    u32);
 	}
 	{
 		/* TODO: front_panel_trg_out_gpo_enable_mask. */
@@ -510,14 +519,15 @@ caen_v1725_init_fast(struct Crate *a_crate, struct Module *a_module)
 		    lvds[3] << 5 |
 		    0;
 		LOGF(verbose)(LOGL, "Front panel IO control=0x%08x.", u32);
-		MAP_WRITE(v1725->sicy_map, front_panel_i_o_control, u32);
+		MAP_BATCH_WRITE(batch, v1725->sicy_map,
+		    front_panel_i_o_control, u32);
 	}
 	{
 		v1725->channel_enable = config_get_bitmask(
 		    v1725->module.config, KW_CHANNEL_ENABLE, 0, 15);
 		LOGF(verbose)(LOGL, "Channel mask=0x%08x.",
 		    v1725->channel_enable);
-		MAP_WRITE(v1725->sicy_map, channel_enable_mask,
+		MAP_BATCH_WRITE(batch, v1725->sicy_map, channel_enable_mask,
 		    v1725->channel_enable);
 	}
 	/* DPP Algorithm Control */
@@ -681,8 +691,8 @@ caen_v1725_init_fast(struct Crate *a_crate, struct Module *a_module)
 
 			LOGF(verbose)(LOGL, "DPP algo ctrl[%"PRIz"]=0x%08x.",
 			    i, u32);
-			MAP_WRITE(v1725->sicy_map, dpp_algorithm_control(i),
-			    u32);
+			MAP_BATCH_WRITE(batch, v1725->sicy_map,
+			    dpp_algorithm_control(i), u32);
 		}
 	}
 	/* DPP Algorithm Control 2 */
@@ -851,8 +861,8 @@ caen_v1725_init_fast(struct Crate *a_crate, struct Module *a_module)
 
 			LOGF(verbose)(LOGL, "DPP algo ctrl2[%"PRIz"]=0x%08x.",
 			    i, u32);
-			MAP_WRITE(v1725->sicy_map, dpp_algorithm_control_2(i),
-			    u32);
+			MAP_BATCH_WRITE(batch, v1725->sicy_map,
+			    dpp_algorithm_control_2(i), u32);
 		}
 	}
 	/* Veto width. */
@@ -910,13 +920,16 @@ caen_v1725_init_fast(struct Crate *a_crate, struct Module *a_module)
 
 			LOGF(verbose)(LOGL, "Veto width[%"PRIz"]=0x%08x.",
 			    i, u32);
-			MAP_WRITE(v1725->sicy_map, veto_width(i),
+			MAP_BATCH_WRITE(batch, v1725->sicy_map, veto_width(i),
 			    u32);
 		}
 	}
 
 	/* Enable acquisition. */
-	MAP_WRITE(v1725->sicy_map, acquisition_control, ACQ_START);
+	MAP_BATCH_WRITE(batch, v1725->sicy_map, acquisition_control,
+	    ACQ_START);
+	map_sicy_batch_submit(batch);
+	map_sicy_batch_free(&batch);
 
 	LOGF(info)(LOGL, NAME" init_fast }");
 	return 1;
@@ -71,6 +71,22 @@ caen_v1n90_check_empty(struct CaenV1n90Module *a_v1n90)
 	return result;
 }
 
+void
+caen_v1n90_clear(struct CaenV1n90Module *a_v1n90)
+{
+	LOGF(verbose)(LOGL, NAME" clear {");
+	/* Clears buffers and event counter, and resets the TDC:s. */
+	MAP_WRITE(a_v1n90->sicy_map, software_clear, 0);
+	SERIALIZE_IO;
+	a_v1n90->module.event_counter.value = MAP_READ(a_v1n90->sicy_map,
+	    event_counter);
+	a_v1n90->header_counter = 0;
+	a_v1n90->was_full = 0;
+	a_v1n90->parse.expect = EXPECT_DMA_HEADER;
+	LOGF(verbose)(LOGL, NAME" clear(ctr=0x%08x) }",
+	    a_v1n90->module.event_counter.value);
+}
+
 void
 caen_v1n90_create(struct ConfigBlock const *a_block, struct CaenV1n90Module
     *a_v1n90)
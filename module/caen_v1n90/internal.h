@@ -63,6 +63,7 @@ struct CaenV1n90Module {
 };
 
 uint32_t	caen_v1n90_check_empty(struct CaenV1n90Module *) FUNC_RETURNS;
+void		caen_v1n90_clear(struct CaenV1n90Module *);
 void		caen_v1n90_create(struct ConfigBlock const *, struct
     CaenV1n90Module *);
 void		caen_v1n90_deinit(struct CaenV1n90Module *);
@@ -39,8 +39,11 @@
     BS2_COMMON_STOP)
 
 MODULE_PROTOTYPES(caen_v775);
+static int	caen_v775_clear(struct Crate *, struct Module *) FUNC_RETURNS;
 static uint32_t	caen_v775_readout_shadow(struct Crate *, struct Module *,
     struct EventBuffer *) FUNC_RETURNS;
+static uint32_t	caen_v775_readout_submit(struct Crate *, struct Module *,
+    struct EventBuffer *) FUNC_RETURNS;
 static void	caen_v775_zero_suppress(struct Module *, int);
 #if NCONF_mMAP_bCMVLC
 static void	caen_v775_cmvlc_init(struct Module *,
@@ -60,6 +63,17 @@ caen_v775_check_empty(struct Module *a_module)
 	return caen_v7nn_check_empty(&v775->v7nn);
 }
 
+int
+caen_v775_clear(struct Crate *a_crate, struct Module *a_module)
+{
+	struct CaenV775Module *v775;
+
+	(void)a_crate;
+	MODULE_CAST(KW_CAEN_V775, v775, a_module);
+	caen_v7nn_clear(&v775->v7nn);
+	return 1;
+}
+
 struct Module *
 caen_v775_create_(struct Crate *a_crate, struct ConfigBlock *a_block)
 {
@@ -218,6 +232,16 @@ caen_v775_readout_shadow(struct Crate *a_crate, struct Module *a_module,
 	return caen_v7nn_readout_shadow(&v775->v7nn, a_event_buffer);
 }
 
+uint32_t
+caen_v775_readout_submit(struct Crate *a_crate, struct Module *a_module,
+    struct EventBuffer *a_event_buffer)
+{
+	struct CaenV775Module *v775;
+
+	MODULE_CAST(KW_CAEN_V775, v775, a_module);
+	return caen_v7nn_readout_submit(a_crate, &v775->v7nn, a_event_buffer);
+}
+
 #if NCONF_mMAP_bCMVLC
 void
 caen_v775_cmvlc_init(struct Module *a_module,
@@ -257,6 +281,8 @@ void
 caen_v775_setup_(void)
 {
 	MODULE_SETUP(caen_v775, 0);
+	MODULE_CALLBACK_BIND(caen_v775, clear);
+	MODULE_CALLBACK_BIND(caen_v775, readout_submit);
 	MODULE_CALLBACK_BIND(caen_v775, readout_shadow);
 	MODULE_CALLBACK_BIND(caen_v775, zero_suppress);
 #if NCONF_mMAP_bCMVLC
@@ -28,6 +28,9 @@
 #define NAME "Caen v785"
 
 MODULE_PROTOTYPES(caen_v785);
+static int	caen_v785_clear(struct Crate *, struct Module *) FUNC_RETURNS;
+static uint32_t	caen_v785_readout_submit(struct Crate *, struct Module *,
+    struct EventBuffer *) FUNC_RETURNS;
 static void	caen_v785_use_pedestals(struct Module *);
 static void	caen_v785_zero_suppress(struct Module *, int);
 #if NCONF_mMAP_bCMVLC
@@ -48,6 +51,17 @@ caen_v785_check_empty(struct Module *a_module)
 	return caen_v7nn_check_empty(&v785->v7nn);
 }
 
+int
+caen_v785_clear(struct Crate *a_crate, struct Module *a_module)
+{
+	struct CaenV785Module *v785;
+
+	(void)a_crate;
+	MODULE_CAST(KW_CAEN_V785, v785, a_module);
+	caen_v7nn_clear(&v785->v7nn);
+	return 1;
+}
+
 struct Module *
 caen_v785_create_(struct Crate *a_crate, struct ConfigBlock *a_block)
 {
@@ -157,6 +171,16 @@ caen_v785_readout_dt(struct Crate *a_crate, struct Module *a_module)
 	return 0;
 }
 
+uint32_t
+caen_v785_readout_submit(struct Crate *a_crate, struct Module *a_module,
+    struct EventBuffer *a_event_buffer)
+{
+	struct CaenV785Module *v785;
+
+	MODULE_CAST(KW_CAEN_V785, v785, a_module);
+	return caen_v7nn_readout_submit(a_crate, &v785->v7nn, a_event_buffer);
+}
+
 #if NCONF_mMAP_bCMVLC
 void
 caen_v785_cmvlc_init(struct Module *a_module,
@@ -196,6 +220,8 @@ void
 caen_v785_setup_(void)
 {
 	MODULE_SETUP(caen_v785, 0);
+	MODULE_CALLBACK_BIND(caen_v785, clear);
+	MODULE_CALLBACK_BIND(caen_v785, readout_submit);
 	MODULE_CALLBACK_BIND(caen_v785, use_pedestals);
 	MODULE_CALLBACK_BIND(caen_v785, zero_suppress);
 #if NCONF_mMAP_bCMVLC
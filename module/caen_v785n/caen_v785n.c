@@ -26,6 +26,9 @@
 #define NAME "Caen v785n"
 
 MODULE_PROTOTYPES(caen_v785n);
+static int	caen_v785n_clear(struct Crate *, struct Module *) FUNC_RETURNS;
+static uint32_t	caen_v785n_readout_submit(struct Crate *, struct Module *,
+    struct EventBuffer *) FUNC_RETURNS;
 static void	caen_v785n_use_pedestals(struct Module *);
 static void	caen_v785n_zero_suppress(struct Module *, int);
 
@@ -38,6 +41,17 @@ caen_v785n_check_empty(struct Module *a_module)
 	return caen_v7nn_check_empty(&v785n->v7nn);
 }
 
+int
+caen_v785n_clear(struct Crate *a_crate, struct Module *a_module)
+{
+	struct CaenV785NModule *v785n;
+
+	(void)a_crate;
+	MODULE_CAST(KW_CAEN_V785N, v785n, a_module);
+	caen_v7nn_clear(&v785n->v7nn);
+	return 1;
+}
+
 struct Module *
 caen_v785n_create_(struct Crate *a_crate, struct ConfigBlock *a_block)
 {
@@ -147,10 +161,22 @@ caen_v785n_readout_dt(struct Crate *a_crate, struct Module *a_module)
 	return 0;
 }
 
+uint32_t
+caen_v785n_readout_submit(struct Crate *a_crate, struct Module *a_module,
+    struct EventBuffer *a_event_buffer)
+{
+	struct CaenV785NModule *v785n;
+
+	MODULE_CAST(KW_CAEN_V785N, v785n, a_module);
+	return caen_v7nn_readout_submit(a_crate, &v785n->v7nn, a_event_buffer);
+}
+
 void
 caen_v785n_setup_(void)
 {
 	MODULE_SETUP(caen_v785n, 0);
+	MODULE_CALLBACK_BIND(caen_v785n, clear);
+	MODULE_CALLBACK_BIND(caen_v785n, readout_submit);
 	MODULE_CALLBACK_BIND(caen_v785n, use_pedestals);
 	MODULE_CALLBACK_BIND(caen_v785n, zero_suppress);
 }
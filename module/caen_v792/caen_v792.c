@@ -36,6 +36,9 @@ struct IPED {
 };
 
 MODULE_PROTOTYPES(caen_v792);
+static int	caen_v792_clear(struct Crate *, struct Module *) FUNC_RETURNS;
+static uint32_t	caen_v792_readout_submit(struct Crate *, struct Module *,
+    struct EventBuffer *) FUNC_RETURNS;
 static void	caen_v792_use_pedestals(struct Module *);
 static void	caen_v792_zero_suppress(struct Module *, int);
 #if NCONF_mMAP_bCMVLC
@@ -78,6 +81,17 @@ caen_v792_check_empty(struct Module *a_module)
 	return caen_v7nn_check_empty(&v792->v7nn);
 }
 
+int
+caen_v792_clear(struct Crate *a_crate, struct Module *a_module)
+{
+	struct CaenV792Module *v792;
+
+	(void)a_crate;
+	MODULE_CAST(KW_CAEN_V792, v792, a_module);
+	caen_v7nn_clear(&v792->v7nn);
+	return 1;
+}
+
 struct Module *
 caen_v792_create_(struct Crate *a_crate, struct ConfigBlock *a_block)
 {
@@ -227,6 +241,16 @@ caen_v792_readout_dt(struct Crate *a_crate, struct Module *a_module)
 	return 0;
 }
 
+uint32_t
+caen_v792_readout_submit(struct Crate *a_crate, struct Module *a_module,
+    struct EventBuffer *a_event_buffer)
+{
+	struct CaenV792Module *v792;
+
+	MODULE_CAST(KW_CAEN_V792, v792, a_module);
+	return caen_v7nn_readout_submit(a_crate, &v792->v7nn, a_event_buffer);
+}
+
 #if NCONF_mMAP_bCMVLC
 void
 caen_v792_cmvlc_init(struct Module *a_module,
@@ -266,6 +290,8 @@ void
 caen_v792_setup_(void)
 {
 	MODULE_SETUP(caen_v792, 0);
+	MODULE_CALLBACK_BIND(caen_v792, clear);
+	MODULE_CALLBACK_BIND(caen_v792, readout_submit);
 	MODULE_CALLBACK_BIND(caen_v792, use_pedestals);
 	MODULE_CALLBACK_BIND(caen_v792, zero_suppress);
 #if NCONF_mMAP_bCMVLC
@@ -35,6 +35,7 @@
 #include <util/assert.h>
 #include <util/bits.h>
 #include <util/fmtmod.h>
+#include <util/simd.h>
 #include <util/string.h>
 #include <util/time.h>
 #include <module/map/map_cmvlc.h>
@@ -72,6 +73,8 @@
 #define COUNTER_MASK BITS_MASK_TOP(23)
 #define COUNTER_VALUE(c) (COUNTER_MASK & (c))
 
+static uint32_t	blt_prepare(struct Crate *, struct CaenV7nnModule *, struct
+    EventBuffer const *, uint32_t **, uintptr_t *) FUNC_RETURNS;
 static uint32_t	event_counter_get(struct CaenV7nnModule const *) FUNC_RETURNS;
 static void	threshold_set(struct CaenV7nnModule *, uint16_t const *,
     size_t);
@@ -89,6 +92,21 @@ caen_v7nn_check_empty(struct CaenV7nnModule *a_v7nn)
 	return result;
 }
 
+void
+caen_v7nn_clear(struct CaenV7nnModule *a_v7nn)
+{
+	LOGF(verbose)(LOGL, NAME" clear {");
+	MAP_WRITE(a_v7nn->sicy_map, bit_set_2, BS2_CLEAR_DATA);
+	MAP_WRITE(a_v7nn->sicy_map, bit_clear_2, BS2_CLEAR_DATA);
+	MAP_WRITE(a_v7nn->sicy_map, event_counter_reset, 0);
+	SERIALIZE_IO;
+	a_v7nn->counter_parse =
+	    a_v7nn->module.event_counter.value =
+	    event_counter_get(a_v7nn);
+	LOGF(verbose)(LOGL, NAME" clear(ctr=0x%08x) }",
+	    a_v7nn->module.event_counter.value);
+}
+
 void
 caen_v7nn_create(struct ConfigBlock *a_block, struct CaenV7nnModule *a_v7nn,
     enum Keyword a_child_type)
@@ -125,6 +143,8 @@ void
 caen_v7nn_deinit(struct CaenV7nnModule *a_v7nn)
 {
 	LOGF(info)(LOGL, NAME" deinit {");
+	map_blt_async_free(&a_v7nn->blt_async.handle);
+	a_v7nn->blt_async.is_submitted = 0;
 	map_unmap(&a_v7nn->sicy_map);
 	map_unmap(&a_v7nn->dma_map);
 	LOGF(info)(LOGL, NAME" deinit }");
@@ -331,9 +351,7 @@ caen_v7nn_parse_data(struct CaenV7nnModule *a_v7nn, struct EventConstBuffer
 	eob_fixed = a_v7nn->geo << 27 | 0x04000000;
 	p32 = a_event_buffer->ptr;
 	end = p32 + a_event_buffer->bytes / 4;
-	while (end != p32 && DMA_FILLER == *p32) {
-		++p32;
-	}
+	p32 = simd_skip32(p32, end, DMA_FILLER);
 	ms = a_v7nn->module.crate_counter->value;
 	for (;;) {
 		uint32_t u32, counter;
@@ -457,7 +475,7 @@ caen_v7nn_readout(struct Crate *a_crate, struct CaenV7nnModule *a_v7nn, struct
 
 	/* Move data from module. */
 	if (KW_NOBLT == a_v7nn->blt_mode) {
-		double t_0;
+		uint64_t t_0;
 		unsigned data_counter, event, header_count;
 		int expect_header, no_data_wait;
 
@@ -472,9 +490,9 @@ caen_v7nn_readout(struct Crate *a_crate, struct CaenV7nnModule *a_v7nn, struct
 		header_count = 0;
 		expect_header = 1;
 		no_data_wait = 0;
-		t_0 = -1.0;
+		t_0 = 0;
 		for (;;) {
-			double t;
+			uint64_t t;
 
 			u32 = MAP_READ(a_v7nn->sicy_map, output_buffer);
 			if (0x06000000 == (0x07000000 & u32)) {
@@ -561,10 +579,10 @@ caen_v7nn_readout(struct Crate *a_crate, struct CaenV7nnModule *a_v7nn, struct
 			}
 			continue;
 caen_v7nn_readout_poll:
-			t = time_getd();
-			if (0 > t_0) {
+			t = time_getns();
+			if (0 == t_0) {
 				t_0 = t;
-			} else if (NO_DATA_TIMEOUT < t - t_0) {
+			} else if (1e9 * NO_DATA_TIMEOUT < t - t_0) {
 				log_error(LOGL, "Data timeout (%gs).",
 				    NO_DATA_TIMEOUT);
 				result |= CRATE_READOUT_FAIL_DATA_MISSING;
@@ -585,50 +603,23 @@ caen_v7nn_readout_poll:
 		bad_blt_return = 1;
 #endif
 
-		/* TODO: Parse BLT:ed data for ACVT. */
-		if (crate_acvt_has(a_crate)) {
-			log_die(LOGL, "ACVT for CAEN modules currently "
-			    "unsupported.");
-		}
-		/*
-		 * Max words per event should be number of channels + header
-		 * and footer.
-		 */
-		bytes = event_diff * (a_v7nn->number_of_channels + 2) *
-		    sizeof(uint32_t);
-		outp = map_align(outp, &bytes, a_v7nn->blt_mode, DMA_FILLER);
-		if (!MEMORY_CHECK(*a_event_buffer, &outp[bytes / sizeof *outp
-		    - 1])) {
-			log_error(LOGL, "Max event size too big for "
-			    "output.");
-			result |= CRATE_READOUT_FAIL_DATA_TOO_MUCH;
-			goto caen_v7nn_readout_done;
-		}
-		if (a_v7nn->do_berr) {
-			/* Only reset buffer if BLT cannot be trusted */
-#if MAP_BLT_RETURN_BROKEN
-			unsigned words;
-			uint32_t *p32;
-			/* +1 to place marker word at buffer end */
-			words = bytes / sizeof(uint32_t) + 1;
-			for (p32 = outp; 0 != words; --words) {
-				*p32++ = 0x06000000;
-			}
-#endif
-			ret = map_blt_read_berr(a_v7nn->dma_map, 0, outp,
-			    bytes);
+		if (a_v7nn->blt_async.is_submitted) {
+			a_v7nn->blt_async.is_submitted = 0;
+			outp = a_v7nn->blt_async.outp;
+			ret = map_blt_async_wait(a_v7nn->blt_async.handle);
 		} else {
-			uint32_t *p32;
-			unsigned words;
-
-			/* Reset full buffer, blt can finish anywhere. */
-			words = bytes / sizeof(uint32_t) + 1;
-			for (p32 = outp; 0 != words; --words) {
-				*p32++ = 0x06000000;
+			result |= blt_prepare(a_crate, a_v7nn, a_event_buffer,
+			    &outp, &bytes);
+			if (0 != result) {
+				goto caen_v7nn_readout_done;
+			}
+			if (a_v7nn->do_berr) {
+				ret = map_blt_read_berr(a_v7nn->dma_map, 0,
+				    outp, bytes);
+			} else {
+				ret = map_blt_read(a_v7nn->dma_map, 0, outp,
+				    bytes);
 			}
-			/* Ask for one word more which will be no-valid. */
-			ret = map_blt_read(a_v7nn->dma_map, 0, outp,
-					     bytes + sizeof(uint32_t));
 		}
 		if (-1 == ret || 0 > ret) {
 			result |= CRATE_READOUT_FAIL_ERROR_DRIVER;
@@ -668,7 +659,14 @@ caen_v7nn_readout_poll:
 	}
 
 caen_v7nn_readout_done:
-	EVENT_BUFFER_ADVANCE(*a_event_buffer, outp);
+	if (NULL != a_v7nn->blt_pool_ptr) {
+		result |= crate_event_buffer_place(a_crate, a_event_buffer,
+		    a_v7nn->blt_pool_ptr, (uintptr_t)outp -
+		    (uintptr_t)a_v7nn->blt_pool_ptr);
+		a_v7nn->blt_pool_ptr = NULL;
+	} else {
+		EVENT_BUFFER_ADVANCE(*a_event_buffer, outp);
+	}
 	LOGF(spam)(LOGL, NAME" readout }");
 	return result;
 }
@@ -682,6 +680,34 @@ caen_v7nn_readout_dt(struct CaenV7nnModule *a_v7nn)
 	    a_v7nn->module.event_counter.value);
 }
 
+uint32_t
+caen_v7nn_readout_submit(struct Crate *a_crate, struct CaenV7nnModule
+    *a_v7nn, struct EventBuffer *a_event_buffer)
+{
+	uintptr_t bytes;
+	uint32_t result;
+
+	LOGF(spam)(LOGL, NAME" readout_submit {");
+	result = 0;
+	if (KW_NOBLT == a_v7nn->blt_mode) {
+		goto caen_v7nn_readout_submit_done;
+	}
+	result = blt_prepare(a_crate, a_v7nn, a_event_buffer,
+	    &a_v7nn->blt_async.outp, &bytes);
+	if (0 != result) {
+		goto caen_v7nn_readout_submit_done;
+	}
+	if (NULL == a_v7nn->blt_async.handle) {
+		a_v7nn->blt_async.handle = map_blt_async_create();
+	}
+	map_blt_async_submit(a_v7nn->blt_async.handle, a_v7nn->dma_map, 0,
+	    a_v7nn->blt_async.outp, bytes, a_v7nn->do_berr);
+	a_v7nn->blt_async.is_submitted = 1;
+caen_v7nn_readout_submit_done:
+	LOGF(spam)(LOGL, NAME" readout_submit(0x%08x) }", result);
+	return result;
+}
+
 uint32_t
 caen_v7nn_readout_shadow(struct CaenV7nnModule *a_v7nn, struct EventBuffer
     *a_event_buffer)
@@ -886,6 +912,64 @@ caen_v7nn_zero_suppress(struct CaenV7nnModule *a_v7nn, int a_yes)
 	LOGF(spam)(LOGL, NAME" zero_suppress }");
 }
 
+/*
+ * Sizes and pre-fills the BLT destination, gives the pointer and the number
+ * of bytes to transfer.
+ */
+uint32_t
+blt_prepare(struct Crate *a_crate, struct CaenV7nnModule *a_v7nn, struct
+    EventBuffer const *a_event_buffer, uint32_t **a_outp, uintptr_t *a_bytes)
+{
+	uint32_t *outp;
+	uintptr_t bytes;
+	unsigned event_diff;
+
+	/* TODO: Parse BLT:ed data for ACVT. */
+	if (crate_acvt_has(a_crate)) {
+		log_die(LOGL, "ACVT for CAEN modules currently "
+		    "unsupported.");
+	}
+	event_diff = COUNTER_DIFF_RAW(*a_v7nn->module.crate_counter,
+	     a_v7nn->module.crate_counter_prev);
+	/*
+	 * Max words per event should be number of channels + header
+	 * and footer.
+	 */
+	bytes = event_diff * (a_v7nn->number_of_channels + 2) *
+	    sizeof(uint32_t);
+	/* Pooled chunks are aligned, leave room for rounding and marker. */
+	a_v7nn->blt_pool_ptr = crate_blt_pool_get(a_crate, bytes + 32);
+	if (NULL != a_v7nn->blt_pool_ptr) {
+		outp = map_align(a_v7nn->blt_pool_ptr, &bytes,
+		    a_v7nn->blt_mode, DMA_FILLER);
+	} else {
+		outp = map_align(a_event_buffer->ptr, &bytes,
+		    a_v7nn->blt_mode, DMA_FILLER);
+		if (!MEMORY_CHECK(*a_event_buffer,
+		    &outp[bytes / sizeof *outp - 1]))
+		{
+			log_error(LOGL, "Max event size too big for "
+			    "output.");
+			return CRATE_READOUT_FAIL_DATA_TOO_MUCH;
+		}
+	}
+	if (a_v7nn->do_berr) {
+		/* Only reset buffer if BLT cannot be trusted */
+#if MAP_BLT_RETURN_BROKEN
+		/* +1 to place marker word at buffer end */
+		simd_fill32(outp, 0x06000000, bytes / sizeof(uint32_t) + 1);
+#endif
+	} else {
+		/* Reset full buffer, blt can finish anywhere. */
+		simd_fill32(outp, 0x06000000, bytes / sizeof(uint32_t) + 1);
+		/* Ask for one word more which will be no-valid. */
+		bytes += sizeof(uint32_t);
+	}
+	*a_outp = outp;
+	*a_bytes = bytes;
+	return 0;
+}
+
 uint32_t
 event_counter_get(struct CaenV7nnModule const *a_v7nn)
 {
@@ -37,6 +37,13 @@ struct CaenV7nnModule {
 	uint32_t        channel_enable;
 	struct	Map *sicy_map;
 	struct	Map *dma_map;
+	struct {
+		struct	MapBltAsync *handle;
+		int	is_submitted;
+		uint32_t	*outp;
+	} blt_async;
+	/* Start of the crate_blt_pool_get chunk, NULL if in the eb. */
+	uint32_t	*blt_pool_ptr;
 	enum	Keyword child_type;
 	int	geo;
 	uint16_t	number_of_channels;
@@ -45,6 +52,7 @@ struct CaenV7nnModule {
 };
 
 uint32_t	caen_v7nn_check_empty(struct CaenV7nnModule *) FUNC_RETURNS;
+void		caen_v7nn_clear(struct CaenV7nnModule *);
 void		caen_v7nn_create(struct ConfigBlock *, struct CaenV7nnModule
     *, enum Keyword);
 void		caen_v7nn_deinit(struct CaenV7nnModule *);
@@ -61,6 +69,8 @@ uint32_t	caen_v7nn_readout(struct Crate *, struct CaenV7nnModule *,
 void		caen_v7nn_readout_dt(struct CaenV7nnModule *);
 uint32_t	caen_v7nn_readout_shadow(struct CaenV7nnModule *, struct
     EventBuffer *) FUNC_RETURNS;
+uint32_t	caen_v7nn_readout_submit(struct Crate *, struct CaenV7nnModule
+    *, struct EventBuffer *) FUNC_RETURNS;
 void		caen_v7nn_use_pedestals(struct CaenV7nnModule *);
 void		caen_v7nn_zero_suppress(struct CaenV7nnModule *, int);
 struct cmvlc_stackcmdbuf;
@@ -33,6 +33,7 @@
 #include <nurdlib/crate.h>
 #include <util/bits.h>
 #include <util/fmtmod.h>
+#include <util/simd.h>
 #include <util/time.h>
 
 #define NAME "Caen v830"
@@ -219,9 +220,7 @@ caen_v830_parse_data(struct Crate *a_crate, struct Module *a_module, struct
 	}
 	p = a_event_buffer->ptr;
 	end = p + a_event_buffer->bytes / sizeof(uint32_t);
-	while (end != p && DMA_FILLER == *p) {
-		++p;
-	}
+	p = simd_skip32(p, end, DMA_FILLER);
 	counter = v830->counter_prev;
 	for (;; ++counter) {
 		uint32_t header, trigger_number;
@@ -297,7 +296,7 @@ uint32_t
 caen_v830_readout(struct Crate *a_crate, struct Module *a_module, struct
     EventBuffer *a_event_buffer)
 {
-	double t_0;
+	uint64_t t_0;
 	struct CaenV830Module *v830;
 	uint32_t *outp;
 	uint32_t result = 0;
@@ -325,18 +324,18 @@ caen_v830_readout(struct Crate *a_crate, struct Module *a_module, struct
 		result |= CRATE_READOUT_FAIL_EVENT_COUNTER_MISMATCH;
 	}
 
-	t_0 = -1;
+	t_0 = 0;
 	for (no_data_wait = 0;; ++no_data_wait) {
-		double t;
+		uint64_t t;
 
 		status = MAP_READ(v830->v8n0.sicy_map, status);
 		if (0x0 != (0x1 & status)) {
 			break;
 		}
-		t = time_getd();
-		if (0 > t_0) {
+		t = time_getns();
+		if (0 == t_0) {
 			t_0 = t;
-		} else if (NO_DATA_TIMEOUT < t - t_0) {
+		} else if (1e9 * NO_DATA_TIMEOUT < t - t_0) {
 			log_error(LOGL, "Data timeout (%gs), status=%08x.",
 			    NO_DATA_TIMEOUT, status);
 			result |= CRATE_READOUT_FAIL_DATA_MISSING;
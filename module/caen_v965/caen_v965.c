@@ -33,6 +33,9 @@
 #define IPED_0 (620.0f - 255.0f * 0.5f)
 
 MODULE_PROTOTYPES(caen_v965);
+static int	caen_v965_clear(struct Crate *, struct Module *) FUNC_RETURNS;
+static uint32_t	caen_v965_readout_submit(struct Crate *, struct Module *,
+    struct EventBuffer *) FUNC_RETURNS;
 static void	caen_v965_use_pedestals(struct Module *);
 static void	caen_v965_zero_suppress(struct Module *, int);
 #if NCONF_mMAP_bCMVLC
@@ -53,6 +56,17 @@ caen_v965_check_empty(struct Module *a_module)
 	return caen_v7nn_check_empty(&v965->v7nn);
 }
 
+int
+caen_v965_clear(struct Crate *a_crate, struct Module *a_module)
+{
+	struct CaenV965Module *v965;
+
+	(void)a_crate;
+	MODULE_CAST(KW_CAEN_V965, v965, a_module);
+	caen_v7nn_clear(&v965->v7nn);
+	return 1;
+}
+
 struct Module *
 caen_v965_create_(struct Crate *a_crate, struct ConfigBlock *a_block)
 {
@@ -178,6 +192,16 @@ caen_v965_readout_dt(struct Crate *a_crate, struct Module *a_module)
 	return 0;
 }
 
+uint32_t
+caen_v965_readout_submit(struct Crate *a_crate, struct Module *a_module,
+    struct EventBuffer *a_event_buffer)
+{
+	struct CaenV965Module *v965;
+
+	MODULE_CAST(KW_CAEN_V965, v965, a_module);
+	return caen_v7nn_readout_submit(a_crate, &v965->v7nn, a_event_buffer);
+}
+
 #if NCONF_mMAP_bCMVLC
 void
 caen_v965_cmvlc_init(struct Module *a_module,
@@ -217,6 +241,8 @@ void
 caen_v965_setup_(void)
 {
 	MODULE_SETUP(caen_v965, 0);
+	MODULE_CALLBACK_BIND(caen_v965, clear);
+	MODULE_CALLBACK_BIND(caen_v965, readout_submit);
 	MODULE_CALLBACK_BIND(caen_v965, use_pedestals);
 	MODULE_CALLBACK_BIND(caen_v965, zero_suppress);
 #if NCONF_mMAP_bCMVLC
@@ -64,14 +64,29 @@
  *  NAME_zero_suppress
  * If the module should use auto-pedestals:
  *  NAME_use_pedestals
+ * If free-running data should be time-sorted by the crate:
+ *  NAME_hit_next
+ * If the module buffers can be read while events are being taken:
+ *  NAME_readout_shadow
+ * If the data transfer can be started before the previous module is parsed:
+ *  NAME_readout_submit
  * See 'module/module.h' for more information on each one.
  */
 
 /* Prototypes. */
 MODULE_PROTOTYPES(dummy);
 
+static size_t	dummy_hit_next(struct Module *, struct EventConstBuffer const
+    *, uint64_t *);
+static uint32_t	dummy_readout_shadow(struct Crate *, struct Module *,
+    struct EventBuffer *) FUNC_RETURNS;
+static uint32_t	dummy_readout_submit(struct Crate *, struct Module *,
+    struct EventBuffer *) FUNC_RETURNS;
+
 /* Prototypes only for this module, to pretend it provides some data. */
 static void	init_registers(struct DummyModule *);
+static uint32_t	read_events(struct DummyModule *, struct EventBuffer *,
+    unsigned) FUNC_RETURNS;
 static void	store_event(struct DummyModule *, unsigned);
 
 /* Implementation. */
@@ -138,6 +153,13 @@ dummy_create_(struct Crate *a_crate, struct ConfigBlock *a_block)
 	 */
 	dummy->module.event_max = 32;
 
+	/*
+	 * Modules which can check only headers and footers in parse_data
+	 * when module.verify.is_shallow is set say so here, others are always
+	 * parsed fully whatever verify_level says.
+	 */
+	dummy->module.verify.has_shallow = 1;
+
 	/*
 	 * Get module configuration from config block for very long-lived
 	 * settings.
@@ -242,6 +264,31 @@ dummy_get_signature(struct ModuleSignature const **a_array, size_t *a_num)
 	LOGF(verbose)(LOGL, NAME" get_signature }");
 }
 
+/*
+ * Free-running data is cut into hits for the time-sorted merger, every
+ * event is one hit with the stored time in ns.
+ */
+size_t
+dummy_hit_next(struct Module *a_module, struct EventConstBuffer const
+    *a_event_buffer, uint64_t *a_ts)
+{
+	uint32_t const *p32;
+	unsigned wordcount;
+
+	(void)a_module;
+	p32 = a_event_buffer->ptr;
+	if (a_event_buffer->bytes < 3 * sizeof *p32) {
+		return 0;
+	}
+	wordcount = p32[0] & 0xff;
+	if (wordcount < 2 || a_event_buffer->bytes < (1 + wordcount) *
+	    sizeof *p32) {
+		return 0;
+	}
+	*a_ts = (uint64_t)p32[1] * 1000000000 + p32[2];
+	return (1 + wordcount) * sizeof *p32;
+}
+
 int
 dummy_init_fast(struct Crate *a_crate, struct Module *a_module)
 {
@@ -401,6 +448,8 @@ dummy_parse_data(struct Crate *a_crate, struct Module *a_module, struct
 	 * If a_do_pedestals is non-zero, ADC values should be set to
 	 * added for pedestal evaluation with "module_pedestal_add". The
 	 * caen_v7nn module has a rather simple implementation.
+	 * If a_module->verify.is_shallow is set, only headers and footers
+	 * need to be checked.
 	 */
 	LOGF(spam)(LOGL, NAME" parse_data }");
 	return 0;
@@ -410,19 +459,25 @@ uint32_t
 dummy_readout(struct Crate *a_crate, struct Module *a_module, struct
     EventBuffer *a_event_buffer)
 {
+	struct EventBuffer pool_eb;
 	struct DummyModule *dummy;
-	uint32_t *outp, result;
-	unsigned i, idx, ev;
-
-	(void)a_crate;
+	uint32_t *pool_ptr, result;
 
 	LOGF(spam)(LOGL, NAME" readout {");
-	result = 0;
 
 	MODULE_CAST(KW_DUMMY, dummy, a_module);
 
-	/* Dereference destination memory pointer. */
-	outp = a_event_buffer->ptr;
+	/*
+	 * A submitted transfer is already in the buffer, completing it only
+	 * advances the buffer.
+	 */
+	if (dummy->submit.is_pending) {
+		dummy->submit.is_pending = 0;
+		EVENT_BUFFER_ADVANCE(*a_event_buffer,
+		    (uint8_t *)a_event_buffer->ptr + dummy->submit.bytes);
+		result = 0;
+		goto dummy_readout_done;
+	}
 
 	/*
 	 * This is only needed for this dummy module to simulate readout
@@ -430,44 +485,27 @@ dummy_readout(struct Crate *a_crate, struct Module *a_module, struct
 	 */
 	store_event(dummy, dummy->event_diff);
 
-	/* Read the event from the buffer. */
-	idx = 0;
-	for (ev = 0; ev < dummy->event_diff; ++ev) {
-		uint32_t header;
-		unsigned wordcount;
-
-		/*
-		 * IMPORTANT NOTE: NEVER do more than one thing in macros such
-		 * as MAP_READ/WRITE, ie do NOT increment 'idx' inside!
-		 */
-		header = MAP_READ(dummy->sicy_map, buffer(idx));
-		++idx;
-		wordcount = header & 0xff;
+	/*
+	 * DMA modules can read into a pooled chunk in segmented readout and
+	 * place it, here every event has a header and N_CHANNELS + 3 words.
+	 */
+	pool_eb.bytes = dummy->event_diff * (N_CHANNELS + 4) *
+	    sizeof(uint32_t);
+	pool_ptr = crate_blt_pool_get(a_crate, pool_eb.bytes);
+	if (NULL != pool_ptr) {
+		pool_eb.ptr = pool_ptr;
+		result = read_events(dummy, &pool_eb, dummy->event_diff);
 		/*
-		 * Make sure we have enough memory still. This checks within
-		 * the ANSI C standard that outp[wordcount] is a valid
-		 * location inside the given memory area. Don't forget that we
-		 * also write the header, so the array offset is "1 +
-		 * wordcount - 1"!
+		 * This function checks that the placed chunk is valid within
+		 * the original buffer.
 		 */
-		if (!MEMORY_CHECK(*a_event_buffer, &outp[wordcount])) {
-			result |= CRATE_READOUT_FAIL_DATA_TOO_MUCH;
-			goto dummy_readout_done;
-		}
-		*outp++ = header;
-		for (i = 0; i < wordcount; ++i) {
-			*outp++ = MAP_READ(dummy->sicy_map, buffer(idx));
-			++idx;
-		}
+		result |= crate_event_buffer_place(a_crate, a_event_buffer,
+		    pool_ptr, (uintptr_t)pool_eb.ptr - (uintptr_t)pool_ptr);
+	} else {
+		result = read_events(dummy, a_event_buffer,
+		    dummy->event_diff);
 	}
-
 dummy_readout_done:
-	/*
-	 * Save new buffer pointer, this function checks that the new pointer
-	 * is valid within the original buffer, and reduces unique locations
-	 * of pointer arithmetic.
-	 */
-	EVENT_BUFFER_ADVANCE(*a_event_buffer, outp);
 	LOGF(spam)(LOGL, NAME" readout(0x%08x) }", result);
 	return result;
 }
@@ -492,6 +530,63 @@ dummy_readout_dt(struct Crate *a_crate, struct Module *a_module)
 	return 0;
 }
 
+/*
+ * Shadow readout reads whatever has been counted since the last call, the
+ * data counter tells the crate how far the shadow buffer has come.
+ */
+uint32_t
+dummy_readout_shadow(struct Crate *a_crate, struct Module *a_module, struct
+    EventBuffer *a_event_buffer)
+{
+	struct DummyModule *dummy;
+	uint32_t counter, result;
+	unsigned event_num;
+
+	(void)a_crate;
+	LOGF(spam)(LOGL, NAME" readout_shadow {");
+	MODULE_CAST(KW_DUMMY, dummy, a_module);
+	result = 0;
+	counter = MAP_READ(dummy->sicy_map, counter);
+	event_num = (counter - a_module->shadow.data_counter_value) &
+	    a_module->event_counter.mask;
+	if (0 != event_num) {
+		store_event(dummy, event_num);
+		result = read_events(dummy, a_event_buffer, event_num);
+		if (0 == result) {
+			a_module->shadow.data_counter_value = counter;
+		}
+	}
+	LOGF(spam)(LOGL, NAME" readout_shadow(0x%08x) }", result);
+	return result;
+}
+
+/*
+ * Pipelined readout starts the transfer here, think of an async BLT. The
+ * data lands in the buffer, but only the following readout advances it.
+ */
+uint32_t
+dummy_readout_submit(struct Crate *a_crate, struct Module *a_module, struct
+    EventBuffer *a_event_buffer)
+{
+	struct EventBuffer eb;
+	struct DummyModule *dummy;
+	uint32_t result;
+
+	(void)a_crate;
+	LOGF(spam)(LOGL, NAME" readout_submit {");
+	MODULE_CAST(KW_DUMMY, dummy, a_module);
+	store_event(dummy, dummy->event_diff);
+	COPY(eb, *a_event_buffer);
+	result = read_events(dummy, &eb, dummy->event_diff);
+	if (0 == result) {
+		dummy->submit.bytes = a_event_buffer->bytes - eb.bytes;
+		dummy->submit.is_pending = 1;
+		++dummy->submit.num;
+	}
+	LOGF(spam)(LOGL, NAME" readout_submit(0x%08x) }", result);
+	return result;
+}
+
 /*
  * Module-wide properties are set here.
  */
@@ -504,6 +599,9 @@ dummy_setup_(void)
 	 * new signals.
 	 */
 	MODULE_SETUP(dummy, MODULE_FLAG_EARLY_DT);
+	MODULE_CALLBACK_BIND(dummy, hit_next);
+	MODULE_CALLBACK_BIND(dummy, readout_shadow);
+	MODULE_CALLBACK_BIND(dummy, readout_submit);
 }
 
 /* Implementation of module specific methods. */
@@ -520,10 +618,63 @@ init_registers(struct DummyModule *a_dummy)
 	MAP_WRITE(a_dummy->sicy_map, counter, 0);
 }
 
+/* Reads 'a_event_num' stored events into the buffer and advances it. */
+uint32_t
+read_events(struct DummyModule *a_dummy, struct EventBuffer *a_event_buffer,
+    unsigned a_event_num)
+{
+	uint32_t *outp;
+	uint32_t result;
+	unsigned i, idx, ev;
+
+	result = 0;
+
+	/* Dereference destination memory pointer. */
+	outp = a_event_buffer->ptr;
+
+	/* Read the event from the buffer. */
+	idx = 0;
+	for (ev = 0; ev < a_event_num; ++ev) {
+		uint32_t header;
+		unsigned wordcount;
+
+		/*
+		 * IMPORTANT NOTE: NEVER do more than one thing in macros such
+		 * as MAP_READ/WRITE, ie do NOT increment 'idx' inside!
+		 */
+		header = MAP_READ(a_dummy->sicy_map, buffer(idx));
+		++idx;
+		wordcount = header & 0xff;
+		/*
+		 * Make sure we have enough memory still. This checks within
+		 * the ANSI C standard that outp[wordcount] is a valid
+		 * location inside the given memory area. Don't forget that we
+		 * also write the header, so the array offset is "1 +
+		 * wordcount - 1"!
+		 */
+		if (!MEMORY_CHECK(*a_event_buffer, &outp[wordcount])) {
+			result |= CRATE_READOUT_FAIL_DATA_TOO_MUCH;
+			break;
+		}
+		*outp++ = header;
+		for (i = 0; i < wordcount; ++i) {
+			*outp++ = MAP_READ(a_dummy->sicy_map, buffer(idx));
+			++idx;
+		}
+	}
+
+	/*
+	 * Save new buffer pointer, this function checks that the new pointer
+	 * is valid within the original buffer, and reduces unique locations
+	 * of pointer arithmetic.
+	 */
+	EVENT_BUFFER_ADVANCE(*a_event_buffer, outp);
+	return result;
+}
+
 void
 store_event(struct DummyModule *a_dummy, unsigned a_event_diff)
 {
-	static unsigned s_event_number = 0;
 	uint32_t ch;
 	unsigned idx;
 	unsigned id;
@@ -558,8 +709,9 @@ store_event(struct DummyModule *a_dummy, unsigned a_event_diff)
 		}
 
 		/* Footer. */
-		MAP_WRITE(a_dummy->sicy_map, buffer(idx), s_event_number);
+		MAP_WRITE(a_dummy->sicy_map, buffer(idx),
+		    a_dummy->event_number);
 		++idx;
-		++s_event_number;
+		++a_dummy->event_number;
 	}
 }
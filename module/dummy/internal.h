@@ -41,8 +41,16 @@ struct DummyModule {
 	void	*memory;
 	/* Event counter diff. */
 	uint32_t	event_diff;
+	/* Footer of the simulated events, per module for parallel readout. */
+	uint32_t	event_number;
 	/* Callback in 'init' for testing. */
 	void	(*init_callback)(void);
+	/* Transfer started by readout_submit, completed by readout. */
+	struct {
+		int	is_pending;
+		size_t	bytes;
+		unsigned	num;
+	} submit;
 
 	/* Configuration. */
 	uint32_t	address;
@@ -31,6 +31,8 @@
 #define NAME "Gsi CTDC"
 
 MODULE_PROTOTYPES(gsi_ctdc);
+static int			gsi_ctdc_clear(struct Crate *, struct Module *)
+	FUNC_RETURNS;
 static struct ConfigBlock	*gsi_ctdc_get_submodule_config(struct Module
     *, unsigned) FUNC_RETURNS;
 static int			gsi_ctdc_sub_module_pack(struct Module *,
@@ -51,6 +53,16 @@ gsi_ctdc_check_empty(struct Module *a_module)
 	return 0;
 }
 
+int
+gsi_ctdc_clear(struct Crate *a_crate, struct Module *a_module)
+{
+	struct GsiCTDCModule *ctdc;
+
+	MODULE_CAST(KW_GSI_CTDC, ctdc, a_module);
+	gsi_ctdc_proto_clear(a_crate, &ctdc->ctdcp);
+	return 1;
+}
+
 struct Module *
 gsi_ctdc_create_(struct Crate *a_crate, struct ConfigBlock *a_block)
 {
@@ -165,6 +177,7 @@ void
 gsi_ctdc_setup_(void)
 {
 	MODULE_SETUP(gsi_ctdc, MODULE_FLAG_EARLY_DT);
+	MODULE_CALLBACK_BIND(gsi_ctdc, clear);
 	MODULE_CALLBACK_BIND(gsi_ctdc, get_submodule_config);
 	MODULE_CALLBACK_BIND(gsi_ctdc, sub_module_pack);
 }
@@ -70,6 +70,15 @@ static const uint32_t REG_CTDC_TRIGGER_DISABLE[] = {
 	}\
 } while (0)
 
+void
+gsi_ctdc_proto_clear(struct Crate *a_crate, struct GsiCTDCProtoModule
+    *a_ctdcp)
+{
+	LOGF(verbose)(LOGL, NAME" clear {");
+	gsi_pex_sfp_clear(crate_gsi_pex_get(a_crate), a_ctdcp->sfp_i);
+	LOGF(verbose)(LOGL, NAME" clear }");
+}
+
 void
 gsi_ctdc_proto_create(struct ConfigBlock *a_block, struct GsiCTDCProtoModule
     *a_ctdcp, enum Keyword a_child_type)
@@ -589,9 +598,11 @@ gsi_ctdc_proto_readout(struct Crate *a_crate, struct GsiCTDCProtoModule
 			goto gsi_ctdc_proto_readout_done;
 		}
 	}
-	memmove(a_event_buffer->ptr, (void *)dst_bursted, bytes);
-	EVENT_BUFFER_ADVANCE(*a_event_buffer, (uint8_t *)a_event_buffer->ptr +
-	    bytes);
+	ret = crate_event_buffer_place(a_crate, a_event_buffer,
+	    (void const *)dst_bursted, bytes);
+	if (0 != ret) {
+		goto gsi_ctdc_proto_readout_done;
+	}
 
 	++a_ctdcp->module.event_counter.value;
 
@@ -48,6 +48,8 @@ struct GsiCTDCProtoModule {
 	GsiCTDCSetThreshold     threshold_set;
 };
 
+void			gsi_ctdc_proto_clear(struct Crate *, struct
+    GsiCTDCProtoModule *);
 void			gsi_ctdc_proto_create(struct ConfigBlock *, struct
     GsiCTDCProtoModule *, enum Keyword);
 void			gsi_ctdc_proto_destroy(struct GsiCTDCProtoModule *);
@@ -69,6 +69,7 @@ struct Setting {
 void	setting_override(struct Setting *, struct ConfigBlock *);
 
 MODULE_PROTOTYPES(gsi_febex);
+static int	gsi_febex_clear(struct Crate *, struct Module *) FUNC_RETURNS;
 
 /* Puts non-"null" config values into setting struct. */
 void
@@ -138,6 +139,16 @@ gsi_febex_check_empty(struct Module *a_module)
 	return 0;
 }
 
+int
+gsi_febex_clear(struct Crate *a_crate, struct Module *a_module)
+{
+	struct GsiFebexModule *feb;
+
+	MODULE_CAST(KW_GSI_FEBEX, feb, a_module);
+	gsi_pex_sfp_clear(crate_gsi_pex_get(a_crate), feb->sfp_i);
+	return 1;
+}
+
 struct Module *
 gsi_febex_create_(struct Crate *a_crate, struct ConfigBlock *a_block)
 {
@@ -731,9 +742,12 @@ gsi_febex_readout(struct Crate *a_crate, struct Module *a_module, struct
 		}
 		sched_yield();
 	}
-	/* Move back data to cover DMA address fudging. */
-	memmove(a_event_buffer->ptr, (void *)dst_bursted, bytes);
-	a_event_buffer->ptr = (uint8_t *)a_event_buffer->ptr + bytes;
+	/*
+	 * Move back data to cover DMA address fudging, segmented readouts
+	 * skip the padding instead.
+	 */
+	ret = crate_event_buffer_place(a_crate, a_event_buffer,
+	    (void const *)dst_bursted, bytes);
 gsi_febex_readout_done:
 	LOGF(spam)(LOGL, NAME" readout(0x%08x) }", ret);
 	return ret;
@@ -752,6 +766,7 @@ void
 gsi_febex_setup_(void)
 {
 	MODULE_SETUP(gsi_febex, MODULE_FLAG_EARLY_DT);
+	MODULE_CALLBACK_BIND(gsi_febex, clear);
 }
 
 void
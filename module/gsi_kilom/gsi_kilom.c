@@ -49,6 +49,8 @@
 } while (0)
 
 MODULE_PROTOTYPES(gsi_kilom);
+static int			gsi_kilom_clear(struct Crate *, struct Module *)
+	FUNC_RETURNS;
 static struct ConfigBlock	*gsi_kilom_get_submodule_config(struct Module
     *, unsigned);
 static int			gsi_kilom_sub_module_pack(struct Module *,
@@ -63,6 +65,16 @@ gsi_kilom_check_empty(struct Module *a_module)
 	return 0;
 }
 
+int
+gsi_kilom_clear(struct Crate *a_crate, struct Module *a_module)
+{
+	struct GsiKilomModule *kilom;
+
+	MODULE_CAST(KW_GSI_KILOM, kilom, a_module);
+	gsi_ctdc_proto_clear(a_crate, &kilom->ctdcp);
+	return 1;
+}
+
 struct Module *
 gsi_kilom_create_(struct Crate *a_crate, struct ConfigBlock *a_block)
 {
@@ -200,6 +212,7 @@ void
 gsi_kilom_setup_(void)
 {
 	MODULE_SETUP(gsi_kilom, MODULE_FLAG_EARLY_DT);
+	MODULE_CALLBACK_BIND(gsi_kilom, clear);
 	MODULE_CALLBACK_BIND(gsi_kilom, get_submodule_config);
 	MODULE_CALLBACK_BIND(gsi_kilom, sub_module_pack);
 }
@@ -39,6 +39,8 @@
 } while (0)
 
 MODULE_PROTOTYPES(gsi_mppc_rob);
+static int			gsi_mppc_rob_clear(struct Crate *, struct
+    Module *) FUNC_RETURNS;
 static struct ConfigBlock	*gsi_mppc_rob_get_submodule_config(struct
     Module *, unsigned);
 static int			gsi_mppc_rob_sub_module_pack(struct Module *,
@@ -53,6 +55,16 @@ gsi_mppc_rob_check_empty(struct Module *a_module)
 	return 0;
 }
 
+int
+gsi_mppc_rob_clear(struct Crate *a_crate, struct Module *a_module)
+{
+	struct GsiMppcRobModule *mppc_rob;
+
+	MODULE_CAST(KW_GSI_MPPC_ROB, mppc_rob, a_module);
+	gsi_ctdc_proto_clear(a_crate, &mppc_rob->ctdcp);
+	return 1;
+}
+
 struct Module *
 gsi_mppc_rob_create_(struct Crate *a_crate, struct ConfigBlock *a_block)
 {
@@ -179,6 +191,7 @@ void
 gsi_mppc_rob_setup_(void)
 {
 	MODULE_SETUP(gsi_mppc_rob, MODULE_FLAG_EARLY_DT);
+	MODULE_CALLBACK_BIND(gsi_mppc_rob, clear);
 	MODULE_CALLBACK_BIND(gsi_mppc_rob, get_submodule_config);
 	MODULE_CALLBACK_BIND(gsi_mppc_rob, sub_module_pack);
 }
@@ -226,6 +226,15 @@ gsi_pex_readout_prepare(struct GsiPex *a_pex)
 	LOGF(spam)(LOGL, NAME" readout_prepare }");
 }
 
+void
+gsi_pex_sfp_clear(struct GsiPex *a_pex, size_t a_sfp_i)
+{
+	LOGF(verbose)(LOGL, NAME" sfp_clear(%"PRIz") {", a_sfp_i);
+	gsi_pex_reset(a_pex);
+	rx_clear_sfps(a_pex, 1 << a_sfp_i);
+	LOGF(verbose)(LOGL, NAME" sfp_clear }");
+}
+
 void
 gsi_pex_sfp_tag(struct GsiPex *a_pex, unsigned a_sfp_i)
 {
@@ -551,6 +560,13 @@ gsi_pex_reset(struct GsiPex *a_pex)
 	(void)a_pex;
 }
 
+void
+gsi_pex_sfp_clear(struct GsiPex *a_pex, size_t a_sfp_i)
+{
+	(void)a_pex;
+	(void)a_sfp_i;
+}
+
 void
 gsi_pex_sfp_tag(struct GsiPex *a_pex, unsigned a_sfp_i)
 {
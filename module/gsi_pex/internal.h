@@ -120,14 +120,16 @@ void		gsi_pex_free(struct GsiPex **);
  *  COPY(eb, *a_eb);
  *  gsi_pex_buf_get(pex, &eb, &ofs);
  *  bytes = do_dma(dma_target = eb.ptr + ofs);
- *  memmove(a_eb->ptr, eb.ptr, bytes);
- *  advance(a_eb, bytes);
+ *  crate_event_buffer_place(crate, a_eb, eb.ptr, bytes);
+ * The last call moves the data and advances, or for option 1 in a segmented
+ * readout references the data in place and skips the padding.
  */
 int		gsi_pex_buf_get(struct GsiPex const *, struct EventBuffer *,
     uintptr_t *);
 void		gsi_pex_init(struct GsiPex *, struct ConfigBlock *);
 void		gsi_pex_readout_prepare(struct GsiPex *);
 void		gsi_pex_reset(struct GsiPex *);
+void		gsi_pex_sfp_clear(struct GsiPex *, size_t);
 void		gsi_pex_sfp_tag(struct GsiPex *, unsigned);
 int		gsi_pex_slave_init(struct GsiPex *, size_t, size_t)
 	FUNC_RETURNS;
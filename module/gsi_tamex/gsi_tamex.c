@@ -56,6 +56,8 @@
 MODULE_PROTOTYPES(gsi_tamex);
 static void			gate_get(struct ModuleGate *, struct
     ModuleGate const *, struct ConfigBlock *, int);
+static int			gsi_tamex_clear(struct Crate *, struct Module *)
+	FUNC_RETURNS;
 static struct ConfigBlock	*gsi_tamex_get_submodule_config(struct Module
     *, unsigned);
 static int			gsi_tamex_sub_module_pack(struct Module *,
@@ -90,6 +92,16 @@ gsi_tamex_check_empty(struct Module *a_module)
 	return 0;
 }
 
+int
+gsi_tamex_clear(struct Crate *a_crate, struct Module *a_module)
+{
+	struct GsiTamexModule *tam;
+
+	MODULE_CAST(KW_GSI_TAMEX, tam, a_module);
+	gsi_pex_sfp_clear(crate_gsi_pex_get(a_crate), tam->sfp_i);
+	return 1;
+}
+
 struct Module *
 gsi_tamex_create_(struct Crate *a_crate, struct ConfigBlock *a_block)
 {
@@ -839,8 +851,12 @@ if (1) {
 			goto gsi_tamex_readout_done;
 		}
 	}
-	/* Move back data to cover DMA address alignment fudging. */
-	memmove(a_event_buffer->ptr, (void *)dst_bursted, bytes);
+	/*
+	 * Move back data to cover DMA address alignment fudging, segmented
+	 * readouts skip the padding instead.
+	 */
+	ret = crate_event_buffer_place(a_crate, a_event_buffer,
+	    (void const *)dst_bursted, bytes);
  } else {
 	/* Let's do it the stupid way. */
 	uint32_t volatile *src;
@@ -852,9 +868,9 @@ if (1) {
 	for (i = 0; i < bytes; i += 4) {
 		*dst++ = *src++;
 	}
- }
 	EVENT_BUFFER_ADVANCE(*a_event_buffer, (uint8_t *)a_event_buffer->ptr +
 	    bytes);
+ }
 
 gsi_tamex_readout_done:
 	LOGF(spam)(LOGL, NAME" readout(0x%08x) }", ret);
@@ -884,6 +900,7 @@ void
 gsi_tamex_setup_(void)
 {
 	MODULE_SETUP(gsi_tamex, MODULE_FLAG_EARLY_DT);
+	MODULE_CALLBACK_BIND(gsi_tamex, clear);
 	MODULE_CALLBACK_BIND(gsi_tamex, get_submodule_config);
 	MODULE_CALLBACK_BIND(gsi_tamex, sub_module_pack);
 }
@@ -470,7 +470,7 @@ gsi_vftx2_readout(struct Crate *a_crate, struct Module *a_module, struct
 {
 	struct GsiVftx2Module *vftx2;
 	uint32_t *outp;
-	double t_0;
+	uint64_t t_0;
 	uint32_t result, status;
 	unsigned i, hit_num;
 
@@ -480,8 +480,8 @@ gsi_vftx2_readout(struct Crate *a_crate, struct Module *a_module, struct
 	result = 0;
 	MODULE_CAST(KW_GSI_VFTX2, vftx2, a_module);
 
-	for (t_0 = -1;;) {
-		double t;
+	for (t_0 = 0;;) {
+		uint64_t t;
 
 		status = MAP_READ(vftx2->sicy_map, fifo_status);
 		SERIALIZE_IO;
@@ -489,10 +489,10 @@ gsi_vftx2_readout(struct Crate *a_crate, struct Module *a_module, struct
 			LOGF(spam)(LOGL, "Status = %08x.", status);
 			break;
 		}
-		t = time_getd();
-		if (0 > t_0) {
+		t = time_getns();
+		if (0 == t_0) {
 			t_0 = t;
-		} else if (t_0 + NO_DATA_TIMEOUT < t) {
+		} else if (1e9 * NO_DATA_TIMEOUT < t - t_0) {
 			log_error(LOGL, "Data timeout (>%gs,status=0x%08x).",
 			    NO_DATA_TIMEOUT, status);
 			result |= CRATE_READOUT_FAIL_DATA_MISSING;
@@ -500,7 +500,7 @@ gsi_vftx2_readout(struct Crate *a_crate, struct Module *a_module, struct
 		}
 		sched_yield();
 	}
-	if (0 < t_0) {
+	if (0 != t_0) {
 		crate_acvt_grow(a_crate);
 	}
 
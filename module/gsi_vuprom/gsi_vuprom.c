@@ -262,7 +262,7 @@ gsi_vuprom_readout(struct Crate *a_crate, struct Module *a_module, struct
     EventBuffer *a_event_buffer)
 {
 	struct GsiVupromModule *vuprom;
-	double t_0;
+	uint64_t t_0;
 	uint32_t result;
 
 	(void)a_crate;
@@ -272,15 +272,15 @@ gsi_vuprom_readout(struct Crate *a_crate, struct Module *a_module, struct
 	LOGF(spam)(LOGL, NAME" readout {");
 	MODULE_CAST(KW_GSI_VUPROM, vuprom, a_module);
 
-	for (t_0 = -1;;) {
-		double t;
+	for (t_0 = 0;;) {
+		uint64_t t;
 
 		if (0 != (0x8 & MAP_READ(vuprom->sicy_map, data_ready))) {
 			break;
 		}
-		t = time_getd();
-		if (0 > t_0) {
-			t_0 = t + READOUT_TIMEOUT;
+		t = time_getns();
+		if (0 == t_0) {
+			t_0 = t + 1e9 * READOUT_TIMEOUT;
 		} else if (t > t_0) {
 			log_error(LOGL, NAME" data timeout (>%fs).",
 			    READOUT_TIMEOUT);
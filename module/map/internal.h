@@ -55,9 +55,13 @@ enum MapMod {
 	/* 'r' = register only readable sometimes (e.g. event FIFOs). */
 	MAP_MOD_r = 2,
 	/* 'W' = register writable. */
-	MAP_MOD_W = 4
+	MAP_MOD_W = 4,
+	/* 'A' = writing is an action (e.g. resets), never skipped. */
+	MAP_MOD_A = 8
 };
 
+struct MapShadow;
+
 struct Map {
 	enum	MapType type;
 	enum	Keyword mode;
@@ -65,6 +69,16 @@ struct Map {
 	size_t	bytes;
 	int	do_mblt_swap;
 	void	*private;
+	struct	MapShadow *shadow;
+};
+struct MapBatchOp {
+	struct	Map *map;
+	size_t	ofs;
+	unsigned	mod;
+	unsigned	bits;
+	int	is_write;
+	uint32_t	value;
+	uint32_t	*dst;
 };
 
 /* System-specific mapping implementations. */
@@ -80,6 +94,10 @@ void		blt_unmap(struct Map *);
 void		poke_r(uint32_t, uintptr_t, unsigned);
 void		poke_w(uint32_t, uintptr_t, unsigned, uint32_t);
 
+#ifdef SICY_BATCH
+/* Performs the given accesses in order, never on user maps. */
+void		sicy_batch(struct MapBatchOp *, size_t);
+#endif
 void		sicy_deinit(void);
 void		sicy_map(struct Map *);
 uint16_t	sicy_r16(struct Map *, size_t);
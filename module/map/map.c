@@ -27,10 +27,72 @@
 #include <nurdlib/log.h>
 #include <util/assert.h>
 #include <util/fmtmod.h>
+#include <util/memcpy.h>
 #include <util/queue.h>
+#include <util/simd.h>
 #include <util/string.h>
+#include <util/thread.h>
 #include <util/time.h>
+#include <util/vector.h>
 
+/*
+ * Controller libraries keep process-global handles, e.g. the CAEN handle, so
+ * the hardware accesses of all crate and async threads are serialized.
+ */
+#if DO_PTHREADS && !MAP_SICY_CONCURRENT
+#	define BACKEND_LOCK thread_mutex_lock(&g_backend_mutex)
+#	define BACKEND_UNLOCK thread_mutex_unlock(&g_backend_mutex)
+static struct Mutex g_backend_mutex;
+#else
+#	define BACKEND_LOCK
+#	define BACKEND_UNLOCK
+#endif
+
+enum MapBltAsyncState {
+	ASYNC_IDLE,
+	ASYNC_SUBMITTED,
+	ASYNC_DONE
+};
+
+VECTOR_HEAD(MapBatchOpVector, struct MapBatchOp);
+struct MapBatch {
+	struct	MapBatchOpVector op_vec;
+};
+struct MapBltAsync {
+	struct	Map *map;
+	size_t	ofs;
+	void	*target;
+	size_t	bytes;
+	int	do_berr;
+	int	ret;
+	enum	MapBltAsyncState state;
+#if DO_PTHREADS
+	int	is_running;
+	struct	Mutex mutex;
+	struct	CondVar cond;
+	struct	Thread thread;
+#endif
+};
+struct MapBltPool {
+	struct	MapBltDst *dst;
+	uint8_t	*base;
+	size_t	bytes;
+	size_t	ofs;
+};
+struct MapShadowEntry {
+	/* Offset + 1, 0 = empty slot. */
+	size_t	key;
+	unsigned	bits;
+	uint32_t	value;
+};
+struct MapShadow {
+	struct	MapShadowEntry *array;
+	size_t	capacity;
+	size_t	num;
+	int	do_skip;
+	uint32_t	issued_num;
+	uint32_t	skipped_num;
+};
 TAILQ_HEAD(UserList, User);
 struct User {
 	uint32_t	address;
@@ -39,8 +101,22 @@ struct User {
 	TAILQ_ENTRY(User)	next;
 };
 
+#if DO_PTHREADS
+static void	async_func(void *);
+#endif
 static int	blt_read_common(struct Map *, size_t, void *, size_t, int)
 	FUNC_RETURNS;
+static int	blt_read_swap(struct Map *, size_t, void *, size_t, int)
+	FUNC_RETURNS;
+
+static struct MapShadowEntry	*shadow_find(struct MapShadow *, size_t)
+	FUNC_RETURNS;
+static int			shadow_skip(struct Map *, unsigned, unsigned,
+    size_t, uint32_t) FUNC_RETURNS;
+static void			shadow_update(struct Map *, unsigned, unsigned,
+    size_t, uint32_t);
+static void			write_direct(struct Map *, unsigned, size_t,
+    uint32_t);
 
 static struct UserList g_user_list = TAILQ_HEAD_INITIALIZER(g_user_list);
 
@@ -48,6 +124,41 @@ static struct UserList g_user_list = TAILQ_HEAD_INITIALIZER(g_user_list);
 static uint32_t	mblt_swap(uint32_t*, size_t) FUNC_RETURNS;
 #endif
 
+#if DO_PTHREADS
+/*
+ * Helper thread of an async handle, log levels are not touched and log
+ * messages must not rely on indentation.
+ */
+void
+async_func(void *a_data)
+{
+	struct MapBltAsync *async;
+
+	async = a_data;
+	thread_mutex_lock(&async->mutex);
+	for (;;) {
+		int ret;
+
+		while (async->is_running && ASYNC_SUBMITTED != async->state) {
+			thread_condvar_wait(&async->cond, &async->mutex);
+		}
+		if (!async->is_running) {
+			break;
+		}
+		thread_mutex_unlock(&async->mutex);
+
+		ret = blt_read_swap(async->map, async->ofs, async->target,
+		    async->bytes, async->do_berr);
+
+		thread_mutex_lock(&async->mutex);
+		async->ret = ret;
+		async->state = ASYNC_DONE;
+		thread_condvar_broadcast(&async->cond);
+	}
+	thread_mutex_unlock(&async->mutex);
+}
+#endif
+
 int
 blt_read_common(struct Map *a_mapper, size_t a_offset, void *a_target, size_t
     a_bytes, int a_berr_ok)
@@ -58,7 +169,26 @@ blt_read_common(struct Map *a_mapper, size_t a_offset, void *a_target, size_t
 	    "target=%p,bytes=0x%"PRIzx",berr=%s) {",
 	    a_mapper->address, a_offset, a_target, a_bytes,
 	    a_berr_ok ? "yes" : "no");
+	ret = blt_read_swap(a_mapper, a_offset, a_target, a_bytes, a_berr_ok);
+	LOGF(spam)(LOGL, "blt_read_common(bytes=%d) }", ret);
+	return ret;
+}
+
+int
+blt_read_swap(struct Map *a_mapper, size_t a_offset, void *a_target, size_t
+    a_bytes, int a_berr_ok)
+{
+	int ret;
+
+	if (MAP_TYPE_USER == a_mapper->type) {
+		uint8_t const *p8 = a_mapper->private;
+
+		memcpy_(a_target, p8 + a_offset, a_bytes);
+		return a_bytes;
+	}
+	BACKEND_LOCK;
 	ret = blt_read(a_mapper, a_offset, a_target, a_bytes, a_berr_ok);
+	BACKEND_UNLOCK;
 #ifndef BLT_HW_MBLT_SWAP
 	/* TODO: Go through these macro and soft switches. */
 	if (0 == ret &&
@@ -67,7 +197,6 @@ blt_read_common(struct Map *a_mapper, size_t a_offset, void *a_target, size_t
 		ret = mblt_swap(a_target, a_bytes);
 	}
 #endif
-	LOGF(spam)(LOGL, "blt_read_common(bytes=%d) }", ret);
 	return ret;
 }
 
@@ -106,6 +235,178 @@ map_align(void *a_ptr, size_t *a_bytes, enum Keyword a_blt_mode, uint32_t
 	return p32;
 }
 
+struct MapBltAsync *
+map_blt_async_create(void)
+{
+	struct MapBltAsync *async;
+
+	CALLOC(async, 1);
+	async->state = ASYNC_IDLE;
+#if DO_PTHREADS
+	if (!thread_mutex_init(&async->mutex) ||
+	    !thread_condvar_init(&async->cond)) {
+		log_die(LOGL, "Could not create async BLT primitives.");
+	}
+	async->is_running = 1;
+	if (!thread_start(&async->thread, async_func, async)) {
+		log_die(LOGL, "Could not start async BLT thread.");
+	}
+#endif
+	return async;
+}
+
+void
+map_blt_async_free(struct MapBltAsync **a_async)
+{
+	struct MapBltAsync *async;
+
+	async = *a_async;
+	if (NULL == async) {
+		return;
+	}
+	if (ASYNC_SUBMITTED == async->state) {
+		int ret;
+
+		ret = map_blt_async_wait(async);
+		log_error(LOGL, "Freed async BLT in flight (ret=%d).", ret);
+	}
+#if DO_PTHREADS
+	thread_mutex_lock(&async->mutex);
+	async->is_running = 0;
+	thread_condvar_broadcast(&async->cond);
+	thread_mutex_unlock(&async->mutex);
+	thread_clean(&async->thread);
+	thread_condvar_clean(&async->cond);
+	thread_mutex_clean(&async->mutex);
+#endif
+	FREE(*a_async);
+}
+
+int
+map_blt_async_poll(struct MapBltAsync *a_async)
+{
+	int is_done;
+
+#if DO_PTHREADS
+	thread_mutex_lock(&a_async->mutex);
+	is_done = ASYNC_SUBMITTED != a_async->state;
+	thread_mutex_unlock(&a_async->mutex);
+#else
+	is_done = ASYNC_SUBMITTED != a_async->state;
+#endif
+	return is_done;
+}
+
+void
+map_blt_async_submit(struct MapBltAsync *a_async, struct Map *a_mapper,
+    size_t a_offset, void *a_target, size_t a_bytes, int a_berr_ok)
+{
+	LOGF(spam)(LOGL, "map_blt_async_submit(source=0x%08x,"
+	    "offset=0x%"PRIzx",target=%p,bytes=0x%"PRIzx",berr=%s).",
+	    a_mapper->address, a_offset, a_target, a_bytes,
+	    a_berr_ok ? "yes" : "no");
+	if (ASYNC_SUBMITTED == a_async->state) {
+		log_die(LOGL, "Async BLT submitted while in flight!");
+	}
+	a_async->map = a_mapper;
+	a_async->ofs = a_offset;
+	a_async->target = a_target;
+	a_async->bytes = a_bytes;
+	a_async->do_berr = a_berr_ok;
+#if DO_PTHREADS
+	thread_mutex_lock(&a_async->mutex);
+	a_async->state = ASYNC_SUBMITTED;
+	thread_condvar_broadcast(&a_async->cond);
+	thread_mutex_unlock(&a_async->mutex);
+#else
+	a_async->ret = blt_read_swap(a_mapper, a_offset, a_target, a_bytes,
+	    a_berr_ok);
+	a_async->state = ASYNC_DONE;
+#endif
+}
+
+int
+map_blt_async_wait(struct MapBltAsync *a_async)
+{
+	int ret;
+
+#if DO_PTHREADS
+	thread_mutex_lock(&a_async->mutex);
+	while (ASYNC_SUBMITTED == a_async->state) {
+		thread_condvar_wait(&a_async->cond, &a_async->mutex);
+	}
+#endif
+	if (ASYNC_DONE != a_async->state) {
+		log_die(LOGL, "Async BLT waited on without submit!");
+	}
+	a_async->state = ASYNC_IDLE;
+	ret = a_async->ret;
+#if DO_PTHREADS
+	thread_mutex_unlock(&a_async->mutex);
+#endif
+	LOGF(spam)(LOGL, "map_blt_async_wait(bytes=%d).", ret);
+	return ret;
+}
+
+struct MapBltPool *
+map_blt_pool_create(size_t a_bytes)
+{
+	struct MapBltPool *pool;
+
+	LOGF(verbose)(LOGL, "map_blt_pool_create(bytes=0x%"PRIzx") {",
+	    a_bytes);
+	CALLOC(pool, 1);
+	/* Page-aligned with mmap, but not necessarily otherwise. */
+	pool->dst = map_blt_dst_alloc(a_bytes + MAP_BLT_POOL_ALIGN - 1);
+	pool->base = map_blt_dst_get(pool->dst);
+	pool->base += (MAP_BLT_POOL_ALIGN - (uintptr_t)pool->base) &
+	    (MAP_BLT_POOL_ALIGN - 1);
+	pool->bytes = a_bytes;
+	pool->ofs = 0;
+	LOGF(verbose)(LOGL, "map_blt_pool_create(base=%p) }",
+	    (void *)pool->base);
+	return pool;
+}
+
+void
+map_blt_pool_free(struct MapBltPool **a_pool)
+{
+	struct MapBltPool *pool;
+
+	pool = *a_pool;
+	if (NULL == pool) {
+		return;
+	}
+	map_blt_dst_free(&pool->dst);
+	FREE(*a_pool);
+}
+
+void *
+map_blt_pool_get(struct MapBltPool *a_pool, size_t a_bytes)
+{
+	size_t ofs;
+
+	ofs = (a_pool->ofs + MAP_BLT_POOL_ALIGN - 1) &
+	    ~(size_t)(MAP_BLT_POOL_ALIGN - 1);
+	if (ofs > a_pool->bytes || a_bytes > a_pool->bytes - ofs) {
+		return NULL;
+	}
+	a_pool->ofs = ofs + a_bytes;
+	return a_pool->base + ofs;
+}
+
+int
+map_blt_pool_has(struct MapBltPool const *a_pool, void const *a_ptr)
+{
+	return (uintptr_t)a_ptr - (uintptr_t)a_pool->base < a_pool->bytes;
+}
+
+void
+map_blt_pool_reset(struct MapBltPool *a_pool)
+{
+	a_pool->ofs = 0;
+}
+
 int
 map_blt_read(struct Map *a_mapper, size_t a_offset, void *a_target, size_t
     a_bytes)
@@ -153,7 +454,7 @@ map_map(uint32_t a_address, size_t a_bytes, enum Keyword a_blt_mode, int
 	}
 
 	/* User regions don't need poking, test first. */
-	if (KW_NOBLT == a_blt_mode) {
+	{
 		struct User const *user;
 
 		TAILQ_FOREACH(user, &g_user_list, next) {
@@ -164,6 +465,7 @@ map_map(uint32_t a_address, size_t a_bytes, enum Keyword a_blt_mode, int
 				mapper->type = MAP_TYPE_USER;
 				mapper->address = a_address;
 				mapper->bytes = a_bytes;
+				mapper->mode = a_blt_mode;
 				mapper->private = user->ptr + a_address -
 				    user->address;
 				LOGF(verbose)(LOGL, "User mapping chosen "
@@ -302,6 +604,11 @@ void
 map_setup(void)
 {
 	LOGF(verbose)(LOGL, "map_setup {");
+#if DO_PTHREADS && !MAP_SICY_CONCURRENT
+	if (!thread_mutex_init(&g_backend_mutex)) {
+		log_die(LOGL, "Could not create backend mutex.");
+	}
+#endif
 	sicy_setup();
 	blt_setup();
 	LOGF(verbose)(LOGL, "Broken BLT return val = "
@@ -321,6 +628,9 @@ map_shutdown(void)
 	map_deinit();
 	blt_shutdown();
 	sicy_shutdown();
+#if DO_PTHREADS && !MAP_SICY_CONCURRENT
+	thread_mutex_clean(&g_backend_mutex);
+#endif
 	LOGF(verbose)(LOGL, "map_shutdown }");
 }
 
@@ -344,6 +654,10 @@ map_unmap(struct Map **a_mapper)
 		case MAP_TYPE_USER:
 			break;
 		}
+		if (NULL != mapper->shadow) {
+			FREE(mapper->shadow->array);
+			FREE(mapper->shadow);
+		}
 		FREE(*a_mapper);
 	}
 	LOGF(verbose)(LOGL, "map_unmap }");
@@ -378,28 +692,136 @@ map_user_clear(void)
 uint32_t
 mblt_swap(uint32_t *a_p32, size_t a_bytes)
 {
-	size_t i;
-
 	if (0 != (7 & a_bytes)) {
 		log_error(LOGL, "MBLT swap data size not 64-bit aligned!");
 		return CRATE_READOUT_FAIL_ERROR_DRIVER;
 	}
-	for (i = 0; i < a_bytes; i += 8) {
-		uint32_t swap;
+	simd_swap32(a_p32, a_bytes / sizeof *a_p32);
+	return 0;
+}
+#endif
 
-		swap = a_p32[0];
-		a_p32[0] = a_p32[1];
-		a_p32[1] = swap;
-		a_p32 += 2;
+struct MapBatch *
+map_sicy_batch_create(void)
+{
+	struct MapBatch *batch;
+
+	CALLOC(batch, 1);
+	VECTOR_INIT(&batch->op_vec);
+	return batch;
+}
+
+void
+map_sicy_batch_free(struct MapBatch **a_batch)
+{
+	struct MapBatch *batch;
+
+	batch = *a_batch;
+	if (NULL == batch) {
+		return;
 	}
-	return 0;
+	if (0 != batch->op_vec.size) {
+		log_error(LOGL, "Freeing batch with %"PRIz" unsubmitted "
+		    "accesses.", batch->op_vec.size);
+	}
+	VECTOR_FREE(&batch->op_vec);
+	FREE(*a_batch);
 }
+
+void
+map_sicy_batch_read(struct MapBatch *a_batch, struct Map *a_map, unsigned
+    a_mod, unsigned a_bits, size_t a_ofs, uint32_t *a_dst)
+{
+	struct MapBatchOp op;
+
+	ASSERT(unsigned, "u", 0, !=, a_mod & (MAP_MOD_R | MAP_MOD_r));
+	op.map = a_map;
+	op.ofs = a_ofs;
+	op.mod = a_mod;
+	op.bits = a_bits;
+	op.is_write = 0;
+	op.value = 0;
+	op.dst = a_dst;
+	VECTOR_APPEND(&a_batch->op_vec, op);
+}
+
+void
+map_sicy_batch_submit(struct MapBatch *a_batch)
+{
+	size_t i;
+
+	LOGF(spam)(LOGL, "map_sicy_batch_submit(%"PRIz") {",
+	    a_batch->op_vec.size);
+	for (i = 0; a_batch->op_vec.size > i;) {
+		struct MapBatchOp *op;
+
+		op = &a_batch->op_vec.array[i];
+#ifdef SICY_BATCH
+		if (MAP_TYPE_USER != op->map->type) {
+			size_t j;
+
+			/* Hand over the longest run of hardware accesses. */
+			for (j = i + 1; a_batch->op_vec.size > j; ++j) {
+				if (MAP_TYPE_USER ==
+				    a_batch->op_vec.array[j].map->type) {
+					break;
+				}
+			}
+			BACKEND_LOCK;
+			sicy_batch(op, j - i);
+			BACKEND_UNLOCK;
+			i = j;
+			continue;
+		}
 #endif
+		if (op->is_write) {
+			write_direct(op->map, op->bits, op->ofs, op->value);
+		} else {
+			*op->dst = map_sicy_read(op->map, MAP_MOD_R, op->bits,
+			    op->ofs);
+		}
+		++i;
+	}
+	/* The shadow follows what has reached the hardware. */
+	for (i = 0; a_batch->op_vec.size > i; ++i) {
+		struct MapBatchOp const *op;
+
+		op = &a_batch->op_vec.array[i];
+		if (op->is_write) {
+			shadow_update(op->map, op->mod, op->bits, op->ofs,
+			    op->value);
+		}
+	}
+	a_batch->op_vec.size = 0;
+	LOGF(spam)(LOGL, "map_sicy_batch_submit }");
+}
+
+void
+map_sicy_batch_write(struct MapBatch *a_batch, struct Map *a_map, unsigned
+    a_mod, unsigned a_bits, size_t a_ofs, uint32_t a_val)
+{
+	struct MapBatchOp op;
+
+	ASSERT(unsigned, "u", 0, !=, a_mod & MAP_MOD_W);
+	if (shadow_skip(a_map, a_mod, a_bits, a_ofs, a_val)) {
+		return;
+	}
+	op.map = a_map;
+	op.ofs = a_ofs;
+	op.mod = a_mod;
+	op.bits = a_bits;
+	op.is_write = 1;
+	op.value = a_val;
+	op.dst = NULL;
+	VECTOR_APPEND(&a_batch->op_vec, op);
+}
 
 uint32_t
 map_sicy_read(struct Map *a_map, unsigned a_mod, unsigned a_bits, size_t
     a_ofs)
 {
+	uint32_t value;
+
 	ASSERT(unsigned, "u", 0, !=, a_mod & (MAP_MOD_R | MAP_MOD_r));
 	if (MAP_TYPE_USER == a_map->type) {
 		uint8_t const *p8 = a_map->private;
@@ -410,11 +832,52 @@ map_sicy_read(struct Map *a_map, unsigned a_mod, unsigned a_bits, size_t
 		default: abort();
 		}
 	}
+	BACKEND_LOCK;
 	switch (a_bits) {
-	case 16: return sicy_r16(a_map, a_ofs);
-	case 32: return sicy_r32(a_map, a_ofs);
+	case 16: value = sicy_r16(a_map, a_ofs); break;
+	case 32: value = sicy_r32(a_map, a_ofs); break;
 	default: abort();
 	}
+	BACKEND_UNLOCK;
+	return value;
+}
+
+void
+map_sicy_shadow_enable(struct Map *a_map)
+{
+	struct MapShadow *shadow;
+
+	shadow = a_map->shadow;
+	if (NULL == shadow) {
+		CALLOC(shadow, 1);
+		a_map->shadow = shadow;
+	}
+	FREE(shadow->array);
+	shadow->capacity = 64;
+	CALLOC(shadow->array, shadow->capacity);
+	shadow->num = 0;
+	shadow->do_skip = 0;
+	shadow->issued_num = 0;
+	shadow->skipped_num = 0;
+}
+
+void
+map_sicy_shadow_get_stats(struct Map const *a_map, uint32_t *a_issued,
+    uint32_t *a_skipped)
+{
+	struct MapShadow const *shadow;
+
+	shadow = a_map->shadow;
+	*a_issued = NULL == shadow ? 0 : shadow->issued_num;
+	*a_skipped = NULL == shadow ? 0 : shadow->skipped_num;
+}
+
+void
+map_sicy_shadow_skip(struct Map *a_map, int a_yes)
+{
+	if (NULL != a_map->shadow) {
+		a_map->shadow->do_skip = a_yes;
+	}
 }
 
 void
@@ -422,6 +885,101 @@ map_sicy_write(struct Map *a_map, unsigned a_mod, unsigned a_bits, size_t
     a_ofs, uint32_t a_val)
 {
 	ASSERT(unsigned, "u", 0, !=, a_mod & MAP_MOD_W);
+	if (!shadow_skip(a_map, a_mod, a_bits, a_ofs, a_val)) {
+		write_direct(a_map, a_bits, a_ofs, a_val);
+		shadow_update(a_map, a_mod, a_bits, a_ofs, a_val);
+	}
+}
+
+/* Linear probing, the table is kept at most half full. */
+struct MapShadowEntry *
+shadow_find(struct MapShadow *a_shadow, size_t a_ofs)
+{
+	size_t i, mask;
+
+	mask = a_shadow->capacity - 1;
+	i = ((a_ofs >> 1) * 2654435761U) & mask;
+	for (;; i = (i + 1) & mask) {
+		struct MapShadowEntry *entry;
+
+		entry = &a_shadow->array[i];
+		if (0 == entry->key || a_ofs + 1 == entry->key) {
+			return entry;
+		}
+	}
+}
+
+/*
+ * Returns non-zero if the write can be skipped, only for registers that are
+ * readable and not actions.
+ */
+int
+shadow_skip(struct Map *a_map, unsigned a_mod, unsigned a_bits, size_t
+    a_ofs, uint32_t a_val)
+{
+	struct MapShadow *shadow;
+	struct MapShadowEntry const *entry;
+
+	shadow = a_map->shadow;
+	if (NULL == shadow || !shadow->do_skip || MAP_MOD_R != (a_mod &
+	    (MAP_MOD_R | MAP_MOD_A))) {
+		return 0;
+	}
+	entry = shadow_find(shadow, a_ofs);
+	if (0 == entry->key || a_bits != entry->bits || a_val !=
+	    entry->value) {
+		return 0;
+	}
+	++shadow->skipped_num;
+	return 1;
+}
+
+/* Records a write which has been issued to the hardware. */
+void
+shadow_update(struct Map *a_map, unsigned a_mod, unsigned a_bits, size_t
+    a_ofs, uint32_t a_val)
+{
+	struct MapShadow *shadow;
+	struct MapShadowEntry *entry;
+
+	shadow = a_map->shadow;
+	if (NULL == shadow) {
+		return;
+	}
+	++shadow->issued_num;
+	if (MAP_MOD_R != (a_mod & (MAP_MOD_R | MAP_MOD_A))) {
+		return;
+	}
+	entry = shadow_find(shadow, a_ofs);
+	if (0 == entry->key) {
+		if (2 * (shadow->num + 1) > shadow->capacity) {
+			struct MapShadowEntry *old;
+			size_t i, old_capacity;
+
+			old = shadow->array;
+			old_capacity = shadow->capacity;
+			shadow->capacity *= 2;
+			CALLOC(shadow->array, shadow->capacity);
+			for (i = 0; old_capacity > i; ++i) {
+				if (0 != old[i].key) {
+					*shadow_find(shadow, old[i].key - 1) =
+					    old[i];
+				}
+			}
+			FREE(old);
+			entry = shadow_find(shadow, a_ofs);
+		}
+		entry->key = a_ofs + 1;
+		++shadow->num;
+	}
+	entry->bits = a_bits;
+	entry->value = a_val;
+}
+
+void
+write_direct(struct Map *a_map, unsigned a_bits, size_t a_ofs, uint32_t
+    a_val)
+{
 	if (MAP_TYPE_USER == a_map->type) {
 		uint8_t *p8 = a_map->private;
 
@@ -431,10 +989,12 @@ map_sicy_write(struct Map *a_map, unsigned a_mod, unsigned a_bits, size_t
 		default: abort();
 		}
 	} else {
+		BACKEND_LOCK;
 		switch (a_bits) {
 		case 16: sicy_w16(a_map, a_ofs, a_val); break;
 		case 32: sicy_w32(a_map, a_ofs, a_val); break;
 		default: abort();
 		}
+		BACKEND_UNLOCK;
 	}
 }
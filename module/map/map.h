@@ -180,6 +180,7 @@ intptr_t	find_controller(uintptr_t, size_t, unsigned, unsigned,
 #	endif
 #	define POKE_CAEN
 #	define SICY_CAEN
+#	define SICY_BATCH
 #	define BLT_CAEN
 #       define BLT_DST_DUMB
 #elif NCONF_mMAP_bCAEN_VMELIB_ABSOLUTE
@@ -207,6 +208,7 @@ intptr_t	find_controller(uintptr_t, size_t, unsigned, unsigned,
 #	endif
 #	define POKE_CAEN
 #	define SICY_CAEN
+#	define SICY_BATCH
 #	define BLT_CAEN
 #       define BLT_DST_DUMB
 #elif NCONF_mMAP_bDUMB
@@ -216,6 +218,17 @@ intptr_t	find_controller(uintptr_t, size_t, unsigned, unsigned,
 #       define BLT_DST_DUMB
 #endif
 
+/*
+ * Single-cycle backends which only touch mapped memory can be used by
+ * several threads at once, controller libraries and sockets cannot and are
+ * serialized by a backend lock in map.c.
+ */
+#if defined(SICY_DIRECT) || defined(SICY_SMEM) || defined(SICY_DUMB)
+#	define MAP_SICY_CONCURRENT 1
+#else
+#	define MAP_SICY_CONCURRENT 0
+#endif
+
 #define MAP_SIZE_MAX(s) MAX(sizeof *(s).read, sizeof *(s).write)
 #define MAP_POKE_REG(reg) MOD_##reg, OFS_##reg, BITS_##reg
 #define MAP_READ_OFS(map, reg, ofs) \
@@ -224,9 +237,22 @@ intptr_t	find_controller(uintptr_t, size_t, unsigned, unsigned,
 	map_sicy_write(map, MOD_##reg, BITS_##reg, OFS_##reg + (ofs), val)
 #define MAP_READ(map, reg) MAP_READ_OFS(map, reg, 0)
 #define MAP_WRITE(map, reg, val) MAP_WRITE_OFS(map, reg, 0, val)
+#define MAP_BATCH_READ_OFS(batch, map, reg, ofs, dst) \
+	map_sicy_batch_read(batch, map, MOD_##reg, BITS_##reg, \
+	    OFS_##reg + (ofs), dst)
+#define MAP_BATCH_WRITE_OFS(batch, map, reg, ofs, val) \
+	map_sicy_batch_write(batch, map, MOD_##reg, BITS_##reg, \
+	    OFS_##reg + (ofs), val)
+#define MAP_BATCH_READ(batch, map, reg, dst) \
+	MAP_BATCH_READ_OFS(batch, map, reg, 0, dst)
+#define MAP_BATCH_WRITE(batch, map, reg, val) \
+	MAP_BATCH_WRITE_OFS(batch, map, reg, 0, val)
 
 struct Map;
+struct MapBatch;
+struct MapBltAsync;
 struct MapBltDst;
+struct MapBltPool;
 
 /*
  * Aligns pointer and size in bytes according to BLT keyword i.e. some
@@ -243,6 +269,34 @@ uint32_t		map_sicy_read(struct Map *, unsigned, unsigned,
 void			map_sicy_write(struct Map *, unsigned, unsigned,
     size_t, uint32_t);
 
+/*
+ * Batched single-cycle access, queued accesses are performed in order on
+ * submit with as few controller transactions as the backend allows, e.g.
+ * CAEN multi-cycle calls. Read slots are filled in by the submit, and the
+ * batch is empty and reusable afterwards.
+ */
+struct MapBatch		*map_sicy_batch_create(void) FUNC_RETURNS;
+void			map_sicy_batch_free(struct MapBatch **);
+void			map_sicy_batch_read(struct MapBatch *, struct Map *,
+    unsigned, unsigned, size_t, uint32_t *);
+void			map_sicy_batch_submit(struct MapBatch *);
+void			map_sicy_batch_write(struct MapBatch *, struct Map *,
+    unsigned, unsigned, size_t, uint32_t);
+
+/*
+ * Write-through shadow of the registers written via single-cycle access,
+ * so that re-running an init does not touch registers which already hold
+ * the requested value. Only registers that are both readable and writable
+ * are shadowed, write-only registers are typically actions and always
+ * written, as are readable actions marked 'A' in the register list.
+ * Batched writes update the shadow on submit. Enabling drops the shadow
+ * and clears the counters, skipping is off until requested.
+ */
+void			map_sicy_shadow_enable(struct Map *);
+void			map_sicy_shadow_get_stats(struct Map const *,
+    uint32_t *, uint32_t *);
+void			map_sicy_shadow_skip(struct Map *, int);
+
 /*
  * Destination memory for BLT, currently for shadow mode where the DAQ backend
  * typically does not provide such aux storage. Can be used by user-code
@@ -252,6 +306,23 @@ struct MapBltDst	*map_blt_dst_alloc(size_t) FUNC_RETURNS;
 void			map_blt_dst_free(struct MapBltDst **);
 void			*map_blt_dst_get(struct MapBltDst *) FUNC_RETURNS;
 
+/*
+ * Pool of DMA destination chunks carved from one 'map_blt_dst', e.g. one
+ * chunk per module and event. Chunks are aligned for every BLT mode so
+ * 'map_align' adds no filler words, and 'reset' recycles all chunks at
+ * once without touching the system.
+ *  'get' returns NULL when the pool is exhausted.
+ *  'has' tells if the pointer lies inside the pool.
+ */
+#define MAP_BLT_POOL_ALIGN 64
+struct MapBltPool	*map_blt_pool_create(size_t) FUNC_RETURNS;
+void			map_blt_pool_free(struct MapBltPool **);
+void			*map_blt_pool_get(struct MapBltPool *, size_t)
+	FUNC_RETURNS;
+int			map_blt_pool_has(struct MapBltPool const *, void
+    const *) FUNC_RETURNS;
+void			map_blt_pool_reset(struct MapBltPool *);
+
 /*
  * Performs BLT read at an offset.
  *  arg0 = map from map_map.
@@ -267,6 +338,26 @@ int			map_blt_read(struct Map *, size_t, void *, size_t)
 int			map_blt_read_berr(struct Map *, size_t, void *,
     size_t) FUNC_RETURNS;
 
+/*
+ * Asynchronous BLT, one transfer in flight per handle.
+ * 'submit' takes the same arguments as 'map_blt_read' plus the bus-error
+ * flag and returns at once, 'poll' returns non-zero when the transfer has
+ * completed, and 'wait' blocks until then and returns what the blocking
+ * call would have. The driver call runs in a helper thread of the handle,
+ * or directly in 'submit' without thread support.
+ * NOTE: Controller libraries are serialized by the backend lock, but other
+ * DMA drivers may not be thread-safe, so do not touch the same module until
+ * the transfer has completed.
+ */
+struct MapBltAsync	*map_blt_async_create(void) FUNC_RETURNS;
+void			map_blt_async_free(struct MapBltAsync **);
+int			map_blt_async_poll(struct MapBltAsync *)
+	FUNC_RETURNS;
+void			map_blt_async_submit(struct MapBltAsync *, struct Map
+    *, size_t, void *, size_t, int);
+int			map_blt_async_wait(struct MapBltAsync *)
+	FUNC_RETURNS;
+
 /* Cleans up global resources allocated by 'map_map'. */
 void			map_deinit(void);
 struct Map		*map_map(uint32_t, size_t, enum Keyword, int, int,
@@ -296,6 +387,8 @@ void			map_unmap(struct Map **);
  * 'map' is not overridden with the user region since it's too small for the
  * requested mapping.
  *
+ * BLT mappings of a user region are served with plain copies.
+ *
  * In case user regions overlap, the first added region will be chosen. The
  * given memory is the user's responsibility and will not be freed.
  */
@@ -30,6 +30,7 @@
 #	include <nurdlib/base.h>
 #	include <nurdlib/config.h>
 #	include <nurdlib/log.h>
+#	include <util/fmtmod.h>
 #	include <util/string.h>
 #	include <util/time.h>
 
@@ -52,6 +53,9 @@
 	} while (0)
 #	define CALL(func, args, label) CALL_(func, args, label, 0, cvSuccess)
 
+/* Accesses per multi-cycle call. */
+#	define BATCH_MAX 64
+
 #define TYPE(name) { cv##name, #name }
 struct BoardType {
 	CVBoardTypes type;
@@ -209,6 +213,62 @@ fail:
 	log_die(LOGL, "CAEN init failed.");
 }
 
+/*
+ * Consecutive reads or writes go out as one CAEN multi-cycle call, the
+ * controller then does the round trips.
+ */
+void
+sicy_batch(struct MapBatchOp *a_op, size_t a_num)
+{
+	uint32_t addr[BATCH_MAX];
+	uint32_t data[BATCH_MAX];
+	CVAddressModifier am[BATCH_MAX];
+	CVDataWidth dw[BATCH_MAX];
+	CVErrorCodes ec[BATCH_MAX];
+	size_t i, j, n;
+	int is_write;
+
+	for (i = 0; a_num > i; i += n) {
+		is_write = a_op[i].is_write;
+		for (n = 0; a_num > i + n && BATCH_MAX > n &&
+		    is_write == a_op[i + n].is_write; ++n) {
+			struct MapBatchOp const *op;
+
+			op = &a_op[i + n];
+			addr[n] = op->map->address + op->ofs;
+			data[n] = op->value;
+			am[n] = cvA32_U_DATA;
+			dw[n] = 16 == op->bits ? cvD16 : cvD32;
+		}
+		if (is_write) {
+			CALL(CAENVME_MultiWrite, (g_handle, addr, data, n, am,
+			    dw, ec), fail);
+		} else {
+			CALL(CAENVME_MultiRead, (g_handle, addr, data, n, am,
+			    dw, ec), fail);
+		}
+		for (j = 0; n > j; ++j) {
+			struct MapBatchOp const *op;
+
+			op = &a_op[i + j];
+			if (cvSuccess != ec[j]) {
+				log_error(LOGL, "Failed %s addr=0x%08x "
+				    "ofs=0x%x: %d=%s.", is_write ? "writing" :
+				    "reading", (uint32_t)op->map->address,
+				    (uint32_t)op->ofs, ec[j],
+				    CAENVME_DecodeError(ec[j]));
+			}
+			if (!is_write) {
+				*op->dst = 16 == op->bits ?
+				    (uint16_t)data[j] : data[j];
+			}
+		}
+	}
+	return;
+fail:
+	log_error(LOGL, "Failed batch of %"PRIz" accesses.", a_num);
+}
+
 void
 sicy_deinit()
 {
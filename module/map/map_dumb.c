@@ -138,8 +138,11 @@ UNMAP_FUNC_EMPTY(blt);
 
 #ifdef BLT_DST_DUMB
 
+#	include <util/hugepage.h>
+
 struct MapBltDst {
 	void	*ptr;
+	size_t	bytes;
 };
 
 struct MapBltDst *
@@ -148,10 +151,8 @@ map_blt_dst_alloc(size_t a_bytes)
 	struct MapBltDst *dst;
 
 	CALLOC(dst, 1);
-	dst->ptr = malloc(a_bytes);
-	if (NULL == dst->ptr) {
-		log_err(LOGL, "malloc(%"PRIz")", a_bytes);
-	}
+	dst->bytes = a_bytes;
+	dst->ptr = hugepage_alloc(&dst->bytes);
 	return dst;
 }
 
@@ -162,7 +163,7 @@ map_blt_dst_free(struct MapBltDst **a_dst)
 
 	dst = *a_dst;
 	if (dst) {
-		FREE(dst->ptr);
+		hugepage_free(dst->ptr, dst->bytes);
 		FREE(*a_dst);
 	}
 }
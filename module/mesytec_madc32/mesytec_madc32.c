@@ -34,6 +34,8 @@
 #define NAME "Mesytec Madc32"
 
 MODULE_PROTOTYPES(mesytec_madc32);
+static int	mesytec_madc32_clear(struct Crate *, struct Module *)
+	FUNC_RETURNS;
 static int	mesytec_madc32_post_init(struct Crate *, struct Module *)
 	FUNC_RETURNS;
 static uint32_t	mesytec_madc32_readout_shadow(struct Crate *, struct Module *,
@@ -58,6 +60,16 @@ mesytec_madc32_check_empty(struct Module *a_module)
 	return mesytec_mxdc32_check_empty(&madc32->mxdc32);
 }
 
+int
+mesytec_madc32_clear(struct Crate *a_crate, struct Module *a_module)
+{
+	struct MesytecMadc32Module *madc32;
+
+	(void)a_crate;
+	MODULE_CAST(KW_MESYTEC_MADC32, madc32, a_module);
+	return mesytec_mxdc32_clear(&madc32->mxdc32);
+}
+
 struct Module *
 mesytec_madc32_create_(struct Crate *a_crate, struct ConfigBlock *a_block)
 {
@@ -359,6 +371,7 @@ void
 mesytec_madc32_setup_(void)
 {
 	MODULE_SETUP(mesytec_madc32, MODULE_FLAG_EARLY_DT);
+	MODULE_CALLBACK_BIND(mesytec_madc32, clear);
 	MODULE_CALLBACK_BIND(mesytec_madc32, post_init);
 	MODULE_CALLBACK_BIND(mesytec_madc32, readout_shadow);
 	MODULE_CALLBACK_BIND(mesytec_madc32, use_pedestals);
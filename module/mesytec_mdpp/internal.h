@@ -60,6 +60,8 @@ struct Map	*mesytec_mdpp_get_map(struct MesytecMdppModule *)
 	FUNC_RETURNS;
 void		mesytec_mdpp_get_signature(struct ModuleSignature const **,
     size_t *);
+size_t		mesytec_mdpp_hit_next(struct EventConstBuffer const *,
+    uint64_t *) FUNC_RETURNS;
 void		mesytec_mdpp_init_fast(struct Crate *, struct
     MesytecMdppModule *);
 void		mesytec_mdpp_init_slow(struct Crate const *, struct
@@ -104,6 +104,46 @@ mesytec_mdpp_get_signature(struct ModuleSignature const **a_array, size_t
 	MODULE_SIGNATURE_END(a_array, a_num)
 }
 
+/*
+ * One hit is header + data + EOE, the EOE holds the low 30 timestamp bits
+ * and an optional extended timestamp word the high 16 bits.
+ */
+size_t
+mesytec_mdpp_hit_next(struct EventConstBuffer const *a_event_buffer,
+    uint64_t *a_ts)
+{
+	uint32_t const *p32;
+	uint64_t ts;
+	size_t words;
+	unsigned i, len;
+
+	p32 = a_event_buffer->ptr;
+	words = a_event_buffer->bytes / sizeof *p32;
+	if (0 == words) {
+		return 0;
+	}
+	if (DMA_FILLER == p32[0] || 0 == p32[0]) {
+		*a_ts = MODULE_HIT_SKIP;
+		return sizeof *p32;
+	}
+	if (0x40000000 != (0xc0000000 & p32[0])) {
+		return 0;
+	}
+	len = 0x3ff & p32[0];
+	if (0 == len || words < 1 + len ||
+	    0xc0000000 != (0xc0000000 & p32[len])) {
+		return 0;
+	}
+	ts = 0x3fffffff & p32[len];
+	for (i = 1; i < len; ++i) {
+		if (0x20000000 == (0xf0000000 & p32[i])) {
+			ts |= (uint64_t)(0xffff & p32[i]) << 30;
+		}
+	}
+	*a_ts = ts;
+	return (1 + len) * sizeof *p32;
+}
+
 void
 mesytec_mdpp_init_fast(struct Crate *a_crate, struct MesytecMdppModule
     *a_mdpp)
@@ -31,6 +31,8 @@
 #define NAME "Mesytec Mdpp16 QDC"
 
 MODULE_PROTOTYPES(mesytec_mdpp16qdc);
+static size_t	mesytec_mdpp16qdc_hit_next(struct Module *, struct
+    EventConstBuffer const *, uint64_t *);
 /*static void	mesytec_mdpp16qdc_use_pedestals(struct Module *);
 static void	mesytec_mdpp16qdc_zero_suppress(struct Module *, int);*/
 
@@ -96,6 +98,14 @@ mesytec_mdpp16qdc_get_signature(struct ModuleSignature const **a_array, size_t
 	mesytec_mdpp_get_signature(a_array, a_num);
 }
 
+size_t
+mesytec_mdpp16qdc_hit_next(struct Module *a_module, struct
+    EventConstBuffer const *a_event_buffer, uint64_t *a_ts)
+{
+	(void)a_module;
+	return mesytec_mdpp_hit_next(a_event_buffer, a_ts);
+}
+
 int
 mesytec_mdpp16qdc_init_fast(struct Crate *a_crate, struct Module *a_module)
 {
@@ -207,6 +217,7 @@ void
 mesytec_mdpp16qdc_setup_(void)
 {
 	MODULE_SETUP(mesytec_mdpp16qdc, 0);
+	MODULE_CALLBACK_BIND(mesytec_mdpp16qdc, hit_next);
 	/*MODULE_CALLBACK_BIND(mesytec_mdpp16qdc, readout_shadow);
 	MODULE_CALLBACK_BIND(mesytec_mdpp16qdc, use_pedestals);
 	MODULE_CALLBACK_BIND(mesytec_mdpp16qdc, zero_suppress);*/
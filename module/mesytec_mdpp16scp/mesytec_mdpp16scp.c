@@ -35,6 +35,8 @@
 #define NAME "Mesytec Mdpp16 SCP"
 
 MODULE_PROTOTYPES(mesytec_mdpp16scp);
+static size_t	mesytec_mdpp16scp_hit_next(struct Module *, struct
+    EventConstBuffer const *, uint64_t *);
 static int	mesytec_mdpp16scp_post_init(struct Crate *, struct Module *)
 	FUNC_RETURNS;
 static uint32_t	mesytec_mdpp16scp_readout_shadow(struct Crate *, struct Module
@@ -112,6 +114,14 @@ mesytec_mdpp16scp_get_signature(struct ModuleSignature const **a_array, size_t
 	mesytec_mdpp_get_signature(a_array, a_num);
 }
 
+size_t
+mesytec_mdpp16scp_hit_next(struct Module *a_module, struct
+    EventConstBuffer const *a_event_buffer, uint64_t *a_ts)
+{
+	(void)a_module;
+	return mesytec_mdpp_hit_next(a_event_buffer, a_ts);
+}
+
 int
 mesytec_mdpp16scp_init_fast(struct Crate *a_crate, struct Module *a_module)
 {
@@ -352,6 +362,7 @@ void
 mesytec_mdpp16scp_setup_(void)
 {
 	MODULE_SETUP(mesytec_mdpp16scp, MODULE_FLAG_EARLY_DT);
+	MODULE_CALLBACK_BIND(mesytec_mdpp16scp, hit_next);
 	MODULE_CALLBACK_BIND(mesytec_mdpp16scp, post_init);
 	MODULE_CALLBACK_BIND(mesytec_mdpp16scp, readout_shadow);
 	MODULE_CALLBACK_BIND(mesytec_mdpp16scp, use_pedestals);
@@ -32,6 +32,8 @@
 #define NAME "Mesytec Mdpp32 QDC"
 
 MODULE_PROTOTYPES(mesytec_mdpp32qdc);
+static size_t	mesytec_mdpp32qdc_hit_next(struct Module *, struct
+    EventConstBuffer const *, uint64_t *);
 static int	mesytec_mdpp32qdc_post_init(struct Crate *, struct Module *)
 	FUNC_RETURNS;
 
@@ -96,6 +98,14 @@ mesytec_mdpp32qdc_get_signature(struct ModuleSignature const **a_array, size_t
 	mesytec_mdpp_get_signature(a_array, a_num);
 }
 
+size_t
+mesytec_mdpp32qdc_hit_next(struct Module *a_module, struct
+    EventConstBuffer const *a_event_buffer, uint64_t *a_ts)
+{
+	(void)a_module;
+	return mesytec_mdpp_hit_next(a_event_buffer, a_ts);
+}
+
 int
 mesytec_mdpp32qdc_init_fast(struct Crate *a_crate, struct Module *a_module)
 {
@@ -256,5 +266,6 @@ void
 mesytec_mdpp32qdc_setup_(void)
 {
 	MODULE_SETUP(mesytec_mdpp32qdc, MODULE_FLAG_EARLY_DT);
+	MODULE_CALLBACK_BIND(mesytec_mdpp32qdc, hit_next);
 	MODULE_CALLBACK_BIND(mesytec_mdpp32qdc, post_init);
 }
@@ -32,6 +32,8 @@
 #define NAME "Mesytec Mdpp32 SCP"
 
 MODULE_PROTOTYPES(mesytec_mdpp32scp);
+static size_t	mesytec_mdpp32scp_hit_next(struct Module *, struct
+    EventConstBuffer const *, uint64_t *);
 static int	mesytec_mdpp32scp_post_init(struct Crate *, struct Module *)
 	FUNC_RETURNS;
 static uint32_t	mesytec_mdpp32scp_readout_shadow(struct Crate *, struct Module
@@ -109,6 +111,14 @@ mesytec_mdpp32scp_get_signature(struct ModuleSignature const **a_array, size_t
 	mesytec_mdpp_get_signature(a_array, a_num);
 }
 
+size_t
+mesytec_mdpp32scp_hit_next(struct Module *a_module, struct
+    EventConstBuffer const *a_event_buffer, uint64_t *a_ts)
+{
+	(void)a_module;
+	return mesytec_mdpp_hit_next(a_event_buffer, a_ts);
+}
+
 int
 mesytec_mdpp32scp_init_fast(struct Crate *a_crate, struct Module *a_module)
 {
@@ -387,6 +397,7 @@ void
 mesytec_mdpp32scp_setup_(void)
 {
 	MODULE_SETUP(mesytec_mdpp32scp, MODULE_FLAG_EARLY_DT);
+	MODULE_CALLBACK_BIND(mesytec_mdpp32scp, hit_next);
 	MODULE_CALLBACK_BIND(mesytec_mdpp32scp, post_init);
 	MODULE_CALLBACK_BIND(mesytec_mdpp32scp, readout_shadow);
 	MODULE_CALLBACK_BIND(mesytec_mdpp32scp, use_pedestals);
@@ -34,6 +34,8 @@
 #define NAME "Mesytec Mqdc32"
 
 MODULE_PROTOTYPES(mesytec_mqdc32);
+static int	mesytec_mqdc32_clear(struct Crate *, struct Module *)
+	FUNC_RETURNS;
 static int	mesytec_mqdc32_post_init(struct Crate *, struct Module *);
 static void	mesytec_mqdc32_use_pedestals(struct Module *);
 static void	mesytec_mqdc32_zero_suppress(struct Module *, int);
@@ -48,6 +50,16 @@ mesytec_mqdc32_check_empty(struct Module *a_module)
 	return mesytec_mxdc32_check_empty(&mqdc32->mxdc32);
 }
 
+int
+mesytec_mqdc32_clear(struct Crate *a_crate, struct Module *a_module)
+{
+	struct MesytecMqdc32Module *mqdc32;
+
+	(void)a_crate;
+	MODULE_CAST(KW_MESYTEC_MQDC32, mqdc32, a_module);
+	return mesytec_mxdc32_clear(&mqdc32->mxdc32);
+}
+
 struct Module *
 mesytec_mqdc32_create_(struct Crate *a_crate, struct ConfigBlock *a_block)
 {
@@ -241,6 +253,7 @@ void
 mesytec_mqdc32_setup_(void)
 {
 	MODULE_SETUP(mesytec_mqdc32, 0);
+	MODULE_CALLBACK_BIND(mesytec_mqdc32, clear);
 	MODULE_CALLBACK_BIND(mesytec_mqdc32, post_init);
 	MODULE_CALLBACK_BIND(mesytec_mqdc32, use_pedestals);
 	MODULE_CALLBACK_BIND(mesytec_mqdc32, zero_suppress);
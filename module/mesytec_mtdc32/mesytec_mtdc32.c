@@ -35,6 +35,8 @@
 #define NAME "Mesytec Mtdc32"
 
 MODULE_PROTOTYPES(mesytec_mtdc32);
+static int	mesytec_mtdc32_clear(struct Crate *, struct Module *)
+	FUNC_RETURNS;
 static int	mesytec_mtdc32_post_init(struct Crate *, struct Module *);
 
 static uint32_t	mesytec_mtdc32_readout_shadow(struct Crate *, struct Module *,
@@ -57,6 +59,16 @@ mesytec_mtdc32_check_empty(struct Module *a_module)
 	return mesytec_mxdc32_check_empty(&mtdc32->mxdc32);
 }
 
+int
+mesytec_mtdc32_clear(struct Crate *a_crate, struct Module *a_module)
+{
+	struct MesytecMtdc32Module *mtdc32;
+
+	(void)a_crate;
+	MODULE_CAST(KW_MESYTEC_MTDC32, mtdc32, a_module);
+	return mesytec_mxdc32_clear(&mtdc32->mxdc32);
+}
+
 struct Module *
 mesytec_mtdc32_create_(struct Crate *a_crate, struct ConfigBlock *a_block)
 {
@@ -323,6 +335,7 @@ void
 mesytec_mtdc32_setup_(void)
 {
 	MODULE_SETUP(mesytec_mtdc32, 0);
+	MODULE_CALLBACK_BIND(mesytec_mtdc32, clear);
 	MODULE_CALLBACK_BIND(mesytec_mtdc32, post_init);
 	MODULE_CALLBACK_BIND(mesytec_mtdc32, readout_shadow);
 #if NCONF_mMAP_bCMVLC
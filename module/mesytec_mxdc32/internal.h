@@ -96,6 +96,8 @@ struct MesytecMxdc32Module {
 
 uint32_t	mesytec_mxdc32_check_empty(struct MesytecMxdc32Module *)
 	FUNC_RETURNS;
+int		mesytec_mxdc32_clear(struct MesytecMxdc32Module *)
+	FUNC_RETURNS;
 void		mesytec_mxdc32_create(struct ConfigBlock const *, struct
     MesytecMxdc32Module *);
 void		mesytec_mxdc32_deinit(struct MesytecMxdc32Module *);
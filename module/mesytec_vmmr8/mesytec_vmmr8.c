@@ -33,6 +33,8 @@
 #define NAME "Mesytec VMMR8"
 
 MODULE_PROTOTYPES(mesytec_vmmr8);
+static int	mesytec_vmmr8_clear(struct Crate *, struct Module *)
+	FUNC_RETURNS;
 static int	mesytec_vmmr8_post_init(struct Crate *, struct Module *)
 	FUNC_RETURNS;
 static uint32_t	mesytec_vmmr8_readout_shadow(struct Crate *, struct Module *,
@@ -55,6 +57,16 @@ mesytec_vmmr8_check_empty(struct Module *a_module)
 	return mesytec_mxdc32_check_empty(&vmmr8->mxdc32);
 }
 
+int
+mesytec_vmmr8_clear(struct Crate *a_crate, struct Module *a_module)
+{
+	struct MesytecVmmr8Module *vmmr8;
+
+	(void)a_crate;
+	MODULE_CAST(KW_MESYTEC_VMMR8, vmmr8, a_module);
+	return mesytec_mxdc32_clear(&vmmr8->mxdc32);
+}
+
 struct Module *
 mesytec_vmmr8_create_(struct Crate *a_crate, struct ConfigBlock *a_block)
 {
@@ -437,6 +449,7 @@ void
 mesytec_vmmr8_setup_(void)
 {
 	MODULE_SETUP(mesytec_vmmr8, MODULE_FLAG_EARLY_DT);
+	MODULE_CALLBACK_BIND(mesytec_vmmr8, clear);
 	MODULE_CALLBACK_BIND(mesytec_vmmr8, post_init);
 	MODULE_CALLBACK_BIND(mesytec_vmmr8, readout_shadow);
 #if NCONF_mMAP_bCMVLC
@@ -198,6 +198,8 @@ module_create(struct Crate *a_crate, enum Keyword a_module_type, struct
 		if (a_module_type == e->type) {
 			enum Keyword c_log_levels[] = {KW_OFF, KW_INFO,
 				KW_VERBOSE, KW_DEBUG, KW_SPAM};
+			enum Keyword c_verify_levels[] = {KW_BUDGET, KW_FULL,
+				KW_HEADER, KW_NTH};
 			struct Module *module;
 			enum Keyword log_level;
 
@@ -212,6 +214,21 @@ module_create(struct Crate *a_crate, enum Keyword a_module_type, struct
 			    log_level_get_from_keyword(log_level);
 			module->skip_dt = config_get_boolean(a_config_block,
 			    KW_SKIP_DT);
+			module->do_write_cache = config_get_boolean(
+			    a_config_block, KW_WRITE_CACHE);
+			module->verify.level = CONFIG_GET_KEYWORD(
+			    a_config_block, KW_VERIFY_LEVEL, c_verify_levels);
+			module->verify.nth = config_get_int32(a_config_block,
+			    KW_VERIFY_NTH, CONFIG_UNIT_NONE, 1, 1000000);
+			module->verify.budget_s = 1e-6 * config_get_int32(
+			    a_config_block, KW_VERIFY_BUDGET, CONFIG_UNIT_US,
+			    0, 1000000);
+			if (KW_FULL != module->verify.level &&
+			    !module->verify.has_shallow) {
+				LOGF(info)(LOGL, "%s: No shallow parse, "
+				    "verify_level ignored.",
+				    keyword_get_string(a_module_type));
+			}
 			return module;
 		}
 	}
@@ -33,6 +33,7 @@
 #include <util/queue.h>
 #include <util/stdint.h>
 #include <util/thread.h>
+#include <util/time.h>
 
 #define MODULE_CAST(type_kw, dst, src) do {\
 	ASSERT(int, "d", type_kw, ==, (src)->type);\
@@ -104,6 +105,9 @@ enum {
 	MODULE_FLAG_EARLY_DT = 1
 };
 
+/* 'hit_next' timestamp for data to step over, e.g. headers and fillers. */
+#define MODULE_HIT_SKIP (~(uint64_t)0)
+
 struct ConfigBlock;
 struct Crate;
 struct Module;
@@ -124,6 +128,14 @@ struct ModuleProps {
 	 *  return 0 = empty, otherwise crate readout error bitmask.
 	 */
 	uint32_t	(*check_empty)(struct Module *) FUNC_RETURNS;
+	/*
+	 * 'clear' drops buffered data and readout state without a full
+	 * re-init, so the crate can recover quickly from readout errors. The
+	 * event counter must be up to date afterwards, it is relatched.
+	 * Optional, modules without it are recovered by 'deinit' + 'init'.
+	 *  return 0 = failed.
+	 */
+	int	(*clear)(struct Crate *, struct Module *) FUNC_RETURNS;
 	/*
 	 * 'deinit' undoes 'init', i.e. releases hardware resources.
 	 */
@@ -152,6 +164,16 @@ struct ModuleProps {
 	 * (depending on active tags) require a barrier to distinguish them.
 	 */
 	void	(*get_signature)(struct ModuleSignature const **, size_t *);
+	/*
+	 * 'hit_next' splits free-running data into time-stamped hits for the
+	 * time-sorted crate merger, optional. Called in sequence over the
+	 * module data with the buffer starting at the next hit, sets the hit
+	 * timestamp in module clock ticks, or MODULE_HIT_SKIP for non-hit
+	 * words.
+	 *  return = # bytes of the hit, 0 = corrupt data.
+	 */
+	size_t	(*hit_next)(struct Module *, struct EventConstBuffer const *,
+	    uint64_t *) FUNC_RETURNS;
 	/*
 	 * 'init_fast' runs "fast" initialization of the module hardware,
 	 * always after 'init_slow' but also after a nurdctrl re-config.
@@ -215,6 +237,16 @@ struct ModuleProps {
 	 */
 	uint32_t	(*readout_shadow)(struct Crate *, struct Module *,
 	    struct EventBuffer *) FUNC_RETURNS;
+	/*
+	 * 'readout_submit' starts the transfer of the module data into the
+	 * given buffer without waiting for it, e.g. an async BLT, and is only
+	 * used for pipelined readout. The buffer must not be advanced, the
+	 * following 'readout' with the same buffer completes the transfer and
+	 * must also work without a submit. Optional.
+	 *  return = crate readout fail bits, 'readout' is skipped on failure.
+	 */
+	uint32_t	(*readout_submit)(struct Crate *, struct Module *,
+	    struct EventBuffer *) FUNC_RETURNS;
 	/*
 	 * 'register_list_pack' does custom reading of hardware registers,
 	 * when the built-in nurdlib approach doesn't cut it.
@@ -268,9 +300,34 @@ struct ModuleProps {
 };
 
 TAILQ_HEAD(ModuleList, Module);
-struct ModuleShadowBuffer {
+/* Where Module.eb_final lives, segmented readout may leave data elsewhere. */
+enum ModuleEbFinalPlace {
+	/* Contiguous inside the event buffer. */
+	EB_FINAL_EVENT_BUFFER,
+	/* Contiguous outside, e.g. a pooled DMA chunk or a shadow ring. */
+	EB_FINAL_OUTSIDE,
+	/* Spread over several segments, only the size is kept. */
+	EB_FINAL_SEGMENTS
+};
+/*
+ * Shadow data ring, the shadow thread is the only producer and moves
+ * "head", the readout is the only consumer and moves "tail". Positions wrap
+ * at twice the store size, so they never overflow and a full ring differs
+ * from an empty one.
+ */
+struct ModuleShadowRing {
 	struct	EventBuffer store;
-	struct	EventBuffer eb;
+	size_t	head;
+	size_t	tail;
+	/* Consumer scan position, counter at that position, and event end. */
+	size_t	scan;
+	uint32_t	scan_counter;
+	size_t	cut;
+	/* Largest record written, only touched by the producer. */
+	size_t	rec_max;
+	/* Set by the producer when out of room, counted by the consumer. */
+	int	is_full;
+	unsigned	full_streak;
 };
 struct Module {
 	enum	Keyword type;
@@ -279,13 +336,18 @@ struct Module {
 	unsigned	event_max;
 	/* Some modules/modes may be ok without checking status under dt. */
 	unsigned	skip_dt;
+	/* Skip unchanged register writes when re-running init_fast. */
+	int	do_write_cache;
 	struct	ConfigBlock *config;
 	struct	LogLevel const *log_level;
+	/* Set by the crate while 'log_level' is on the log level stack. */
+	int	log_level_is_pushed;
 	struct {
-		struct	Mutex buf_mutex;
-		size_t	buf_idx;
-		struct	ModuleShadowBuffer buf[2];
+		struct	ModuleShadowRing ring;
 		uint32_t	data_counter_value;
+		/* High-water marks of event size and ring fill. */
+		size_t	max_bytes;
+		size_t	fill_max;
 	} shadow;
 	struct {
 		size_t	array_len;
@@ -296,12 +358,43 @@ struct Module {
 	/* Counter reference owned by crate. */
 	struct	Counter const *crate_counter;
 	uint32_t	crate_counter_prev;
+	/* Largest bytes/event since the last event_max_auto adjustment. */
+	size_t	event_bytes_max;
 	/* Diff of crate_counter - event_counter at init. */
 	uint32_t	this_minus_crate;
 	/* Accumulated result bits since last readout. */
 	uint32_t	result;
+	/* Failed and waiting for a 'clear' in dt. */
+	int	do_clear;
 	/* Will hold the final location of the event data. */
 	struct	EventConstBuffer eb_final;
+	enum	ModuleEbFinalPlace eb_final_place;
+	/* Verification policy for parse_data. */
+	struct {
+		enum	Keyword level;
+		unsigned	nth;
+		double	budget_s;
+		/* Set in create by modules whose parse_data honours it. */
+		int	has_shallow;
+		/* Set for a header/footer-only parse. */
+		int	is_shallow;
+		double	spent_s;
+		uint32_t	full_num;
+		uint32_t	shallow_num;
+	} verify;
+	/* Time per event in readout_dt, readout and parse_data. */
+	struct {
+		struct	TimeStat readout_dt;
+		struct	TimeStat readout;
+		struct	TimeStat parse;
+	} dt_stat;
+	/* Event counter polling in readout_dt. */
+	struct {
+		/* # of readout_dt calls for the latest event. */
+		unsigned	num;
+		/* Learned time until the module has the event, in s. */
+		double	latency;
+	} poll;
 	TAILQ_ENTRY(Module)	next;
 };
 struct ModuleListEntry {
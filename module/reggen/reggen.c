@@ -436,6 +436,13 @@ main(int argc, char **argv)
 		if (strstr(p, "W")) {
 			mod |= MAP_MOD_W;
 		}
+		if (strstr(p, "A")) {
+			if (0 == (MAP_MOD_W & mod)) {
+				die("%s:%d: 'A' register modifier needs 'W'.",
+				    g_path_in, line_no);
+			}
+			mod |= MAP_MOD_A;
+		}
 
 		/* Name. */
 		name[0] = '\0';
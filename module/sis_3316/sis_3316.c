@@ -124,6 +124,7 @@ enum Sis3316FsmMode {SIS3316_FSM_READ, SIS3316_FSM_WRITE};
 int g_n_channels;
 
 MODULE_PROTOTYPES(sis_3316);
+static int sis_3316_clear(struct Crate *, struct Module *) FUNC_RETURNS;
 static uint32_t sis_3316_readout_shadow(struct Crate *, struct Module *,
     struct EventBuffer *) FUNC_RETURNS;
 void sis_3316_swap_banks(struct Sis3316Module*);
@@ -186,6 +187,31 @@ sis_3316_check_empty(struct Module *a_module)
 	/* log_die(LOGL, NAME" check_empty not implemented!"); */
 }
 
+/*
+ * Drops both banks by re-arming from scratch like post_init, but keeps the
+ * timestamp running.
+ */
+int
+sis_3316_clear(struct Crate *a_crate, struct Module *a_module)
+{
+	struct Sis3316Module *m;
+	(void) a_crate;
+
+	LOGF(verbose)(LOGL, NAME" clear {");
+
+	MODULE_CAST(KW_SIS_3316, m, a_module);
+
+	sis_3316_disarm(m);
+	sis_3316_read_stat_counters(m);
+	COPY(m->stat_prev_dump, m->stat_prev);
+	a_module->event_counter.value = 0;
+	MAP_WRITE(m->sicy_map, disarm_and_arm_bank2, 1);
+	m->current_bank = 1;
+
+	LOGF(verbose)(LOGL, NAME" clear }");
+	return 1;
+}
+
 uint32_t
 sis_3316_parse_data(struct Crate *a_crate, struct Module *a_module, struct
     EventConstBuffer const *a_event_buffer, int a_do_pedestals)
@@ -2578,6 +2604,7 @@ void
 sis_3316_setup_(void)
 {
 	MODULE_SETUP(sis_3316, 0);
+	MODULE_CALLBACK_BIND(sis_3316, clear);
 	MODULE_CALLBACK_BIND(sis_3316, post_init);
 	MODULE_CALLBACK_BIND(sis_3316, readout_shadow);
 }
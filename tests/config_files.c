@@ -317,6 +317,8 @@ NTEST(TouchedAssertion)
 	NTRY_I(-1, ==, config_get_int32(NULL, KW_CONTROL_PORT,
 	    CONFIG_UNIT_NONE, -2, 2));
 	NTRY_SIGNAL(config_touched_assert(NULL, 1));
+	NTRY_BOOL(!config_get_boolean(NULL, KW_LOG_ASYNC));
+	NTRY_SIGNAL(config_touched_assert(NULL, 1));
 	crate = config_get_block(NULL, KW_CRATE);
 	NTRY_SIGNAL(config_touched_assert(NULL, 1));
 	NTRY_I(0x6, ==, config_get_bitmask(crate, KW_CLOCK_INPUT, 0, 15));
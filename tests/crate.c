@@ -32,6 +32,43 @@
 #include <nurdlib/crate.h>
 #include <nurdlib/log.h>
 
+static size_t	merge_hit_next(struct Module *, struct EventConstBuffer
+    const *, uint64_t *);
+static size_t	merge_hit_whole(struct Module *, struct EventConstBuffer
+    const *, uint64_t *);
+
+static uint32_t	g_merge_big[0x10001];
+
+/* Test hits are [timestamp, payload], zero words are fillers. */
+size_t
+merge_hit_next(struct Module *a_module, struct EventConstBuffer const
+    *a_event_buffer, uint64_t *a_ts)
+{
+	uint32_t const *p32;
+
+	(void)a_module;
+	p32 = a_event_buffer->ptr;
+	if (0 == p32[0]) {
+		*a_ts = MODULE_HIT_SKIP;
+		return sizeof *p32;
+	}
+	if (a_event_buffer->bytes < 2 * sizeof *p32) {
+		return 0;
+	}
+	*a_ts = p32[0];
+	return 2 * sizeof *p32;
+}
+
+/* The whole buffer is one hit. */
+size_t
+merge_hit_whole(struct Module *a_module, struct EventConstBuffer const
+    *a_event_buffer, uint64_t *a_ts)
+{
+	(void)a_module;
+	*a_ts = 0;
+	return a_event_buffer->bytes;
+}
+
 NTEST(DefaultConfig)
 {
 	struct Crate *crate;
@@ -143,6 +180,75 @@ NTEST(IdSkip)
 	crate_free(&crate);
 }
 
+NTEST(TimeMerge)
+{
+	uint32_t const c_src0[] = {10, 0xa0, 0, 30, 0xa1, 31, 0xa2};
+	uint32_t const c_src1[] = {5, 0xb0, 29, 0xb1, 0, 0};
+	uint32_t dst[32];
+	struct ModuleProps props;
+	struct Module module[2];
+	struct CrateMergeSource source[2];
+	struct CrateMergeSource *heap[2];
+	struct EventBuffer eb;
+
+	ZERO(props);
+	props.hit_next = merge_hit_next;
+	ZERO(module);
+	module[0].props = &props;
+	module[0].id = 1;
+	module[1].props = &props;
+	module[1].id = 2;
+	ZERO(source);
+	source[0].module = &module[0];
+	source[0].ceb.ptr = c_src0;
+	source[0].ceb.bytes = sizeof c_src0;
+	source[1].module = &module[1];
+	source[1].ceb.ptr = c_src1;
+	source[1].ceb.bytes = sizeof c_src1;
+	eb.ptr = dst;
+	eb.bytes = sizeof dst;
+
+	/* 5 | 10 | 29 30 31 with a window of 2 ticks. */
+	NTRY_U(0, ==, crate_merge(source, heap, 2, 2, &eb));
+	NTRY_U(sizeof dst - (3 * 3 + 5 * 3) * sizeof *dst, ==, eb.bytes);
+	NTRY_U(CRATE_MERGE_GROUP | 1, ==, dst[0]);
+	NTRY_U(5, ==, dst[1]);
+	NTRY_U(0, ==, dst[2]);
+	NTRY_U(CRATE_MERGE_HIT | 2 << 16 | 2, ==, dst[3]);
+	NTRY_U(0xb0, ==, dst[5]);
+	NTRY_U(CRATE_MERGE_GROUP | 1, ==, dst[6]);
+	NTRY_U(10, ==, dst[7]);
+	NTRY_U(0xa0, ==, dst[11]);
+	NTRY_U(CRATE_MERGE_GROUP | 3, ==, dst[12]);
+	NTRY_U(29, ==, dst[13]);
+	NTRY_U(0xb1, ==, dst[17]);
+	NTRY_U(CRATE_MERGE_HIT | 1 << 16 | 2, ==, dst[18]);
+	NTRY_U(0xa1, ==, dst[20]);
+	NTRY_U(0xa2, ==, dst[23]);
+
+	/* Too little space. */
+	ZERO(source);
+	source[0].module = &module[0];
+	source[0].ceb.ptr = c_src0;
+	source[0].ceb.bytes = sizeof c_src0;
+	eb.ptr = dst;
+	eb.bytes = 4 * sizeof *dst;
+	NTRY_U(CRATE_READOUT_FAIL_DATA_TOO_MUCH, ==, crate_merge(source,
+	    heap, 1, 0, &eb));
+
+	/* A hit too long for the word count of the hit header. */
+	props.hit_next = merge_hit_whole;
+	ZERO(source);
+	source[0].module = &module[0];
+	source[0].ceb.ptr = g_merge_big;
+	source[0].ceb.bytes = sizeof g_merge_big;
+	eb.ptr = dst;
+	eb.bytes = sizeof dst;
+	NTRY_U(CRATE_READOUT_FAIL_DATA_TOO_MUCH, ==, crate_merge(source,
+	    heap, 1, 0, &eb));
+	NTRY_U(sizeof dst - 3 * sizeof *dst, ==, eb.bytes);
+}
+
 NTEST_SUITE(Crate)
 {
 	crate_setup();
@@ -157,6 +263,7 @@ NTEST_SUITE(Crate)
 	NTEST_ADD(Pex);
 #endif
 	NTEST_ADD(IdSkip);
+	NTEST_ADD(TimeMerge);
 
 	config_shutdown();
 }
@@ -33,6 +33,7 @@
 #include <nurdlib/crate.h>
 #include <util/endian.h>
 #include <util/pack.h>
+#include <util/udp.h>
 
 NTEST(OnlineStatus)
 {
@@ -135,6 +136,104 @@ NTEST(SimpleCrate)
 	config_shutdown();
 }
 
+NTEST(CrateInfo)
+{
+	struct CtrlClient *client;
+	struct CtrlServer *server;
+	struct Crate *crate;
+	struct CtrlCrateInfo crate_info;
+
+	crate_setup();
+	module_setup();
+	config_load("tests/crate_simple.cfg");
+	crate = crate_create();
+
+	server = ctrl_server_create();
+	client = ctrl_client_create("127.0.0.1", CTRL_DEFAULT_PORT + 1);
+
+	/* ACVT stats go over the wire even when ACVT is off. */
+	ZERO(crate_info);
+	NTRY_BOOL(ctrl_client_crate_info_get(client, &crate_info, 0));
+	NTRY_I(0, ==, crate_info.acvt);
+	NTRY_I(100, ==, crate_info.acvt_stats.step_ns);
+	NTRY_I(0, ==, crate_info.dt_release_stats.step_num);
+	NTRY_I(0, ==, crate_info.acvt_stats.poll_hist[0]);
+	NTRY_I(0, ==, crate_info.acvt_stats.history_num);
+
+	ctrl_client_free(&client);
+	ctrl_server_free(&server);
+
+	crate_free(&crate);
+	config_shutdown();
+}
+
+NTEST(CrateInfoFull)
+{
+	struct UDPDatagram dgram;
+	struct Packer packer;
+	struct CtrlClient *client;
+	struct CtrlServer *server;
+	struct Crate *crate;
+	struct CtrlCrateInfo crate_info;
+
+	crate_setup();
+	module_setup();
+	config_load("tests/crate_dummy_many.cfg");
+	crate = crate_create();
+
+	/* The longest crate info must fit in a single datagram. */
+	NTRY_U(CTRL_CRATE_INFO_BYTES_MAX, <=, sizeof dgram.buf);
+	PACKER_CREATE_STATIC(packer, dgram.buf);
+	crate_info_pack(&packer, 0);
+	NTRY_U(CTRL_CRATE_INFO_BYTES_MAX, >=, 4 + packer.ofs);
+
+	/* Modules beyond the limit are cut, the rest arrives whole. */
+	server = ctrl_server_create();
+	client = ctrl_client_create("127.0.0.1", CTRL_DEFAULT_PORT + 1);
+	ZERO(crate_info);
+	NTRY_BOOL(ctrl_client_crate_info_get(client, &crate_info, 0));
+	NTRY_U(CTRL_SHADOW_MODULE_MAX, ==, crate_info.shadow.module_num);
+	NTRY_U(CTRL_SHADOW_MODULE_MAX - 1, ==,
+	    crate_info.shadow.module[CTRL_SHADOW_MODULE_MAX - 1].id);
+
+	ctrl_client_free(&client);
+	ctrl_server_free(&server);
+
+	crate_free(&crate);
+	config_shutdown();
+}
+
+NTEST(DtStats)
+{
+	struct CtrlDtStats dt_stats;
+	struct CtrlClient *client;
+	struct CtrlServer *server;
+	struct Crate *crate;
+
+	crate_setup();
+	module_setup();
+	config_load("tests/crate_simple.cfg");
+	crate = crate_create();
+
+	server = ctrl_server_create();
+	client = ctrl_client_create("127.0.0.1", CTRL_DEFAULT_PORT + 1);
+
+	/* Nothing has been read out, but all modules are listed. */
+	NTRY_BOOL(ctrl_client_dt_stats_get(client, &dt_stats, 0));
+	NTRY_U(0, ==, dt_stats.phase[CTRL_DT_READOUT].num);
+	NTRY_U(crate_module_get_num(crate), ==, dt_stats.module_num);
+	NTRY_U(0, ==, dt_stats.module_array[0].readout.num);
+	ctrl_client_dt_stats_free(&dt_stats);
+
+	NTRY_BOOL(!ctrl_client_dt_stats_get(client, &dt_stats, 1));
+
+	ctrl_client_free(&client);
+	ctrl_server_free(&server);
+
+	crate_free(&crate);
+	config_shutdown();
+}
+
 NTEST(UnknownCrate)
 {
 	struct CtrlClient *client;
@@ -156,8 +255,11 @@ NTEST(UnknownCrate)
 	NTRY_I(0, ==, crate_info.event_max_override);
 	NTRY_I(0, ==, crate_info.dt_release);
 	NTRY_I(0, ==, crate_info.acvt);
+	NTRY_I(0, ==, crate_info.acvt_stats.history_num);
 	NTRY_I(0, ==, crate_info.shadow.buf_bytes);
 	NTRY_I(0, ==, crate_info.shadow.max_bytes);
+	NTRY_I(0, ==, crate_info.poll.event_num);
+	NTRY_I(0, ==, crate_info.shadow.module_num);
 
 	ctrl_client_free(&client);
 	ctrl_server_free(&server);
@@ -271,6 +373,7 @@ NTEST(ConfigDump)
 	struct CtrlServer *server;
 	struct CtrlConfigList list;
 	struct CtrlConfig *control_port;
+	struct CtrlConfig *log_async;
 	struct CtrlConfig *crate_;
 	struct CtrlConfigScalar *scalar;
 	struct CtrlConfig *barrier;
@@ -298,7 +401,11 @@ NTEST(ConfigDump)
 	scalar = TAILQ_NEXT(scalar, next);
 	NTRY_PTR(TAILQ_END(&control_port->scalar_list), ==, scalar);
 
-	crate_ = TAILQ_NEXT(control_port, next);
+	log_async = TAILQ_NEXT(control_port, next);
+	NTRY_I(CONFIG_CONFIG, ==, log_async->type);
+	NTRY_I(KW_LOG_ASYNC, ==, log_async->name);
+
+	crate_ = TAILQ_NEXT(log_async, next);
 	NTRY_I(CONFIG_BLOCK, ==, crate_->type);
 	NTRY_I(KW_CRATE, ==, crate_->name);
 
@@ -398,6 +505,9 @@ NTEST_SUITE(Ctrl)
 	NTEST_ADD(OnlineStatus);
 	NTEST_ADD(EmptyCrate);
 	NTEST_ADD(SimpleCrate);
+	NTEST_ADD(CrateInfo);
+	NTEST_ADD(CrateInfoFull);
+	NTEST_ADD(DtStats);
 	NTEST_ADD(UnknownCrate);
 	NTEST_ADD(UnknownModule);
 	NTEST_ADD(UnsupportedModule);
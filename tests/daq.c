@@ -27,60 +27,572 @@
 #include <module/dummy/internal.h>
 #include <module/dummy/offsets.h>
 #include <module/map/map.h>
+#include <util/atomic.h>
+#include <util/time.h>
+
+#define DAQ_MODULE_MAX 3
+#define MULTI_EVENT_NUM 100
+
+/*
+ * Dummy modules at 0x01000000, 0x02000000 etc, all of them are mapped to
+ * user memory so also other crates of the config can use them.
+ */
+struct Daq {
+	char	mem[DAQ_MODULE_MAX][MAP_SIZE];
+	struct	Crate *crate;
+	struct	CrateTag *tag;
+	struct	Module *dummy[DAQ_MODULE_MAX];
+	unsigned	dummy_num;
+	uint32_t	dst[0x400];
+	struct	EventBuffer eb;
+};
+struct MultiCrate {
+	struct	Crate *crate;
+	struct	CrateTag *tag;
+	struct	Module *dummy;
+	unsigned	trigger_num;
+	unsigned	event_num;
+	size_t	bytes;
+	int	is_crate_ok;
+	uint32_t	result;
+};
+
+static uint32_t	daq_readout(struct Daq *) FUNC_RETURNS;
+static void	daq_setup(struct Daq *, char const *, unsigned);
+static int	daq_shadow_wait(struct Daq *, unsigned) FUNC_RETURNS;
+static void	daq_shutdown(struct Daq *);
+static uint32_t	daq_trigger(struct Daq *, unsigned) FUNC_RETURNS;
+static void	multi_event(struct Crate *, struct EventConstBuffer const *,
+    uint32_t, void *);
+static int	multi_trigger(struct Crate *, void *);
+
+/* Reads the crate into the whole 'dst'. */
+uint32_t
+daq_readout(struct Daq *a_daq)
+{
+	struct EventBuffer eb_orig;
+	uint32_t ret;
+
+	a_daq->eb.ptr = a_daq->dst;
+	a_daq->eb.bytes = sizeof a_daq->dst;
+	COPY(eb_orig, a_daq->eb);
+	ret = crate_readout(a_daq->crate, &a_daq->eb);
+	EVENT_BUFFER_INVARIANT(a_daq->eb, eb_orig);
+	return ret;
+}
+
+void
+daq_setup(struct Daq *a_daq, char const *a_cfg, unsigned a_dummy_num)
+{
+	unsigned i;
+
+	for (i = 0; i < DAQ_MODULE_MAX; ++i) {
+		map_user_add(0x01000000 * (1 + i), a_daq->mem[i],
+		    sizeof a_daq->mem[i]);
+	}
+	a_daq->crate = nurdlib_setup(NULL, a_cfg, NULL, NULL);
+	a_daq->tag = crate_get_tag_by_name(a_daq->crate, NULL);
+	a_daq->dummy_num = a_dummy_num;
+	for (i = 0; i < a_dummy_num; ++i) {
+		a_daq->dummy[i] = crate_module_find(a_daq->crate, KW_DUMMY,
+		    i);
+		NTRY_PTR(NULL, !=, a_daq->dummy[i]);
+	}
+}
+
+/*
+ * Counts 'a_event_num' events in the first module only and waits for the
+ * shadow thread to store them as one ring record.
+ */
+int
+daq_shadow_wait(struct Daq *a_daq, unsigned a_event_num)
+{
+	struct ModuleShadowRing *ring;
+	size_t head;
+	unsigned i;
+
+	ring = &a_daq->dummy[0]->shadow.ring;
+	head = ATOMIC_LOAD(&ring->head);
+	dummy_counter_increase(a_daq->dummy[0], a_event_num);
+	for (i = 0; i < 1000; ++i) {
+		if (head != ATOMIC_LOAD(&ring->head)) {
+			return 1;
+		}
+		time_sleep(1e-3);
+	}
+	return 0;
+}
+
+void
+daq_shutdown(struct Daq *a_daq)
+{
+	nurdlib_shutdown(&a_daq->crate);
+	map_user_clear();
+}
+
+/* Counts a trigger with 'a_event_num' events and runs the dt readout. */
+uint32_t
+daq_trigger(struct Daq *a_daq, unsigned a_event_num)
+{
+	unsigned i;
+
+	crate_tag_counter_increase(a_daq->crate, a_daq->tag, a_event_num);
+	for (i = 0; i < a_daq->dummy_num; ++i) {
+		dummy_counter_increase(a_daq->dummy[i], a_event_num);
+	}
+	return crate_readout_dt(a_daq->crate);
+}
+
+void
+multi_event(struct Crate *a_crate, struct EventConstBuffer const *a_ceb,
+    uint32_t a_result, void *a_data)
+{
+	struct MultiCrate *multi;
+
+	multi = a_data;
+	multi->is_crate_ok &= multi->crate == a_crate;
+	multi->bytes += a_ceb->bytes;
+	multi->result |= a_result;
+	ATOMIC_STORE(&multi->event_num, multi->event_num + 1);
+}
+
+int
+multi_trigger(struct Crate *a_crate, void *a_data)
+{
+	struct MultiCrate *multi;
+
+	multi = a_data;
+	if (MULTI_EVENT_NUM == multi->trigger_num) {
+		return 0;
+	}
+	++multi->trigger_num;
+	crate_tag_counter_increase(a_crate, multi->tag, 1);
+	dummy_counter_increase(multi->dummy, 1);
+	return 1;
+}
 
 NTEST(Run)
 {
-	char mem[MAP_SIZE];
-	char dst[0x1000];
-	struct Crate *crate;
-	struct CrateTag *tag;
-	struct Module *dummy;
+	struct Daq daq;
 	unsigned evn;
 
-	map_user_add(0x01000000, mem, sizeof mem);
+	daq_setup(&daq, "tests/crate_dummy.cfg", 1);
 
-	crate = nurdlib_setup(NULL, "tests/crate_dummy.cfg", NULL, NULL);
+	for (evn = 0; evn < 1000; ++evn) {
+		NTRY_U(0, ==, daq_trigger(&daq, 1));
+		NTRY_U(daq.dummy[0]->event_counter.value, ==, 1 + evn);
+		NTRY_U(0, ==, daq_readout(&daq));
+		crate_readout_finalize(daq.crate);
+	}
 
-	tag = crate_get_tag_by_name(crate, NULL);
+	daq_shutdown(&daq);
+}
+
+NTEST(InitParallel)
+{
+	struct Daq daq;
 
-	/* Find the first dummy module in the crate. */
-	dummy = crate_module_find(crate, KW_DUMMY, 0);
+	/* Each map module gets its own slow-init thread if possible. */
+	daq_setup(&daq, "tests/crate_dummy_init.cfg", 2);
+	NTRY_U(MAP_SICY_CONCURRENT ? 2 : 1, ==,
+	    crate_init_get_thread_num(daq.crate));
 
-	for (evn = 0; evn < 1000; ++evn) {
-		struct EventBuffer eb, eb_orig;
-		uint32_t ret;
+	NTRY_U(0, ==, daq_trigger(&daq, 1));
+	NTRY_U(0, ==, daq_readout(&daq));
+	crate_readout_finalize(daq.crate);
 
-		crate_tag_counter_increase(crate, tag, 1);
-		dummy_counter_increase(dummy, 1);
+	daq_shutdown(&daq);
+}
 
-		ret = crate_readout_dt(crate);
-		NTRY_U(0, ==, ret);
+NTEST(VerifyAsync)
+{
+	struct Daq daq;
+	unsigned i;
 
-		NTRY_U(dummy->event_counter.value, ==, 1 + evn);
+	/* Data is parsed by a thread and collected in finalize. */
+	daq_setup(&daq, "tests/crate_dummy_verify.cfg", 1);
 
-		/* Setup and backup event-buffer. */
-		eb.bytes = sizeof dst;
-		eb.ptr = dst;
-		COPY(eb_orig, eb);
+	for (i = 0; i < 3; ++i) {
+		NTRY_U(0, ==, daq_trigger(&daq, 1));
+		NTRY_U(0, ==, daq_readout(&daq));
+		crate_readout_finalize(daq.crate);
+	}
+	/* Every 2nd event is only header-checked. */
+	NTRY_U(2, ==, daq.dummy[0]->verify.full_num);
+	NTRY_U(1, ==, daq.dummy[0]->verify.shallow_num);
 
-		ret = crate_readout(crate, &eb);
-		NTRY_U(0, ==, ret);
+	/* Modules without a shallow parse are always fully parsed. */
+	daq.dummy[0]->verify.has_shallow = 0;
+	for (i = 0; i < 2; ++i) {
+		NTRY_U(0, ==, daq_trigger(&daq, 1));
+		NTRY_U(0, ==, daq_readout(&daq));
+		crate_readout_finalize(daq.crate);
+	}
+	NTRY_U(4, ==, daq.dummy[0]->verify.full_num);
+	NTRY_U(1, ==, daq.dummy[0]->verify.shallow_num);
 
-		crate_readout_finalize(crate);
+	daq_shutdown(&daq);
+}
+
+NTEST(EventMaxAuto)
+{
+	struct Daq daq;
+	unsigned i;
+
+	daq_setup(&daq, "tests/crate_dummy_event_max.cfg", 1);
+	NTRY_U(32, ==, crate_tag_get_event_max(daq.tag));
+
+	/* The dummy doesn't track its own counter diff. */
+	((struct DummyModule *)daq.dummy[0])->event_diff = 4;
+	for (i = 0; i < 2; ++i) {
+		NTRY_U(0, ==, daq_trigger(&daq, 4));
+		NTRY_U(0, ==, daq_readout(&daq));
+		crate_readout_finalize(daq.crate);
+	}
+	/* 36 words/event, half of the buffer fits 14 events. */
+	NTRY_U(14, ==, crate_tag_get_event_max(daq.tag));
+
+	daq_shutdown(&daq);
+}
+
+NTEST(EventMaxAutoTags)
+{
+	struct Daq daq;
+	struct CrateTag *tag2;
+	unsigned i;
+
+	/* Only the modules of the triggered tag count in the tuning. */
+	daq_setup(&daq, "tests/crate_dummy_event_max_tags.cfg", 2);
+	tag2 = crate_get_tag_by_name(daq.crate, "Second");
+	NTRY_PTR(NULL, !=, tag2);
+
+	((struct DummyModule *)daq.dummy[0])->event_diff = 4;
+	((struct DummyModule *)daq.dummy[1])->event_diff = 2;
+	for (i = 0; i < 2; ++i) {
+		crate_tag_counter_increase(daq.crate, daq.tag, 4);
+		dummy_counter_increase(daq.dummy[0], 4);
+		NTRY_U(0, ==, crate_readout_dt(daq.crate));
+		NTRY_U(0, ==, daq_readout(&daq));
+		crate_readout_finalize(daq.crate);
+
+		crate_tag_counter_increase(daq.crate, tag2, 2);
+		dummy_counter_increase(daq.dummy[1], 2);
+		NTRY_U(0, ==, crate_readout_dt(daq.crate));
+		NTRY_U(0, ==, daq_readout(&daq));
+		crate_readout_finalize(daq.crate);
+	}
+	/* 2 * 36 words/event, half of the buffer fits 7 events. */
+	NTRY_U(7, ==, crate_tag_get_event_max(daq.tag));
+	NTRY_U(7, ==, crate_tag_get_event_max(tag2));
+
+	daq_shutdown(&daq);
+}
+
+NTEST(RunMulti)
+{
+	struct Daq daq;
+	struct MultiCrate multi[2];
+	struct Crate *crate[2];
+	unsigned i, j;
+
+	/* Every CRATE block is set up, the first crate is returned. */
+	daq_setup(&daq, "tests/crate_dummy_multi.cfg", 0);
+	crate[0] = daq.crate;
+	crate[1] = crate_get_next(crate[0]);
+	NTRY_PTR(NULL, !=, crate[1]);
+	NTRY_PTR(NULL, ==, crate_get_next(crate[1]));
+	NTRY_STR("A", ==, crate_get_name(crate[0]));
+	NTRY_STR("B", ==, crate_get_name(crate[1]));
+
+	ZERO(multi);
+	for (i = 0; i < 2; ++i) {
+		multi[i].crate = crate[i];
+		multi[i].tag = crate_get_tag_by_name(crate[i], NULL);
+		multi[i].dummy = crate_module_find(crate[i], KW_DUMMY, 0);
+		multi[i].is_crate_ok = 1;
+		/* Different amounts tell the crate outputs apart. */
+		((struct DummyModule *)multi[i].dummy)->event_diff = 1 + i;
+		crate_thread_start(crate[i], 0x1000, multi_trigger,
+		    multi_event, &multi[i]);
+	}
+	for (j = 0; j < 1000; ++j) {
+		if (MULTI_EVENT_NUM == ATOMIC_LOAD(&multi[0].event_num) &&
+		    MULTI_EVENT_NUM == ATOMIC_LOAD(&multi[1].event_num)) {
+			break;
+		}
+		time_sleep(1e-3);
+	}
+	for (i = 0; i < 2; ++i) {
+		crate_thread_stop(crate[i]);
+		NTRY_U(MULTI_EVENT_NUM, ==, multi[i].event_num);
+		NTRY_U(0, ==, multi[i].result);
+		NTRY_BOOL(multi[i].is_crate_ok);
+		NTRY_U(MULTI_EVENT_NUM * (1 + i) * 36 * sizeof(uint32_t), ==,
+		    multi[i].bytes);
+	}
+
+	daq_shutdown(&daq);
+}
+
+NTEST(RunParallel)
+{
+	struct Daq daq;
+	uint32_t const *dst;
+	unsigned evn, i;
+
+	daq_setup(&daq, "tests/crate_dummy_parallel.cfg", 3);
+	dst = daq.dst;
+	for (i = 0; i < 3; ++i) {
+		/* Different amounts tell the modules apart. */
+		((struct DummyModule *)daq.dummy[i])->event_diff = 1 + i;
+	}
+
+	for (evn = 0; evn < 100; ++evn) {
+		NTRY_U(0, ==, daq_trigger(&daq, 1));
+		NTRY_U(0, ==, daq_readout(&daq));
 
 		/*
-		 * Simple event-buffer verification, done also by
-		 * crate_readout.
+		 * 36 words per event, assembled in configured order around
+		 * the barrier, the last module is read by the main thread due
+		 * to its log level.
 		 */
-		EVENT_BUFFER_INVARIANT(eb, eb_orig);
+		NTRY_U(sizeof daq.dst - (1 + 6 * 36) * sizeof *dst, ==,
+		    daq.eb.bytes);
+		NTRY_U(35, ==, 0xff & dst[0]);
+		NTRY_U(0xbabababa, ==, dst[36]);
+		NTRY_U(35, ==, 0xff & dst[37]);
+		NTRY_U(35, ==, 0xff & dst[37 + 2 * 36]);
+		NTRY_PTR(&dst[0], ==, daq.dummy[0]->eb_final.ptr);
+		NTRY_U(36 * sizeof *dst, ==, daq.dummy[0]->eb_final.bytes);
+		NTRY_PTR(&dst[37], ==, daq.dummy[1]->eb_final.ptr);
+		NTRY_U(2 * 36 * sizeof *dst, ==,
+		    daq.dummy[1]->eb_final.bytes);
+		NTRY_PTR(&dst[37 + 2 * 36], ==, daq.dummy[2]->eb_final.ptr);
+		NTRY_U(3 * 36 * sizeof *dst, ==,
+		    daq.dummy[2]->eb_final.bytes);
+
+		crate_readout_finalize(daq.crate);
 	}
 
-	nurdlib_shutdown(&crate);
+	daq_shutdown(&daq);
+}
+
+NTEST(RunSegments)
+{
+	struct Daq daq;
+	unsigned evn;
+
+	daq_setup(&daq, "tests/crate_dummy_parallel.cfg", 3);
+	((struct DummyModule *)daq.dummy[0])->event_diff = 1;
+
+	for (evn = 0; evn < 100; ++evn) {
+		struct EventBuffer eb_orig;
+		struct EventConstBuffer const *seg;
+		size_t seg_num;
+		uint32_t const *p32;
+
+		NTRY_U(0, ==, daq_trigger(&daq, 1));
+
+		daq.eb.ptr = daq.dst;
+		daq.eb.bytes = sizeof daq.dst;
+		COPY(eb_orig, daq.eb);
+		NTRY_U(0, ==, crate_readout_sg(daq.crate, &daq.eb, &seg,
+		    &seg_num));
+		EVENT_BUFFER_INVARIANT(daq.eb, eb_orig);
+
+		/* No shadow data, so the event-buffer is the only segment. */
+		NTRY_U(1, ==, seg_num);
+		NTRY_PTR(daq.dst, ==, seg[0].ptr);
+		NTRY_U(37 * sizeof(uint32_t), ==, seg[0].bytes);
+		p32 = seg[0].ptr;
+		NTRY_U(35, ==, 0xff & p32[0]);
+		NTRY_U(0xbabababa, ==, p32[36]);
+		NTRY_I(EB_FINAL_EVENT_BUFFER, ==,
+		    daq.dummy[0]->eb_final_place);
+
+		crate_readout_sg_release(daq.crate);
+		crate_readout_finalize(daq.crate);
+	}
+
+	daq_shutdown(&daq);
+}
+
+NTEST(RunSegmentsPool)
+{
+	struct Daq daq;
+	uint32_t const *dst;
+	unsigned evn;
+
+	daq_setup(&daq, "tests/crate_dummy_pool.cfg", 2);
+	dst = daq.dst;
+	/* One event of data per readout. */
+	((struct DummyModule *)daq.dummy[0])->event_diff = 1;
+	((struct DummyModule *)daq.dummy[1])->event_diff = 1;
+
+	for (evn = 0; evn < 100; ++evn) {
+		struct EventBuffer eb_orig;
+		struct EventConstBuffer const *seg;
+		size_t seg_num;
+
+		NTRY_U(0, ==, daq_trigger(&daq, 1));
+
+		daq.eb.ptr = daq.dst;
+		daq.eb.bytes = sizeof daq.dst;
+		COPY(eb_orig, daq.eb);
+		NTRY_U(0, ==, crate_readout_sg(daq.crate, &daq.eb, &seg,
+		    &seg_num));
+		EVENT_BUFFER_INVARIANT(daq.eb, eb_orig);
+
+		/*
+		 * Both modules read into pooled chunks, which are referenced
+		 * in place, one aligned chunk after the other, and the
+		 * event-buffer is not touched.
+		 */
+		NTRY_U(2, ==, seg_num);
+		NTRY_U(36 * sizeof *dst, ==, seg[0].bytes);
+		NTRY_U(36 * sizeof *dst, ==, seg[1].bytes);
+		NTRY_PTR((uint8_t const *)seg[0].ptr + 3 * MAP_BLT_POOL_ALIGN,
+		    ==, seg[1].ptr);
+		NTRY_BOOL((uint8_t const *)seg[0].ptr >= (uint8_t const *)dst
+		    + sizeof daq.dst || (uint8_t const *)seg[0].ptr +
+		    seg[0].bytes <= (uint8_t const *)dst);
+		NTRY_U(35, ==, 0xff & ((uint32_t const *)seg[0].ptr)[0]);
+		NTRY_U(35, ==, 0xff & ((uint32_t const *)seg[1].ptr)[0]);
+		NTRY_PTR(dst, ==, daq.eb.ptr);
+		NTRY_U(sizeof daq.dst, ==, daq.eb.bytes);
+		/* Consumers can tell the data is not in the event-buffer. */
+		NTRY_I(EB_FINAL_OUTSIDE, ==, daq.dummy[0]->eb_final_place);
+		NTRY_PTR(seg[0].ptr, ==, daq.dummy[0]->eb_final.ptr);
+		NTRY_I(EB_FINAL_OUTSIDE, ==, daq.dummy[1]->eb_final_place);
+
+		crate_readout_sg_release(daq.crate);
+		crate_readout_finalize(daq.crate);
+	}
+
+	daq_shutdown(&daq);
+}
+
+NTEST(RunSegmentsShadow)
+{
+	struct Daq daq;
+	unsigned evn;
+
+	daq_setup(&daq, "tests/crate_dummy_shadow.cfg", 1);
+
+	for (evn = 0; evn < 20; ++evn) {
+		struct EventBuffer eb_orig;
+		struct EventConstBuffer const *seg;
+		struct ModuleShadowRing const *ring;
+		uint8_t const *store;
+		size_t seg_num, i;
+		unsigned rec_num, verify_num;
+
+		/* Alternate between one and two shadow records per event. */
+		rec_num = 1 + (1 & evn);
+		for (i = 0; i < rec_num; ++i) {
+			NTRY_BOOL(daq_shadow_wait(&daq, 1));
+		}
+		crate_tag_counter_increase(daq.crate, daq.tag, rec_num);
+		NTRY_U(0, ==, crate_readout_dt(daq.crate));
+
+		verify_num = daq.dummy[0]->verify.full_num +
+		    daq.dummy[0]->verify.shallow_num;
+		daq.eb.ptr = daq.dst;
+		daq.eb.bytes = sizeof daq.dst;
+		COPY(eb_orig, daq.eb);
+		NTRY_U(0, ==, crate_readout_sg(daq.crate, &daq.eb, &seg,
+		    &seg_num));
+		EVENT_BUFFER_INVARIANT(daq.eb, eb_orig);
+
+		/* Every ring record is a segment, referenced in the ring. */
+		ring = &daq.dummy[0]->shadow.ring;
+		store = ring->store.ptr;
+		NTRY_U(rec_num, ==, seg_num);
+		for (i = 0; i < seg_num; ++i) {
+			uint8_t const *p;
+
+			p = seg[i].ptr;
+			NTRY_BOOL(p >= store && p + seg[i].bytes <= store +
+			    ring->store.bytes);
+			NTRY_U(36 * sizeof(uint32_t), ==, seg[i].bytes);
+			NTRY_U(35, ==, 0xff & ((uint32_t const *)p)[0]);
+		}
+		NTRY_PTR(daq.dst, ==, daq.eb.ptr);
+		NTRY_U(rec_num * 36 * sizeof(uint32_t), ==,
+		    daq.dummy[0]->eb_final.bytes);
+		if (1 == rec_num) {
+			NTRY_I(EB_FINAL_OUTSIDE, ==,
+			    daq.dummy[0]->eb_final_place);
+			NTRY_PTR(seg[0].ptr, ==, daq.dummy[0]->eb_final.ptr);
+		} else {
+			NTRY_I(EB_FINAL_SEGMENTS, ==,
+			    daq.dummy[0]->eb_final_place);
+		}
+		/* Each record is verified on its own, without a copy. */
+		NTRY_U(verify_num + rec_num, ==,
+		    daq.dummy[0]->verify.full_num +
+		    daq.dummy[0]->verify.shallow_num);
+
+		/* The records stay in the ring until released. */
+		NTRY_BOOL(ring->tail != ring->cut);
+		crate_readout_sg_release(daq.crate);
+		NTRY_BOOL(ring->tail == ring->cut);
+		crate_readout_finalize(daq.crate);
+	}
+
+	daq_shutdown(&daq);
+}
+
+NTEST(Pipeline)
+{
+	struct Daq daq;
+	unsigned i;
+
+	/* Parsing is deferred to the next module, the last in the readout. */
+	daq_setup(&daq, "tests/crate_dummy_pipeline.cfg", 2);
+	((struct DummyModule *)daq.dummy[0])->event_diff = 1;
+	((struct DummyModule *)daq.dummy[1])->event_diff = 1;
+
+	for (i = 0; i < 3; ++i) {
+		struct DummyModule const *dummy;
+		uint32_t const *p32;
+
+		NTRY_U(0, ==, daq_trigger(&daq, 1));
+		NTRY_U(0, ==, daq_readout(&daq));
+		NTRY_U(i + 1, ==, daq.dummy[0]->verify.full_num);
+		NTRY_U(i + 1, ==, daq.dummy[1]->verify.full_num);
+		crate_readout_finalize(daq.crate);
+
+		/* Every transfer was submitted and completed in order. */
+		dummy = (void *)daq.dummy[0];
+		NTRY_U(i + 1, ==, dummy->submit.num);
+		NTRY_BOOL(!dummy->submit.is_pending);
+		dummy = (void *)daq.dummy[1];
+		NTRY_U(i + 1, ==, dummy->submit.num);
+		NTRY_BOOL(!dummy->submit.is_pending);
+		NTRY_U(2 * 36 * sizeof(uint32_t), ==, sizeof daq.dst -
+		    daq.eb.bytes);
+		p32 = daq.dst;
+		NTRY_U(35, ==, 0xff & p32[0]);
+		NTRY_U(i, ==, p32[35]);
+		NTRY_U(35, ==, 0xff & p32[36]);
+		NTRY_U(i, ==, p32[71]);
+	}
+
+	daq_shutdown(&daq);
 }
 
 NTEST_SUITE(DAQ)
 {
 	NTEST_ADD(Run);
-
-	map_user_clear();
+	NTEST_ADD(InitParallel);
+	NTEST_ADD(RunParallel);
+	NTEST_ADD(EventMaxAuto);
+	NTEST_ADD(EventMaxAutoTags);
+	NTEST_ADD(RunMulti);
+	NTEST_ADD(RunSegments);
+	NTEST_ADD(RunSegmentsPool);
+	NTEST_ADD(RunSegmentsShadow);
+	NTEST_ADD(VerifyAsync);
+	NTEST_ADD(Pipeline);
 }
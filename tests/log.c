@@ -198,6 +198,34 @@ NTEST(DumpBig)
 	log_callback_set(NULL);
 }
 
+NTEST(Async)
+{
+	unsigned i;
+
+	log_intercept_clear();
+	log_callback_set(log_intercept);
+	log_level_push(g_log_level_verbose_);
+	log_async_start();
+	for (i = 0; 10 > i; ++i) {
+		LOGF(info)(LOGL, "Async %u", i);
+	}
+	log_async_stop();
+	/* Start and stop messages are queued too. */
+	NTRY_I(12, ==, log_intercept_get_num());
+	NTRY_STR(log_intercept_get_str(1), ==, "Async 0");
+	NTRY_STR(log_intercept_get_str(10), ==, "Async 9");
+	NTRY_I(KW_INFO, ==, log_intercept_get_level(10));
+	NTRY_U(0, ==, log_async_get_drop_num());
+	/* Stopping frees everything, a restart sets it up again. */
+	log_async_start();
+	LOGF(info)(LOGL, "Async again");
+	log_async_stop();
+	NTRY_I(15, ==, log_intercept_get_num());
+	NTRY_STR(log_intercept_get_str(13), ==, "Async again");
+	log_level_pop();
+	log_callback_set(NULL);
+}
+
 NTEST_SUITE(UtilLog)
 {
 	NTEST_ADD(GetLevel);
@@ -206,6 +234,7 @@ NTEST_SUITE(UtilLog)
 	NTEST_ADD(LevelClear);
 	NTEST_ADD(DumpSmall);
 	NTEST_ADD(DumpBig);
+	NTEST_ADD(Async);
 
 	log_level_clear();
 }
@@ -64,6 +64,40 @@ NTEST(UserRegion)
 	map_user_clear();
 }
 
+NTEST(Batch)
+{
+	uint32_t user[4];
+	struct MapBatch *batch;
+	struct Map *map;
+	uint32_t dst[2];
+
+	ZERO(user);
+	map_user_add(0x01000000, user, sizeof user);
+	map = map_map(0x01000000, sizeof user, KW_NOBLT, 0, 0,
+	    0, 0, 0,
+	    0, 0, 0, 0);
+	batch = map_sicy_batch_create();
+	map_sicy_batch_write(batch, map, MAP_MOD_W, 32, 0, 0x12345678);
+	map_sicy_batch_read(batch, map, MAP_MOD_R, 32, 0, &dst[0]);
+	map_sicy_batch_write(batch, map, MAP_MOD_W, 32, 8, 0x9abcdef0);
+	map_sicy_batch_read(batch, map, MAP_MOD_R, 32, 8, &dst[1]);
+	/* Nothing happens until submitted. */
+	NTRY_U(0, ==, user[0]);
+	map_sicy_batch_submit(batch);
+	NTRY_U(0x12345678, ==, user[0]);
+	NTRY_U(0x9abcdef0, ==, user[2]);
+	NTRY_U(0x12345678, ==, dst[0]);
+	NTRY_U(0x9abcdef0, ==, dst[1]);
+	/* Submitted accesses are gone. */
+	user[0] = 0;
+	map_sicy_batch_submit(batch);
+	NTRY_U(0, ==, user[0]);
+	map_sicy_batch_free(&batch);
+	NTRY_PTR(NULL, ==, batch);
+	map_unmap(&map);
+	map_user_clear();
+}
+
 #ifdef POKE_DUMB
 static struct {
 	uintptr_t	address;
@@ -150,8 +184,187 @@ NTEST(Poke)
 #endif
 }
 
+NTEST(Shadow)
+{
+	uint32_t user[64];
+	struct MapBatch *batch;
+	struct Map *map;
+	uint32_t issued, skipped;
+	unsigned i;
+
+	ZERO(user);
+	map_user_add(0x01000000, user, sizeof user);
+	map = map_map(0x01000000, sizeof user, KW_NOBLT, 0, 0,
+	    0, 0, 0,
+	    0, 0, 0, 0);
+	map_sicy_shadow_enable(map);
+
+	/* Recording only. */
+	map_sicy_write(map, MAP_MOD_R | MAP_MOD_W, 32, 0, 1);
+	map_sicy_write(map, MAP_MOD_R | MAP_MOD_W, 32, 0, 1);
+	map_sicy_shadow_get_stats(map, &issued, &skipped);
+	NTRY_U(2, ==, issued);
+	NTRY_U(0, ==, skipped);
+
+	/* Same value is skipped, hardware changes go unnoticed. */
+	map_sicy_shadow_skip(map, 1);
+	user[0] = 5;
+	map_sicy_write(map, MAP_MOD_R | MAP_MOD_W, 32, 0, 1);
+	NTRY_U(5, ==, user[0]);
+	map_sicy_write(map, MAP_MOD_R | MAP_MOD_W, 32, 0, 2);
+	NTRY_U(2, ==, user[0]);
+	map_sicy_write(map, MAP_MOD_R | MAP_MOD_W, 16, 0, 2);
+	NTRY_U(2, ==, user[0]);
+	map_sicy_shadow_get_stats(map, &issued, &skipped);
+	NTRY_U(4, ==, issued);
+	NTRY_U(1, ==, skipped);
+
+	/* Write-only registers are always written. */
+	user[1] = 0;
+	map_sicy_write(map, MAP_MOD_W, 32, 4, 0);
+	map_sicy_write(map, MAP_MOD_W, 32, 4, 3);
+	map_sicy_write(map, MAP_MOD_W, 32, 4, 3);
+	NTRY_U(3, ==, user[1]);
+	map_sicy_shadow_get_stats(map, &issued, &skipped);
+	NTRY_U(7, ==, issued);
+	NTRY_U(1, ==, skipped);
+
+	/* So are readable actions. */
+	map_sicy_write(map, MAP_MOD_R | MAP_MOD_W | MAP_MOD_A, 32, 4, 3);
+	user[1] = 0;
+	map_sicy_write(map, MAP_MOD_R | MAP_MOD_W | MAP_MOD_A, 32, 4, 3);
+	NTRY_U(3, ==, user[1]);
+	map_sicy_shadow_get_stats(map, &issued, &skipped);
+	NTRY_U(9, ==, issued);
+	NTRY_U(1, ==, skipped);
+
+	/* Queued writes have not reached the hardware. */
+	map_sicy_write(map, MAP_MOD_R | MAP_MOD_W, 32, 8, 0);
+	batch = map_sicy_batch_create();
+	map_sicy_batch_write(batch, map, MAP_MOD_R | MAP_MOD_W, 32, 8, 9);
+	map_sicy_write(map, MAP_MOD_R | MAP_MOD_W, 32, 8, 9);
+	NTRY_U(9, ==, user[2]);
+	map_sicy_batch_submit(batch);
+	user[2] = 0;
+	map_sicy_write(map, MAP_MOD_R | MAP_MOD_W, 32, 8, 9);
+	NTRY_U(0, ==, user[2]);
+	map_sicy_batch_free(&batch);
+	map_sicy_shadow_get_stats(map, &issued, &skipped);
+	NTRY_U(12, ==, issued);
+	NTRY_U(2, ==, skipped);
+
+	/* Grow the table and skip batched writes at queue time. */
+	for (i = 0; LENGTH(user) > i; ++i) {
+		map_sicy_write(map, MAP_MOD_R | MAP_MOD_W, 32, 4 * i, i);
+	}
+	ZERO(user);
+	batch = map_sicy_batch_create();
+	for (i = 0; LENGTH(user) > i; ++i) {
+		map_sicy_batch_write(batch, map, MAP_MOD_R | MAP_MOD_W, 32,
+		    4 * i, 0 == (i & 1) ? i : 1000);
+	}
+	map_sicy_batch_submit(batch);
+	map_sicy_batch_free(&batch);
+	for (i = 0; LENGTH(user) > i; ++i) {
+		NTRY_U(0 == (i & 1) ? 0 : 1000, ==, user[i]);
+	}
+
+	/* Re-enabling forgets everything. */
+	map_sicy_shadow_enable(map);
+	map_sicy_shadow_skip(map, 1);
+	map_sicy_write(map, MAP_MOD_R | MAP_MOD_W, 32, 0, 0);
+	map_sicy_shadow_get_stats(map, &issued, &skipped);
+	NTRY_U(1, ==, issued);
+	NTRY_U(0, ==, skipped);
+
+	map_unmap(&map);
+	map_user_clear();
+}
+
+NTEST(BltPool)
+{
+	struct MapBltPool *pool;
+	uint8_t *p1, *p2, *p3;
+
+	pool = map_blt_pool_create(256);
+	p1 = map_blt_pool_get(pool, 4);
+	NTRY_PTR(NULL, !=, p1);
+	NTRY_U(0, ==, (uintptr_t)p1 & (MAP_BLT_POOL_ALIGN - 1));
+	p2 = map_blt_pool_get(pool, 100);
+	NTRY_PTR(p1 + MAP_BLT_POOL_ALIGN, ==, p2);
+	NTRY_BOOL(map_blt_pool_has(pool, p2 + 99));
+	NTRY_BOOL(!map_blt_pool_has(pool, p1 + 256));
+	NTRY_BOOL(!map_blt_pool_has(pool, &pool));
+
+	/* Exhausted pools give up, but keep what's left. */
+	p3 = map_blt_pool_get(pool, 128);
+	NTRY_PTR(NULL, ==, p3);
+	p3 = map_blt_pool_get(pool, 64);
+	NTRY_PTR(p1 + 3 * MAP_BLT_POOL_ALIGN, ==, p3);
+	p3 = map_blt_pool_get(pool, 1);
+	NTRY_PTR(NULL, ==, p3);
+
+	map_blt_pool_reset(pool);
+	p3 = map_blt_pool_get(pool, 256);
+	NTRY_PTR(p1, ==, p3);
+
+	map_blt_pool_free(&pool);
+	NTRY_PTR(NULL, ==, pool);
+
+	/* Pools bigger than a huge page may be backed by huge pages. */
+	pool = map_blt_pool_create(3 << 20);
+	p1 = map_blt_pool_get(pool, 3 << 20);
+	NTRY_PTR(NULL, !=, p1);
+	p1[0] = 1;
+	p1[(3 << 20) - 1] = 2;
+	NTRY_U(1, ==, p1[0]);
+	NTRY_U(2, ==, p1[(3 << 20) - 1]);
+	map_blt_pool_free(&pool);
+	NTRY_PTR(NULL, ==, pool);
+}
+
+NTEST(BltAsync)
+{
+	uint32_t user[64];
+	uint32_t dst[32];
+	struct MapBltAsync *async;
+	struct Map *map;
+	unsigned i, j;
+
+	for (i = 0; LENGTH(user) > i; ++i) {
+		user[i] = 0x01000000 | i;
+	}
+	map_user_add(0x01000000, user, sizeof user);
+	map = map_map(0x01000000, sizeof user, KW_BLT, 0, 0,
+	    0, 0, 0,
+	    0, 0, 0, 0);
+
+	/* Every transfer completes with what a blocking read returns. */
+	async = map_blt_async_create();
+	for (i = 0; 2 > i; ++i) {
+		ZERO(dst);
+		map_blt_async_submit(async, map, i * sizeof dst, dst,
+		    sizeof dst, 0);
+		NTRY_I(sizeof dst, ==, map_blt_async_wait(async));
+		NTRY_BOOL(map_blt_async_poll(async));
+		for (j = 0; LENGTH(dst) > j; ++j) {
+			NTRY_U(user[i * LENGTH(dst) + j], ==, dst[j]);
+		}
+	}
+	NTRY_I(sizeof dst, ==, map_blt_read(map, 0, dst, sizeof dst));
+	map_blt_async_free(&async);
+	NTRY_PTR(NULL, ==, async);
+
+	map_unmap(&map);
+	map_user_clear();
+}
+
 NTEST_SUITE(Map)
 {
 	NTEST_ADD(UserRegion);
+	NTEST_ADD(Batch);
 	NTEST_ADD(Poke);
+	NTEST_ADD(Shadow);
+	NTEST_ADD(BltPool);
+	NTEST_ADD(BltAsync);
 }
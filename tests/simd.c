@@ -0,0 +1,98 @@
+/*
+ * nurdlib, NUstar ReaDout LIBrary
+ *
+ * Copyright (C) 2026
+ * nurdlib contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+
+#include <ntest/ntest.h>
+#include <nurdlib/base.h>
+#include <util/simd.h>
+
+NTEST(Fill)
+{
+	uint32_t u32[40];
+	size_t ofs, words;
+
+	/* All alignments and tails around the vector width. */
+	for (ofs = 0; 4 > ofs; ++ofs) {
+		for (words = 0; 33 > words; ++words) {
+			size_t i;
+
+			ZERO(u32);
+			simd_fill32(u32 + ofs, 0x12345678, words);
+			for (i = 0; LENGTH(u32) > i; ++i) {
+				NTRY_U(i >= ofs && i < ofs + words ?
+				    0x12345678 : 0, ==, u32[i]);
+			}
+		}
+	}
+}
+
+NTEST(Skip)
+{
+	uint32_t u32[40];
+	size_t ofs, stop;
+
+	for (ofs = 0; 4 > ofs; ++ofs) {
+		for (stop = ofs; LENGTH(u32) > stop; ++stop) {
+			simd_fill32(u32, 0x07ff07ff, LENGTH(u32));
+			u32[stop] = 0;
+			NTRY_PTR(&u32[stop], ==, simd_skip32(u32 + ofs,
+			    u32 + LENGTH(u32), 0x07ff07ff));
+			/* Stops at the end if the value runs until then. */
+			NTRY_PTR(&u32[stop], ==, simd_skip32(u32 + ofs,
+			    &u32[stop], 0x07ff07ff));
+		}
+	}
+}
+
+NTEST(Swap)
+{
+	uint32_t u32[40];
+	size_t ofs, words;
+
+	for (ofs = 0; 4 > ofs; ++ofs) {
+		for (words = 0; 33 > words; words += 2) {
+			size_t i;
+
+			for (i = 0; LENGTH(u32) > i; ++i) {
+				u32[i] = i;
+			}
+			simd_swap32(u32 + ofs, words);
+			for (i = 0; LENGTH(u32) > i; ++i) {
+				uint32_t expect;
+
+				expect = i;
+				if (i >= ofs && i < ofs + words) {
+					expect = 0 == ((i - ofs) & 1) ?
+					    i + 1 : i - 1;
+				}
+				NTRY_U(expect, ==, u32[i]);
+			}
+		}
+	}
+}
+
+NTEST_SUITE(Simd)
+{
+	NTEST_ADD(Fill);
+	NTEST_ADD(Skip);
+	NTEST_ADD(Swap);
+}
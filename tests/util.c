@@ -27,6 +27,7 @@
 #include <util/math.h>
 #include <util/ssort.h>
 #include <util/string.h>
+#include <util/time.h>
 
 static int	is_sorted(uint16_t const *, size_t);
 
@@ -111,6 +112,46 @@ NTEST(strtoi32)
 	NTRY_I(-1, ==, strtoi32("ffffffff", NULL, 16));
 }
 
+NTEST(TimeNs)
+{
+	uint64_t t0, t1;
+	int i, is_on;
+
+	/* Once with the monotonic clock, once with the cycle counter. */
+	time_cycles_reset();
+	for (i = 0; i < 2; ++i) {
+		t0 = time_getns();
+		time_sleep(0.01);
+		t1 = time_getns();
+		NTRY_BOOL(t1 > t0);
+		NTRY_BOOL(t1 - t0 >= 9000000);
+		is_on = time_cycles_calibrate();
+		/* Calibrates only once. */
+		NTRY_I(is_on, ==, time_cycles_calibrate());
+		if (!is_on) {
+			break;
+		}
+	}
+	time_cycles_reset();
+}
+
+NTEST(TimeStat)
+{
+	struct TimeStat stat;
+
+	ZERO(stat);
+	time_stat_add(&stat, 500);
+	time_stat_add(&stat, 1500);
+	time_stat_add(&stat, 3000);
+	time_stat_add(&stat, 3000000000U);
+	NTRY_U(4, ==, stat.num);
+	NTRY_U(3000000000U, ==, stat.max_ns);
+	NTRY_U(1, ==, stat.hist[0]);
+	NTRY_U(1, ==, stat.hist[1]);
+	NTRY_U(1, ==, stat.hist[2]);
+	NTRY_U(1, ==, stat.hist[TIME_STAT_BUCKETS - 1]);
+}
+
 #ifndef NDEBUG
 NTEST(Assert)
 {
@@ -131,6 +172,8 @@ NTEST_SUITE(Util)
 	NTEST_ADD(Rounding);
 	NTEST_ADD(ShellSort);
 	NTEST_ADD(strtoi32);
+	NTEST_ADD(TimeNs);
+	NTEST_ADD(TimeStat);
 #ifndef NDEBUG
 	NTEST_ADD(Assert);
 #endif
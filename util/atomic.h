@@ -0,0 +1,64 @@
+/*
+ * nurdlib, NUstar ReaDout LIBrary
+ *
+ * Copyright (C) 2026
+ * nurdlib contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#ifndef UTIL_ATOMIC_H
+#define UTIL_ATOMIC_H
+
+/*
+ * Acquire loads and release stores of word-sized variables, enough for a
+ * single-producer/single-consumer hand-over between two threads.
+ */
+
+#include <nconf/util/atomic.h>
+
+#if NCONF_mATOMIC_bGCC_ATOMIC
+#	define ATOMIC_LOAD(p) __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#	define ATOMIC_STORE(p, v) __atomic_store_n(p, v, __ATOMIC_RELEASE)
+#elif NCONF_mATOMIC_bGCC_SYNC
+#	define ATOMIC_LOAD(p) __sync_fetch_and_add(p, 0)
+#	define ATOMIC_STORE(p, v) do {\
+		__sync_synchronize();\
+		*(p) = (v);\
+		__sync_synchronize();\
+	} while (0)
+#elif NCONF_mATOMIC_bNONE
+/* NCONF_NOEXEC */
+/*
+ * Plain accesses without ordering, fine for flags polled across function
+ * calls, but lock-free hand-overs such as the shadow rings must check
+ * ATOMIC_NONE and refuse to run.
+ */
+#	define ATOMIC_NONE 1
+#	define ATOMIC_LOAD(p) (*(p))
+#	define ATOMIC_STORE(p, v) (*(p) = (v))
+#endif
+#if NCONFING_mATOMIC
+#	include <stdlib.h>
+#	define NCONF_TEST nconf_test_()
+static int nconf_test_(void) {
+	size_t i = 0;
+	ATOMIC_STORE(&i, 1);
+	return 1 == ATOMIC_LOAD(&i);
+}
+#endif
+
+#endif
@@ -0,0 +1,161 @@
+/*
+ * nurdlib, NUstar ReaDout LIBrary
+ *
+ * Copyright (C) 2026
+ * nurdlib contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#include <nconf/util/hugepage.c>
+
+#if NCONF_mHUGEPAGE_bMAP_HUGETLB
+/* NCONF_NOLINK */
+#	define _DEFAULT_SOURCE 1
+#	include <sys/mman.h>
+#	define HUGEPAGE_MMAP 1
+#elif NCONF_mHUGEPAGE_bMADVISE
+/* NCONF_NOLINK */
+#	define _DEFAULT_SOURCE 1
+#	include <sys/mman.h>
+#	define HUGEPAGE_MMAP 1
+#elif NCONF_mHUGEPAGE_bNONE
+/* NCONF_NOEXEC */
+#endif
+#if NCONFING_mHUGEPAGE
+#	if NCONF_mHUGEPAGE_bMAP_HUGETLB
+#		define NCONF_TEST 0 != MAP_HUGETLB
+#	elif NCONF_mHUGEPAGE_bMADVISE
+#		define NCONF_TEST 0 != MADV_HUGEPAGE
+#	endif
+#endif
+
+#include <util/hugepage.h>
+#include <stdio.h>
+#include <nurdlib/log.h>
+#include <util/fmtmod.h>
+
+#if HUGEPAGE_MMAP
+static size_t	hugepage_bytes(void);
+
+static int g_is_probed;
+static size_t g_bytes;
+
+/* Huge page size of the system, 0 if unknown. */
+size_t
+hugepage_bytes(void)
+{
+	FILE *file;
+	char line[80];
+
+	if (g_is_probed) {
+		return g_bytes;
+	}
+	g_is_probed = 1;
+	file = fopen("/proc/meminfo", "rb");
+	if (NULL == file) {
+		LOGF(verbose)(LOGL, "No /proc/meminfo, no huge pages.");
+		return 0;
+	}
+	while (NULL != fgets(line, sizeof line, file)) {
+		unsigned long kib;
+
+		if (1 == sscanf(line, "Hugepagesize: %lu kB", &kib)) {
+			g_bytes = (size_t)kib << 10;
+			break;
+		}
+	}
+	fclose(file);
+	/* The rounding below needs a power of two. */
+	if (0 != (g_bytes & (g_bytes - 1))) {
+		g_bytes = 0;
+	}
+	LOGF(verbose)(LOGL, "Huge page size=0x%"PRIzx".", g_bytes);
+	return g_bytes;
+}
+#endif
+
+void *
+hugepage_alloc(size_t *a_bytes)
+{
+	void *p;
+#if HUGEPAGE_MMAP
+	size_t page, bytes;
+
+	/*
+	 * Small buffers would waste most of a huge page, and with reserved
+	 * pages eat one each, so only the big targets get them.
+	 */
+	page = hugepage_bytes();
+	if (0 == page || page > *a_bytes) {
+		p = malloc(*a_bytes);
+		if (NULL == p) {
+			log_err(LOGL, "malloc(%"PRIz")", *a_bytes);
+		}
+		return p;
+	}
+	bytes = (*a_bytes + page - 1) & ~(page - 1);
+#	if NCONF_mHUGEPAGE_bMAP_HUGETLB
+	p = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE |
+	    MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+	if (MAP_FAILED != p) {
+		LOGF(verbose)(LOGL, "Reserved huge pages, bytes=0x%"PRIzx".",
+		    bytes);
+		*a_bytes = bytes;
+		return p;
+	}
+	LOGF(verbose)(LOGL, "No reserved huge pages, trying transparent "
+	    "ones.");
+#	endif
+	p = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE |
+	    MAP_ANONYMOUS, -1, 0);
+	if (MAP_FAILED == p) {
+		log_err(LOGL, "mmap(bytes=0x%"PRIzx")", bytes);
+	}
+#	ifdef MADV_HUGEPAGE
+	/* Only a hint, the kernel may still hand out small pages. */
+	(void)madvise(p, bytes, MADV_HUGEPAGE);
+#	endif
+	*a_bytes = bytes;
+#else
+	p = malloc(*a_bytes);
+	if (NULL == p) {
+		log_err(LOGL, "malloc(%"PRIz")", *a_bytes);
+	}
+#endif
+	return p;
+}
+
+void
+hugepage_free(void *a_ptr, size_t a_bytes)
+{
+	if (NULL == a_ptr) {
+		return;
+	}
+#if HUGEPAGE_MMAP
+	/* Mapped sizes are rounded up, so never below a huge page. */
+	if (0 == hugepage_bytes() || hugepage_bytes() > a_bytes) {
+		free(a_ptr);
+		return;
+	}
+	if (0 != munmap(a_ptr, a_bytes)) {
+		log_error(LOGL, "munmap(bytes=0x%"PRIzx") failed.", a_bytes);
+	}
+#else
+	(void)a_bytes;
+	free(a_ptr);
+#endif
+}
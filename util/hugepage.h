@@ -0,0 +1,40 @@
+/*
+ * nurdlib, NUstar ReaDout LIBrary
+ *
+ * Copyright (C) 2026
+ * nurdlib contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#ifndef UTIL_HUGEPAGE_H
+#define UTIL_HUGEPAGE_H
+
+#include <stdlib.h>
+#include <util/funcattr.h>
+
+/*
+ * Allocates memory backed by huge pages where the system provides them,
+ * which saves TLB misses on big DMA targets, or else by normal pages.
+ * The huge page size is taken from /proc/meminfo, requests smaller than one
+ * huge page, or on systems without that info, are plain malloc:s. The given
+ * size is rounded up to what was actually mapped and must be passed back to
+ * 'hugepage_free'.
+ */
+void	*hugepage_alloc(size_t *) FUNC_RETURNS;
+void	hugepage_free(void *, size_t);
+
+#endif
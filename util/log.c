@@ -27,12 +27,16 @@
 #include <string.h>
 #include <nurdlib/base.h>
 #include <util/assert.h>
+#include <util/atomic.h>
 #include <util/fmtmod.h>
 #include <util/stdint.h>
 #include <util/string.h>
+#include <util/thread.h>
 #include <util/time.h>
 
 #define INDENT_MAX 10
+#define ASYNC_RECORD_NUM 1024
+#define TEXT_LEN 1024
 
 enum SuppressState {
 	SUPPRESS_STATE_DONT,
@@ -42,10 +46,24 @@ enum SuppressState {
 struct LogLevel {
 	unsigned	index;
 };
+/* Formatted message waiting for the flusher thread. */
+struct AsyncRecord {
+	char	const *file;
+	int	line_no;
+	unsigned	level;
+	time_t	t;
+	char	str[TEXT_LEN];
+};
 
+#if DO_PTHREADS
+static void	async_flush(void);
+static void	async_func(void *);
+static int	async_push(char const *, int, unsigned, char const *);
+#endif
 static void	callback_stdio(char const *, int, unsigned, char const *);
 static void	print(struct LogFile const *, int, enum Keyword, char const *,
     va_list, int) FUNC_PRINTF(4, 0);
+static void	write_stdio(time_t, char const *, int, unsigned, char const *);
 
 #define LOG_LEVEL_DEFINE(name, index)\
     static struct LogLevel const g_##name##_ = {index};\
@@ -60,32 +78,198 @@ static unsigned g_stack_i;
 static unsigned g_indent;
 static LogCallback g_callback = callback_stdio;
 static enum SuppressState g_suppress_state;
+#if DO_PTHREADS
+/*
+ * Producers only copy into the ring under the mutex, all I/O happens in the
+ * flusher thread which follows the head without locking.
+ * Loggers racing a stop see !is_running under the mutex and fall back to
+ * synchronous output. The ring and mutex are freed by log_async_stop, so
+ * other threads must be done logging by then.
+ */
+static struct {
+	int	is_inited;
+	int	is_running;
+	struct	Thread thread;
+	struct	Mutex mutex;
+	struct	AsyncRecord *ring;
+	size_t	head;
+	size_t	tail;
+	unsigned	drop_num;
+	unsigned	drop_reported;
+} g_async;
+#endif
+
+#if DO_PTHREADS
+void
+async_flush(void)
+{
+	if (!ATOMIC_LOAD(&g_async.is_running) ||
+	    thread_is_current(&g_async.thread)) {
+		/* The flusher would wait for itself. */
+		return;
+	}
+	while (ATOMIC_LOAD(&g_async.tail) != ATOMIC_LOAD(&g_async.head)) {
+		sched_yield();
+	}
+}
+
+void
+async_func(void *a_data)
+{
+	(void)a_data;
+	for (;;) {
+		size_t head, tail;
+		unsigned drop_num;
+		int is_empty;
+
+		head = ATOMIC_LOAD(&g_async.head);
+		tail = g_async.tail;
+		is_empty = head == tail;
+		for (; head != tail; ++tail) {
+			struct AsyncRecord const *rec;
+
+			rec = &g_async.ring[tail % ASYNC_RECORD_NUM];
+			if (callback_stdio == g_callback) {
+				write_stdio(rec->t, rec->file, rec->line_no,
+				    rec->level, rec->str);
+			} else {
+				g_callback(rec->file, rec->line_no,
+				    rec->level, rec->str);
+			}
+			ATOMIC_STORE(&g_async.tail, tail + 1);
+		}
+		drop_num = ATOMIC_LOAD(&g_async.drop_num);
+		if (g_async.drop_reported != drop_num) {
+			char buf[64];
+			time_t t_now;
+
+			snprintf_(buf, sizeof buf, "Log queue full, dropped "
+			    "%u messages.", drop_num - g_async.drop_reported);
+			g_async.drop_reported = drop_num;
+			time(&t_now);
+			if (callback_stdio == g_callback) {
+				write_stdio(t_now, __FILE__, __LINE__,
+				    KW_ERROR, buf);
+			} else {
+				g_callback(__FILE__, __LINE__, KW_ERROR, buf);
+			}
+		}
+		if (is_empty) {
+			if (!ATOMIC_LOAD(&g_async.is_running)) {
+				/* Records pushed before the stop may remain. */
+				if (ATOMIC_LOAD(&g_async.head) ==
+				    g_async.tail) {
+					break;
+				}
+				continue;
+			}
+			time_sleep(1e-3);
+		}
+	}
+}
+
+int
+async_push(char const *a_file, int a_line_no, unsigned a_level, char const
+    *a_str)
+{
+	struct AsyncRecord *rec;
+	int ret;
+
+	ret = 1;
+	thread_mutex_lock(&g_async.mutex);
+	if (!g_async.is_running) {
+		ret = 0;
+	} else if (ASYNC_RECORD_NUM == g_async.head -
+	    ATOMIC_LOAD(&g_async.tail)) {
+		ATOMIC_STORE(&g_async.drop_num, g_async.drop_num + 1);
+	} else {
+		rec = &g_async.ring[g_async.head % ASYNC_RECORD_NUM];
+		rec->file = a_file;
+		rec->line_no = a_line_no;
+		rec->level = a_level;
+		time(&rec->t);
+		strlcpy_(rec->str, a_str, sizeof rec->str);
+		ATOMIC_STORE(&g_async.head, g_async.head + 1);
+	}
+	thread_mutex_unlock(&g_async.mutex);
+	return ret;
+}
+#endif
 
 void
 callback_stdio(char const *a_file, int a_line_no, unsigned a_level, char const
     *a_str)
 {
-	struct tm tm;
 	time_t t_now;
-	char tbuf[26];
-	FILE *str;
-	char const *level;
 
 	time(&t_now);
-	gmtime_r_(&t_now, &tm);
-	strftime(tbuf, sizeof tbuf, "%Y-%m-%d,%H:%M:%S", &tm);
-	str = stdout;
-	switch (a_level) {
-	case KW_INFO:    level = "INFO"; break;
-	case KW_VERBOSE: level = "VRBS"; break;
-	case KW_DEBUG:   level = "DEBG"; break;
-	case KW_SPAM:    level = "SPAM"; break;
-	case KW_ERROR:   level = "ERRR"; str = stderr; break;
-	default: abort();
+	write_stdio(t_now, a_file, a_line_no, a_level, a_str);
+}
+
+unsigned
+log_async_get_drop_num(void)
+{
+#if DO_PTHREADS
+	return ATOMIC_LOAD(&g_async.drop_num);
+#else
+	return 0;
+#endif
+}
+
+void
+log_async_start(void)
+{
+#if DO_PTHREADS
+	if (!g_async.is_inited) {
+		CALLOC(g_async.ring, ASYNC_RECORD_NUM);
+		if (!thread_mutex_init(&g_async.mutex)) {
+			log_die(LOGL, "Could not create async log mutex.");
+		}
+		ATOMIC_STORE(&g_async.is_inited, 1);
 	}
-	fprintf(str, "%s:%s: %s [%s:%u]\n",
-	    tbuf, level, a_str, a_file, a_line_no);
-	fflush(str);
+	thread_mutex_lock(&g_async.mutex);
+	if (g_async.is_running) {
+		thread_mutex_unlock(&g_async.mutex);
+		return;
+	}
+	g_async.head = 0;
+	g_async.tail = 0;
+	g_async.drop_num = 0;
+	g_async.drop_reported = 0;
+	ATOMIC_STORE(&g_async.is_running, 1);
+	thread_mutex_unlock(&g_async.mutex);
+	if (!thread_start(&g_async.thread, async_func, NULL)) {
+		log_die(LOGL, "Could not start async log thread.");
+	}
+	LOGF(verbose)(LOGL, "Async logging started.");
+#else
+	LOGF(info)(LOGL, "No threads, async logging not available.");
+#endif
+}
+
+void
+log_async_stop(void)
+{
+#if DO_PTHREADS
+	int is_running;
+
+	if (!ATOMIC_LOAD(&g_async.is_inited)) {
+		return;
+	}
+	thread_mutex_lock(&g_async.mutex);
+	is_running = g_async.is_running;
+	ATOMIC_STORE(&g_async.is_running, 0);
+	thread_mutex_unlock(&g_async.mutex);
+	if (is_running) {
+		thread_clean(&g_async.thread);
+	}
+	ATOMIC_STORE(&g_async.is_inited, 0);
+	thread_mutex_clean(&g_async.mutex);
+	FREE(g_async.ring);
+	if (is_running) {
+		LOGF(verbose)(LOGL, "Async logging stopped.");
+	}
+#endif
 }
 
 void
@@ -105,6 +289,9 @@ log_die(struct LogFile const *a_file, int a_line_no, char const *a_fmt, ...)
 	/* Even better would be if log_errorv above is fatal error level. */
 	LOGF(fatal)(LOGL, "Fatal error.");
 	log_error(a_file, a_line_no, "Calling abort()...");
+#if DO_PTHREADS
+	async_flush();
+#endif
 	abort();
 }
 
@@ -202,6 +389,9 @@ log_err(struct LogFile const *a_file, int a_line_no, char const *a_fmt, ...)
 	va_start(args, a_fmt);
 	print(a_file, a_line_no, KW_ERROR, a_fmt, args, errno_);
 	va_end(args);
+#if DO_PTHREADS
+	async_flush();
+#endif
 	abort();
 }
 
@@ -210,6 +400,9 @@ log_verr(struct LogFile const *a_file, int a_line_no, char const *a_fmt,
     va_list a_args)
 {
 	print(a_file, a_line_no, KW_ERROR, a_fmt, a_args, errno);
+#if DO_PTHREADS
+	async_flush();
+#endif
 	abort();
 }
 
@@ -353,7 +546,7 @@ void
 print(struct LogFile const *a_file, int a_line_no, enum Keyword a_level, char
     const *a_fmt, va_list a_args, int a_errno)
 {
-	char buf[1024];
+	char buf[TEXT_LEN];
 	size_t ofs;
 
 	assert(
@@ -393,5 +586,36 @@ print(struct LogFile const *a_file, int a_line_no, enum Keyword a_level, char
 		    strerror(errno));
 		ofs = 0;
 	}
+#if DO_PTHREADS
+	if (ATOMIC_LOAD(&g_async.is_inited) && async_push((void const *)a_file,
+	    a_line_no, a_level, buf + ofs)) {
+		return;
+	}
+#endif
 	g_callback((void const *)a_file, a_line_no, a_level, buf + ofs);
 }
+
+void
+write_stdio(time_t a_t, char const *a_file, int a_line_no, unsigned a_level,
+    char const *a_str)
+{
+	struct tm tm;
+	char tbuf[26];
+	FILE *str;
+	char const *level;
+
+	gmtime_r_(&a_t, &tm);
+	strftime(tbuf, sizeof tbuf, "%Y-%m-%d,%H:%M:%S", &tm);
+	str = stdout;
+	switch (a_level) {
+	case KW_INFO:    level = "INFO"; break;
+	case KW_VERBOSE: level = "VRBS"; break;
+	case KW_DEBUG:   level = "DEBG"; break;
+	case KW_SPAM:    level = "SPAM"; break;
+	case KW_ERROR:   level = "ERRR"; str = stderr; break;
+	default: abort();
+	}
+	fprintf(str, "%s:%s: %s [%s:%u]\n",
+	    tbuf, level, a_str, a_file, a_line_no);
+	fflush(str);
+}
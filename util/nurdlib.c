@@ -38,7 +38,9 @@ struct Crate *
 nurdlib_setup(LogCallback a_log_callback, char const *a_config_path,
     InitCallback init_callback, InitCallback deinit_callback)
 {
+	struct ConfigBlock *crate_block;
 	struct Crate *crate;
+	struct Crate *first;
 
 	if (g_is_setup) {
 		log_die(LOGL, "nurdlib_setup called twice in a row!");
@@ -50,12 +52,27 @@ nurdlib_setup(LogCallback a_log_callback, char const *a_config_path,
 	module_setup();
 	map_setup();
 	config_load(a_config_path);
-	crate = crate_create();
-	crate_set_init_callback(crate, init_callback, deinit_callback);
-	crate_init(crate);
+	if (config_get_boolean(NULL, KW_LOG_ASYNC)) {
+		log_async_start();
+	}
+	/* Several CRATE blocks give several crates, the first is returned. */
+	first = crate_create();
+	crate_block = config_get_block(NULL, KW_CRATE);
+	for (;;) {
+		crate_block = config_get_block_next(crate_block, KW_CRATE);
+		if (NULL == crate_block) {
+			break;
+		}
+		crate = crate_create_block(crate_block);
+	}
+	for (crate = first; NULL != crate; crate = crate_get_next(crate)) {
+		crate_set_init_callback(crate, init_callback,
+		    deinit_callback);
+		crate_init(crate);
+	}
 	g_server = ctrl_server_create();
 	g_is_setup = 1;
-	return crate;
+	return first;
 }
 
 void
@@ -64,10 +81,19 @@ nurdlib_shutdown(struct Crate **a_crate)
 	if (!g_is_setup) {
 		log_die(LOGL, "nurdlib_shutdown called twice in a row!");
 	}
+	if (NULL != *a_crate) {
+		struct Crate *crate;
+
+		/* Crates after the returned one were created here too. */
+		while (NULL != (crate = crate_get_next(*a_crate))) {
+			crate_free(&crate);
+		}
+	}
 	crate_free(a_crate);
 	ctrl_server_free(&g_server);
 	map_shutdown();
 	config_shutdown();
+	log_async_stop();
 	log_level_clear();
 	g_is_setup = 0;
 }
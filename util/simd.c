@@ -0,0 +1,153 @@
+/*
+ * nurdlib, NUstar ReaDout LIBrary
+ *
+ * Copyright (C) 2026
+ * nurdlib contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+
+#include <nconf/util/simd.c>
+
+#if NCONF_mSIMD_bSSE2
+#	include <emmintrin.h>
+#elif NCONF_mSIMD_bNEON
+#	include <arm_neon.h>
+#elif NCONF_mSIMD_bNONE
+/* NCONF_NOEXEC */
+#endif
+
+#include <util/simd.h>
+
+void
+simd_fill32(uint32_t *a_p32, uint32_t a_u32, size_t a_words)
+{
+	uint32_t *end;
+
+	end = a_p32 + a_words;
+#if NCONF_mSIMD_bSSE2
+	{
+		__m128i v;
+
+		v = _mm_set1_epi32((int)a_u32);
+		for (; 4 <= end - a_p32; a_p32 += 4) {
+			_mm_storeu_si128((void *)a_p32, v);
+		}
+	}
+#elif NCONF_mSIMD_bNEON
+	{
+		uint32x4_t v;
+
+		v = vdupq_n_u32(a_u32);
+		for (; 4 <= end - a_p32; a_p32 += 4) {
+			vst1q_u32(a_p32, v);
+		}
+	}
+#endif
+	for (; end != a_p32; ++a_p32) {
+		*a_p32 = a_u32;
+	}
+}
+
+uint32_t const *
+simd_skip32(uint32_t const *a_p32, uint32_t const *a_end, uint32_t a_u32)
+{
+#if NCONF_mSIMD_bSSE2
+	{
+		__m128i v;
+
+		v = _mm_set1_epi32((int)a_u32);
+		for (; 4 <= a_end - a_p32; a_p32 += 4) {
+			__m128i eq;
+
+			eq = _mm_cmpeq_epi32(_mm_loadu_si128((void const
+			    *)a_p32), v);
+			if (0xffff != _mm_movemask_epi8(eq)) {
+				break;
+			}
+		}
+	}
+#elif NCONF_mSIMD_bNEON
+	{
+		uint32x4_t v;
+
+		v = vdupq_n_u32(a_u32);
+		for (; 4 <= a_end - a_p32; a_p32 += 4) {
+			uint32x4_t eq;
+			uint32x2_t and;
+
+			eq = vceqq_u32(vld1q_u32(a_p32), v);
+			and = vand_u32(vget_low_u32(eq), vget_high_u32(eq));
+			and = vand_u32(and, vrev64_u32(and));
+			if (0 == vget_lane_u32(and, 0)) {
+				break;
+			}
+		}
+	}
+#endif
+	/* Pin-point inside the last vector or handle the tail. */
+	while (a_end != a_p32 && a_u32 == *a_p32) {
+		++a_p32;
+	}
+	return a_p32;
+}
+
+void
+simd_swap32(uint32_t *a_p32, size_t a_words)
+{
+	uint32_t *end;
+
+	end = a_p32 + a_words;
+#if NCONF_mSIMD_bSSE2
+	for (; 4 <= end - a_p32; a_p32 += 4) {
+		__m128i v;
+
+		v = _mm_loadu_si128((void const *)a_p32);
+		v = _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+		_mm_storeu_si128((void *)a_p32, v);
+	}
+#elif NCONF_mSIMD_bNEON
+	for (; 4 <= end - a_p32; a_p32 += 4) {
+		vst1q_u32(a_p32, vrev64q_u32(vld1q_u32(a_p32)));
+	}
+#endif
+	for (; 2 <= end - a_p32; a_p32 += 2) {
+		uint32_t swap;
+
+		swap = a_p32[0];
+		a_p32[0] = a_p32[1];
+		a_p32[1] = swap;
+	}
+}
+
+#if NCONFING_mSIMD
+#	define NCONF_TEST nconf_test_()
+int nconf_test_(void);
+int nconf_test_(void) {
+	uint32_t u32[9];
+	size_t i;
+	simd_fill32(u32, 1, 9);
+	u32[6] = 2;
+	simd_swap32(u32, 8);
+	for (i = 0; i < 9; ++i) {
+		if ((7 == i ? 2 : 1) != u32[i]) {
+			return 0;
+		}
+	}
+	return &u32[7] == simd_skip32(u32, &u32[9], 1);
+}
+#endif
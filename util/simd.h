@@ -0,0 +1,45 @@
+/*
+ * nurdlib, NUstar ReaDout LIBrary
+ *
+ * Copyright (C) 2026
+ * nurdlib contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+
+#ifndef UTIL_SIMD_H
+#define UTIL_SIMD_H
+
+#include <stdlib.h>
+#include <util/funcattr.h>
+#include <util/stdint.h>
+
+/*
+ * Word kernels for the data path, vectorized where nconf finds SSE2 or
+ * NEON and plain loops otherwise. No alignment is required.
+ *  fill32: Sets words to a value.
+ *  skip32: Returns the first word in [p,end) not equal to the value, or
+ *          end, e.g. to gobble DMA filler.
+ *  swap32: Swaps the 32-bit halves of 64-bit words, the count is in 32-bit
+ *          words and must be even.
+ */
+void		simd_fill32(uint32_t *, uint32_t, size_t);
+uint32_t const	*simd_skip32(uint32_t const *, uint32_t const *, uint32_t)
+	FUNC_RETURNS;
+void		simd_swap32(uint32_t *, size_t);
+
+#endif
@@ -194,6 +194,12 @@ thread_clean(struct Thread *a_thread)
 	return ret;
 }
 
+int
+thread_is_current(struct Thread const *a_thread)
+{
+	return pthread_equal(a_thread->thread, pthread_self());
+}
+
 int
 thread_start(struct Thread *a_thread, void (*a_func)(void *), void *a_data)
 {
@@ -91,6 +91,8 @@ int	thread_mutex_is_locked(struct Mutex *) FUNC_NONNULL(()) FUNC_RETURNS;
 int	thread_mutex_lock(struct Mutex *) FUNC_NONNULL(());
 int	thread_mutex_unlock(struct Mutex *) FUNC_NONNULL(());
 int	thread_clean(struct Thread *) FUNC_NONNULL(());
+int	thread_is_current(struct Thread const *) FUNC_NONNULL(())
+	FUNC_RETURNS;
 int	thread_start(struct Thread *, void (*)(void *), void *)
 	FUNC_NONNULL((1, 2)) FUNC_RETURNS;
 void	thread_start_callback_set(ThreadCreateCallback, void *);
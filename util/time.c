@@ -44,6 +44,41 @@ static int nconf_test_(void) {
 }
 #endif
 
+#if NCONF_mTIME_CYCLES_bX86
+/* NCONF_NOLINK */
+#	include <util/stdint.h>
+#	if !defined(__i386__) && !defined(__x86_64__)
+#		error "No x86 TSC."
+#	endif
+#	define TIME_CYCLES_GET(var) do {\
+		uint32_t lo_, hi_;\
+		__asm__ volatile ("rdtsc" : "=a" (lo_), "=d" (hi_));\
+		var = (uint64_t)hi_ << 32 | lo_;\
+	} while (0)
+#elif NCONF_mTIME_CYCLES_bAARCH64
+/* NCONF_NOLINK */
+#	include <util/stdint.h>
+#	if !defined(__aarch64__)
+#		error "No aarch64 virtual counter."
+#	endif
+#	define TIME_CYCLES_GET(var) __asm__ volatile ("mrs %0, cntvct_el0" :\
+    "=r" (var))
+#elif NCONF_mTIME_CYCLES_bNO
+/* NCONF_NOLINK */
+#endif
+#if NCONFING_mTIME_CYCLES
+#	if defined(TIME_CYCLES_GET)
+#		define NCONF_TEST nconf_test_()
+static int nconf_test_(void) {
+	uint64_t c;
+	TIME_CYCLES_GET(c);
+	return 0 != c;
+}
+#	else
+#		define NCONF_TEST 1
+#	endif
+#endif
+
 #if NCONF_mTIME_SLEEP_bNANOSLEEP
 #endif
 #if NCONFING_mTIME_SLEEP
@@ -90,68 +125,124 @@ static int nconf_test_(void) {
 #include <time.h>
 #if TIME_CLOCK_GETTIME
 #	include <stdlib.h>
-#	include <util/thread.h>
 #elif NCONF_mTIME_GET_bMACH
 #	include <stdlib.h>
 #	include <mach/mach_time.h>
 #endif
 
+#include <nurdlib/base.h>
 #include <nurdlib/log.h>
 #define KEEP_GMTIME_R
 #include <util/time.h>
 
+#if defined(TIME_CLOCK_GETTIME)
+static void	get_timespec(struct timespec *);
+#endif
+
+#if defined(TIME_CLOCK_GETTIME)
+/*
+ * The clock is resolved on first use with a single word store, so racing
+ * threads can at worst resolve it twice to the same value, and no lock is
+ * needed around the (vDSO) clock_gettime.
+ */
+static clockid_t g_clockid = (clockid_t)-1;
+#endif
+
+#if defined(TIME_CYCLES_GET)
+/*
+ * Calibrated cycle counter, requires a constant rate counter which is
+ * synchronized between cores, e.g. an invariant TSC.
+ * Written without locking, so only touched during single-threaded setup,
+ * 'state' makes sure that later setups leave it alone.
+ */
+static struct {
+	enum {
+		CYCLES_NONE,
+		CYCLES_OK,
+		CYCLES_FAIL
+	} state;
+	int	is_on;
+	uint64_t	c0;
+	uint64_t	ns0;
+	double	ns_per_cycle;
+} g_cycles;
+#endif
+
+#if defined(TIME_CLOCK_GETTIME)
+void
+get_timespec(struct timespec *a_tp)
+{
+	clockid_t clockid;
+
+	clockid = g_clockid;
+	if ((clockid_t)-1 == clockid) {
+#	if defined(CLOCK_MONOTONIC)
+		clockid = 0 == clock_gettime(CLOCK_MONOTONIC, a_tp) ?
+		    CLOCK_MONOTONIC : CLOCK_REALTIME;
+#	else
+		clockid = CLOCK_REALTIME;
+#	endif
+		g_clockid = clockid;
+	}
+	if (0 != clock_gettime(clockid, a_tp)) {
+		log_err(LOGL, "clock_gettime");
+	}
+}
+#endif
+
 struct tm *
 gmtime_r_(time_t const *a_tt, struct tm *a_tm)
 {
 	return GMTIME_R(a_tt, a_tm);
 }
 
+int
+time_cycles_calibrate(void)
+{
+#if defined(TIME_CYCLES_GET)
+	uint64_t c_a, c_b, ns_a, ns_b;
+
+	if (CYCLES_NONE != g_cycles.state) {
+		return g_cycles.is_on;
+	}
+	ns_a = time_getns();
+	TIME_CYCLES_GET(c_a);
+	time_sleep(0.01);
+	ns_b = time_getns();
+	TIME_CYCLES_GET(c_b);
+	if (c_b <= c_a || ns_b <= ns_a) {
+		log_error(LOGL, "Cycle counter not ticking, ignoring it.");
+		g_cycles.state = CYCLES_FAIL;
+		return 0;
+	}
+	g_cycles.c0 = c_b;
+	g_cycles.ns0 = ns_b;
+	g_cycles.ns_per_cycle = (double)(ns_b - ns_a) / (c_b - c_a);
+	g_cycles.state = CYCLES_OK;
+	g_cycles.is_on = 1;
+	LOGF(verbose)(LOGL, "Cycle counter=%.3f GHz.",
+	    1.0 / g_cycles.ns_per_cycle);
+	return 1;
+#else
+	return 0;
+#endif
+}
+
+void
+time_cycles_reset(void)
+{
+#if defined(TIME_CYCLES_GET)
+	ZERO(g_cycles);
+#endif
+}
+
 double
 time_getd(void)
 {
 #if defined(TIME_CLOCK_GETTIME)
-	enum MutexState {
-		MUTEX_UNINITED,
-		MUTEX_OK,
-		MUTEX_FAIL
-	};
-	static enum MutexState s_mutex_state = MUTEX_UNINITED;
-	static struct Mutex s_mutex;
-	clockid_t s_clockid =
-#	if defined(CLOCK_MONOTONIC)
-	    CLOCK_MONOTONIC;
-#	else
-	    CLOCK_REALTIME;
-#	endif
 	struct timespec tp;
 
-	if (MUTEX_UNINITED == s_mutex_state) {
-		s_mutex_state = thread_mutex_init(&s_mutex) ? MUTEX_OK :
-		    MUTEX_FAIL;
-		/*
-		 * If the mutex init failed, then we shouldn't see more than
-		 * one thread entering here, so let's keep going without using
-		 * the mutex.
-		 */
-	}
-	if (MUTEX_OK == s_mutex_state) {
-		thread_mutex_lock(&s_mutex);
-	}
-	for (;;) {
-		if (0 == clock_gettime(s_clockid, &tp)) {
-			break;
-		}
-#	if defined(CLOCK_MONOTONIC)
-		if (CLOCK_MONOTONIC == s_clockid) {
-			s_clockid = CLOCK_REALTIME;
-			continue;
-		}
-#	endif
-		log_err(LOGL, "clock_gettime");
-	}
-	if (MUTEX_OK == s_mutex_state) {
-		thread_mutex_unlock(&s_mutex);
-	}
+	get_timespec(&tp);
 	return tp.tv_sec + 1e-9 * tp.tv_nsec;
 #elif defined(NCONF_mTIME_GET_bMACH)
 	uint64_t mach_time;
@@ -176,6 +267,33 @@ time_getd(void)
 #endif
 }
 
+uint64_t
+time_getns(void)
+{
+#if defined(TIME_CYCLES_GET)
+	if (g_cycles.is_on) {
+		uint64_t c;
+
+		TIME_CYCLES_GET(c);
+		if (c < g_cycles.c0) {
+			return g_cycles.ns0;
+		}
+		return g_cycles.ns0 + (uint64_t)((c - g_cycles.c0) *
+		    g_cycles.ns_per_cycle);
+	}
+#endif
+#if defined(TIME_CLOCK_GETTIME)
+	{
+		struct timespec tp;
+
+		get_timespec(&tp);
+		return (uint64_t)tp.tv_sec * 1000000000 + tp.tv_nsec;
+	}
+#else
+	return 1e9 * time_getd();
+#endif
+}
+
 char *
 time_gets(void)
 {
@@ -213,4 +331,21 @@ time_sleep(double a_s)
 	return 1;
 }
 
+void
+time_stat_add(struct TimeStat *a_stat, uint64_t a_ns)
+{
+	uint64_t us;
+	unsigned bucket;
+
+	++a_stat->num;
+	a_stat->sum_ns += a_ns;
+	a_stat->max_ns = MAX(a_stat->max_ns, MIN(a_ns, 0xffffffff));
+	bucket = 0;
+	for (us = a_ns / 1000; 0 != us && bucket < TIME_STAT_BUCKETS - 1;
+	    us >>= 1) {
+		++bucket;
+	}
+	++a_stat->hist[bucket];
+}
+
 #endif
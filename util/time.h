@@ -24,6 +24,7 @@
 #define UTIL_TIME_H
 
 #include <util/funcattr.h>
+#include <util/stdint.h>
 #include <time.h>
 
 #ifndef KEEP_GMTIME_R
@@ -33,9 +34,36 @@
 #	define gmtime_r PLEASE_USE_gmtime_r_
 #endif
 
-struct	tm *gmtime_r_(time_t const *, struct tm *);
-double	time_getd(void) FUNC_RETURNS;
-char	*time_gets(void) FUNC_RETURNS;
-int	time_sleep(double);
+/*
+ * Duration histogram, bucket 0 counts < 1 us and bucket i [2^(i-1), 2^i) us,
+ * the last one is open-ended. Meant for a single writer, readers in other
+ * threads may see slightly inconsistent values but need no locking.
+ */
+#define TIME_STAT_BUCKETS 16
+struct TimeStat {
+	uint32_t	num;
+	uint32_t	max_ns;
+	uint64_t	sum_ns;
+	uint32_t	hist[TIME_STAT_BUCKETS];
+};
+
+struct		tm *gmtime_r_(time_t const *, struct tm *);
+/*
+ * Switches time_getns to a calibrated cycle counter, if available. Only the
+ * first call calibrates, later calls return the same result. Not
+ * thread-safe, call only before other threads read the time.
+ */
+int		time_cycles_calibrate(void);
+/*
+ * Drops the calibration and goes back to the monotonic clock, e.g. in
+ * tests. Same threading rules as above.
+ */
+void		time_cycles_reset(void);
+double		time_getd(void) FUNC_RETURNS;
+/* Monotonic integer nanoseconds, cheap enough for polling loops. */
+uint64_t	time_getns(void) FUNC_RETURNS;
+char		*time_gets(void) FUNC_RETURNS;
+int		time_sleep(double);
+void		time_stat_add(struct TimeStat *, uint64_t);
 
 #endif